@@ -89,6 +89,7 @@ ChatCommand * ChatHandler::getCommandTable()
         { "start",      SEC_ADMINISTRATOR,      true,  &ChatHandler::HandleBotStartCommand,            "", nullptr },
         { "ranadd",     SEC_ADMINISTRATOR,      true,  &ChatHandler::HandleBotAddRandomCommand,        "", nullptr },
         { "status",     SEC_GAMEMASTER,         false, &ChatHandler::HandleBotStatusCommand,           "", nullptr },
+        { "profile",    SEC_ADMINISTRATOR,      true,  &ChatHandler::HandleBotProfileCommand,          "", nullptr },
         { nullptr,      0,                      false, nullptr,                                        "", nullptr },
     };
 
@@ -131,6 +132,7 @@ ChatCommand * ChatHandler::getCommandTable()
         { "removeall",    SEC_ADMINISTRATOR,    true,  &ChatHandler::HandleBattleBotRemoveAllCommand,    "", nullptr },
         { "showpath",     SEC_ADMINISTRATOR,    false, &ChatHandler::HandleBattleBotShowPathCommand,     "", nullptr },
         { "showallpaths", SEC_ADMINISTRATOR,    false, &ChatHandler::HandleBattleBotShowAllPathsCommand, "", nullptr },
+        { "showgraph",    SEC_ADMINISTRATOR,    false, &ChatHandler::HandleBattleBotShowGraphCommand,    "", nullptr },
         { nullptr,        0,                    false, nullptr,                                          "", nullptr },
     };
 
@@ -271,6 +271,7 @@ class ChatHandler
         bool HandleBotStopCommand(char * args);
         bool HandleBotStartCommand(char * args);
         bool HandleBotStatusCommand(char* args);
+        bool HandleBotProfileCommand(char* args);
         bool PartyBotAddRequirementCheck(Player const* pPlayer, Player const* pTarget);
         bool HandlePartyBotAddCommand(char * args);
         bool HandlePartyBotCloneCommand(char * args);
@@ -300,6 +301,7 @@ class ChatHandler
         bool HandleBattleBotRemoveAllCommand(char* args);
         bool HandleBattleBotShowPathCommand(char* args);
         bool HandleBattleBotShowAllPathsCommand(char* args);
+        bool HandleBattleBotShowGraphCommand(char* args);
 
         // spell_disabled
         bool HandleReloadSpellDisabledCommand(char *args);
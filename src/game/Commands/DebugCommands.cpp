@@ -45,6 +45,8 @@
  // MMAPS
 #include "MoveMap.h"                                        // for mmap manager
 #include "PathFinder.h"                                     // for mmap commands
+#include "PathCache.h"
+#include "GridPrefetcher.h"
 #include "GridNotifiers.h"
 #include "GridNotifiersImpl.h"
 #include "CellImpl.h"
@@ -2798,6 +2800,24 @@ bool ChatHandler::HandleMmapStatsCommand(char* /*args*/)
     MMAP::MMapManager *manager = MMAP::MMapFactory::createOrGetMMapManager();
     PSendSysMessage(" %u maps loaded with %u tiles overall", manager->getLoadedMapsCount(), manager->getLoadedTilesCount());
 
+    PathCache const& pathCache = m_session->GetPlayer()->GetMap()->GetPathCache();
+    uint64 lookups = pathCache.GetHits() + pathCache.GetMisses();
+    PSendSysMessage("Path cache on current map:");
+    PSendSysMessage(" %u paths, %u / %u KB", pathCache.GetEntryCount(), pathCache.GetUsedBytes() / 1024, pathCache.GetBudgetBytes() / 1024);
+    PSendSysMessage(" " UI64FMTD " hits, " UI64FMTD " misses (%.1f%%)", pathCache.GetHits(), pathCache.GetMisses(),
+        lookups ? 100.0f * pathCache.GetHits() / lookups : 0.0f);
+    PSendSysMessage(" " UI64FMTD " evicted, " UI64FMTD " invalidated", pathCache.GetEvictions(), pathCache.GetInvalidations());
+
+    if (GridPrefetcher const* prefetcher = m_session->GetPlayer()->GetMap()->GetGridPrefetcher())
+    {
+        uint64 const loads = prefetcher->GetHitCount() + prefetcher->GetLateCount() + prefetcher->GetMissCount();
+        PSendSysMessage("Grid prefetch on current map:");
+        PSendSysMessage(" " UI64FMTD " requested, %u pending, " UI64FMTD " expired", prefetcher->GetRequestedCount(), prefetcher->GetPendingCount(), prefetcher->GetExpiredCount());
+        PSendSysMessage(" " UI64FMTD " hits, " UI64FMTD " late, " UI64FMTD " misses (%.1f%% hit)", prefetcher->GetHitCount(), prefetcher->GetLateCount(), prefetcher->GetMissCount(),
+            loads ? 100.0f * prefetcher->GetHitCount() / loads : 0.0f);
+        PSendSysMessage(" " UI64FMTD " stalls, " UI64FMTD " ms on the map thread", prefetcher->GetStallCount(), prefetcher->GetStallTime());
+    }
+
     dtNavMesh const* navmesh = manager->GetNavMesh(m_session->GetPlayer()->GetMapId());
     if (GenericTransport* transport = m_session->GetPlayer()->GetTransport())
     {
@@ -2847,6 +2867,7 @@ bool ChatHandler::HandleMmapUnload(char* args)
 {
     PSendSysMessage("* Unload map %u", m_session->GetPlayer()->GetMapId());
     MMAP::MMapFactory::createOrGetMMapManager()->unloadMap(m_session->GetPlayer()->GetMapId());
+    m_session->GetPlayer()->GetMap()->GetPathCache().Clear();
     return true;
 }
 
@@ -2858,6 +2879,7 @@ bool ChatHandler::HandleMmapLoad(char* args)
     gy = 32 - pl->GetPositionY() / SIZE_OF_GRIDS;
     PSendSysMessage("* Load tile [%u:%u]", gx, gy);
     MMAP::MMapFactory::createOrGetMMapManager()->loadMap(pl->GetMapId(), gx, gy);
+    pl->GetMap()->GetPathCache().Clear();
     return true;
 }
 
@@ -38,6 +38,7 @@
 #include "LFGMgr.h"
 #include "LFGQueue.h"
 #include "UpdateMask.h"
+#include "BotEvents.h"
 
 #include <array>
 
@@ -773,6 +774,9 @@ void Group::SendLootStartRoll(uint32 CountDown, Roll const& r)
         if (itr.second == ROLL_NOT_VALID)
             continue;
 
+        if (p->GetSession()->PostBotEvent(BotEvent(BOT_EVENT_LOOT_ROLL_STARTED, r.lootedTargetGUID, r.itemSlot)))
+            continue;
+
         p->GetSession()->SendPacket(&data);
     }
 }
@@ -1057,6 +1061,9 @@ void Group::SendLootStartRollsForPlayer(Player* pPlayer)
             if (!countDown)
                 continue;
 
+            if (pPlayer->GetSession()->PostBotEvent(BotEvent(BOT_EVENT_LOOT_ROLL_STARTED, roll->lootedTargetGUID, roll->itemSlot)))
+                continue;
+
             WorldPacket data(SMSG_LOOT_START_ROLL, (8 + 4 + 4 + 4 + 4 + 4));
             data << roll->lootedTargetGUID;                   // creature guid what we're looting
             data << uint32(roll->itemSlot);                   // item slot in loot
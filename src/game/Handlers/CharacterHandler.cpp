@@ -132,6 +132,8 @@ public:
             delete holder;
             return;
         }
+        if (session->DeferLogin(holder))
+            return;
         session->HandlePlayerLogin((LoginQueryHolder*)holder);
     }
 } chrHandler;
@@ -424,6 +426,26 @@ void WorldSession::LoginPlayer(ObjectGuid loginPlayerGuid)
     CharacterDatabase.DelayQueryHolderUnsafe(&chrHandler, &CharacterHandler::HandlePlayerLoginCallback, holder);
 }
 
+bool WorldSession::DeferLogin(SqlQueryHolder* holder)
+{
+    if (!m_deferLogin || m_deferredLoginHolder)
+        return false;
+
+    m_deferredLoginHolder = holder;
+    return true;
+}
+
+void WorldSession::CompleteDeferredLogin()
+{
+    m_deferLogin = false;
+
+    if (SqlQueryHolder* holder = m_deferredLoginHolder)
+    {
+        m_deferredLoginHolder = nullptr;
+        HandlePlayerLogin(static_cast<LoginQueryHolder*>(holder));
+    }
+}
+
 void WorldSession::HandlePlayerLogin(LoginQueryHolder *holder)
 {
     // The following fixes a crash. Use case:
@@ -33,9 +33,13 @@
 #include "Map.h"
 #include "TradeData.h"
 #include "TransactionLog.h"
+#include "BotEvents.h"
 
 void WorldSession::SendTradeStatus(TradeStatus status)
 {
+    if (PostBotEvent(BotEvent(BOT_EVENT_TRADE_STATUS, ObjectGuid(), status)))
+        return;
+
     WorldPacket data;
 
     switch (status)
@@ -688,6 +692,9 @@ void WorldSession::HandleInitiateTradeOpcode(WorldPacket& recvPacket)
     _player->m_trade->SetScamPreventionDelay(200);
     pOther->m_trade->SetScamPreventionDelay(200);
 
+    if (pOther->GetSession()->PostBotEvent(BotEvent(BOT_EVENT_TRADE_STATUS, _player->GetObjectGuid(), TRADE_STATUS_BEGIN_TRADE)))
+        return;
+
     WorldPacket data(SMSG_TRADE_STATUS, 12);
     data << uint32(TRADE_STATUS_BEGIN_TRADE);
     data << ObjectGuid(_player->GetObjectGuid());
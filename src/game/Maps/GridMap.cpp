@@ -25,11 +25,13 @@
 #include "DBCStores.h"
 #include "GridMap.h"
 #include "VMapFactory.h"
+#include "MapTree.h"
 #include "MoveMap.h"
 #include "World.h"
 #include "Policies/SingletonImp.h"
 #include "Util.h"
 #include "SQLStorages.h"
+#include "IO/Filesystem/MappedFile.h"
 
 char const* MAP_MAGIC         = "MAPS";
 char const* MAP_VERSION_MAGIC = "z1.4";
@@ -131,12 +133,20 @@ bool GridMap::loadData(char const* filename)
 
 void GridMap::unloadData()
 {
-    delete[] m_area_map;
-    delete[] m_V9;
-    delete[] m_V8;
-    delete[] m_liquidEntry;
-    delete[] m_liquidFlags;
-    delete[] m_liquid_map;
+    if (m_mappedFile)
+    {
+        m_mappedCopies.clear();
+        m_mappedFile.reset();
+    }
+    else
+    {
+        delete[] m_area_map;
+        delete[] m_V9;
+        delete[] m_V8;
+        delete[] m_liquidEntry;
+        delete[] m_liquidFlags;
+        delete[] m_liquid_map;
+    }
 
     m_area_map = nullptr;
     m_V9 = nullptr;
@@ -147,6 +157,163 @@ void GridMap::unloadData()
     m_gridGetHeight = &GridMap::getHeightFromFlat;
 }
 
+bool GridMap::loadMappedData(char const* filename, bool preload)
+{
+    // Unload old data if exist
+    unloadData();
+
+    // Not return error if file not found
+    m_mappedFile = IO::Filesystem::TryMapFileReadonly(filename, preload ? IO::Filesystem::MappedFileAccess::Preload : IO::Filesystem::MappedFileAccess::OnDemand);
+    if (!m_mappedFile)
+        return true;
+
+    // Read in place, only the headers are copied
+    GridMapFileHeader header;
+    if (mapHeader(0, header) &&
+            header.mapMagic     == *((uint32 const*)(MAP_MAGIC)) &&
+            header.versionMagic == *((uint32 const*)(MAP_VERSION_MAGIC)))
+    {
+        char const* error = nullptr;
+        if (header.areaMapOffset && !mapAreaData(header.areaMapOffset))
+            error = "Error loading map area data\n";
+        else if (header.holesOffset && !mapHolesData(header.holesOffset))
+            error = "Error loading map holes data\n";
+        else if (header.heightMapOffset && !mapHeightData(header.heightMapOffset))
+            error = "Error loading map height data\n";
+        else if (header.liquidMapOffset && !mapGridMapLiquidData(header.liquidMapOffset))
+            error = "Error loading map liquids data\n";
+
+        if (!error)
+            return true;
+
+        sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "%s", error);
+        unloadData();
+        return false;
+    }
+
+    sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "Map file '%s' is non-compatible version (outdated?). Please, create new using ad.exe program.", filename);
+    unloadData();
+    return false;
+}
+
+template<typename T>
+bool GridMap::mapHeader(uint32 offset, T& header) const
+{
+    if (uint64(offset) + sizeof(T) > m_mappedFile->GetSize())
+        return false;
+
+    memcpy(&header, m_mappedFile->GetData() + offset, sizeof(T));
+    return true;
+}
+
+template<typename T>
+bool GridMap::mapArray(uint32 offset, uint32 count, T*& array)
+{
+    if (uint64(offset) + uint64(count) * sizeof(T) > m_mappedFile->GetSize())
+        return false;
+
+    // Never written once loaded, the pages are read only
+    uint8* data = const_cast<uint8*>(m_mappedFile->GetData()) + offset;
+    if (reinterpret_cast<uintptr_t>(data) % alignof(T))
+    {
+        // Not aligned in the file, can not be read in place
+        m_mappedCopies.emplace_back(new uint8[count * sizeof(T)]);
+        memcpy(m_mappedCopies.back().get(), data, count * sizeof(T));
+        data = m_mappedCopies.back().get();
+    }
+
+    array = reinterpret_cast<T*>(data);
+    return true;
+}
+
+bool GridMap::mapAreaData(uint32 offset)
+{
+    GridMapAreaHeader header;
+    if (!mapHeader(offset, header) || header.fourcc != *((uint32 const*)(MAP_AREA_MAGIC)))
+        return false;
+
+    m_gridArea = header.gridArea;
+    if (!(header.flags & MAP_AREA_NO_AREA))
+        return mapArray(offset + sizeof(header), 16 * 16, m_area_map);
+
+    return true;
+}
+
+bool GridMap::mapHeightData(uint32 offset)
+{
+    GridMapHeightHeader header;
+    if (!mapHeader(offset, header) || header.fourcc != *((uint32 const*)(MAP_HEIGHT_MAGIC)))
+        return false;
+
+    m_gridHeight = header.gridHeight;
+    offset += sizeof(header);
+    if (!(header.flags & MAP_HEIGHT_NO_HEIGHT))
+    {
+        if ((header.flags & MAP_HEIGHT_AS_INT16))
+        {
+            if (!mapArray(offset, 129 * 129, m_uint16_V9) ||
+                !mapArray(offset + 129 * 129 * sizeof(uint16), 128 * 128, m_uint16_V8))
+                return false;
+            m_gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 65535;
+            m_gridGetHeight = &GridMap::getHeightFromUint16;
+        }
+        else if ((header.flags & MAP_HEIGHT_AS_INT8))
+        {
+            if (!mapArray(offset, 129 * 129, m_uint8_V9) ||
+                !mapArray(offset + 129 * 129 * sizeof(uint8), 128 * 128, m_uint8_V8))
+                return false;
+            m_gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 255;
+            m_gridGetHeight = &GridMap::getHeightFromUint8;
+        }
+        else
+        {
+            if (!mapArray(offset, 129 * 129, m_V9) ||
+                !mapArray(offset + 129 * 129 * sizeof(float), 128 * 128, m_V8))
+                return false;
+            m_gridGetHeight = &GridMap::getHeightFromFloat;
+        }
+    }
+    else
+        m_gridGetHeight = &GridMap::getHeightFromFlat;
+
+    return true;
+}
+
+bool GridMap::mapHolesData(uint32 offset)
+{
+    // Small enough to keep in the object
+    return mapHeader(offset, m_holes);
+}
+
+bool GridMap::mapGridMapLiquidData(uint32 offset)
+{
+    GridMapLiquidHeader header;
+    if (!mapHeader(offset, header) || header.fourcc != *((uint32 const*)(MAP_LIQUID_MAGIC)))
+        return false;
+
+    m_liquidGlobalEntry = header.liquidType;
+    m_liquidGlobalFlags = header.liquidFlags;
+    m_liquid_offX   = header.offsetX;
+    m_liquid_offY   = header.offsetY;
+    m_liquid_width  = header.width;
+    m_liquid_height = header.height;
+    m_liquidLevel   = header.liquidLevel;
+
+    offset += sizeof(header);
+    if (!(header.flags & MAP_LIQUID_NO_TYPE))
+    {
+        if (!mapArray(offset, 16 * 16, m_liquidEntry) ||
+            !mapArray(offset + 16 * 16 * sizeof(uint16), 16 * 16, m_liquidFlags))
+            return false;
+        offset += 16 * 16 * (sizeof(uint16) + sizeof(uint8));
+    }
+
+    if (!(header.flags & MAP_LIQUID_NO_HEIGHT))
+        return mapArray(offset, m_liquid_width * m_liquid_height, m_liquid_map);
+
+    return true;
+}
+
 bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
 {
     GridMapAreaHeader header;
@@ -684,6 +851,10 @@ bool GridMap::ExistVMap(uint32 mapid, int gx, int gy)
     return true;
 }
 
+//////////////////////////////////////////////////////////////////////////
+TerrainGridFiles::TerrainGridFiles() = default;
+TerrainGridFiles::~TerrainGridFiles() = default;
+
 //////////////////////////////////////////////////////////////////////////
 TerrainInfo::TerrainInfo(uint32 mapid) : m_mapId(mapid)
 {
@@ -707,9 +878,10 @@ TerrainInfo::TerrainInfo(uint32 mapid) : m_mapId(mapid)
 
 void TerrainInfo::LoadAll()
 {
+    // Mapped terrain files are read in as grids get used
     for (int k = 0; k < MAX_NUMBER_OF_GRIDS; ++k)
         for (int i = 0; i < MAX_NUMBER_OF_GRIDS; ++i)
-            Load(i, k);
+            Load(i, k, false);
 }
 
 TerrainInfo::~TerrainInfo()
@@ -722,7 +894,7 @@ TerrainInfo::~TerrainInfo()
     MMAP::MMapFactory::createOrGetMMapManager()->unloadMap(m_mapId);
 }
 
-GridMap* TerrainInfo::Load(uint32 const x, uint32 const y)
+GridMap* TerrainInfo::Load(uint32 const x, uint32 const y, bool preload, TerrainGridFiles* files)
 {
     MANGOS_ASSERT(x < MAX_NUMBER_OF_GRIDS);
     MANGOS_ASSERT(y < MAX_NUMBER_OF_GRIDS);
@@ -733,11 +905,25 @@ GridMap* TerrainInfo::Load(uint32 const x, uint32 const y)
     // quick check if GridMap already loaded
     GridMap* pMap = m_GridMaps[x][y];
     if (!pMap)
-        pMap = LoadMapAndVMap(x, y);
+        pMap = LoadMapAndVMap(x, y, preload, files);
 
     return pMap;
 }
 
+void TerrainInfo::Read(uint32 const x, uint32 const y, bool preload, TerrainGridFiles& files) const
+{
+    MANGOS_ASSERT(x < MAX_NUMBER_OF_GRIDS);
+    MANGOS_ASSERT(y < MAX_NUMBER_OF_GRIDS);
+
+    files.gridMap.reset(ReadGridMap(x, y, preload));
+
+    files.vmapTile.reset(new VMAP::StaticMapTile());
+    VMAP::VMapFactory::createOrGetVMapManager()->readMapTile((sWorld.GetDataPath() + "vmaps").c_str(), m_mapId, x, y, *files.vmapTile);
+
+    files.mmapTile.reset(new MMAP::MMapTileData());
+    MMAP::MMapFactory::createOrGetMMapManager()->readTile(m_mapId, x, y, *files.mmapTile);
+}
+
 // schedule lazy GridMap object cleanup
 void TerrainInfo::Unload(uint32 const x, uint32 const y)
 {
@@ -761,6 +947,9 @@ void TerrainInfo::CleanUpGrids(uint32 const diff)
     if (!i_timer.Passed())
         return;
 
+    // Grid prefetch workers may be loading meanwhile
+    LOCK_GUARD lock(m_mutex);
+
     for (int y = 0; y < MAX_NUMBER_OF_GRIDS; ++y)
     {
         for (int x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
@@ -1137,12 +1326,12 @@ GridMap* TerrainInfo::GetGrid(float const x, float const y)
     // quick check if GridMap already loaded
     GridMap* pMap = m_GridMaps[gx][gy];
     if (!pMap)
-        pMap = LoadMapAndVMap(gx, gy);
+        pMap = LoadMapAndVMap(gx, gy, true);
 
     return pMap;
 }
 
-GridMap* TerrainInfo::LoadMapAndVMap(uint32 const x, uint32 const y)
+GridMap* TerrainInfo::LoadMapAndVMap(uint32 const x, uint32 const y, bool preload, TerrainGridFiles* files)
 {
     // double checked lock pattern
     if (!m_GridMaps[x][y])
@@ -1151,27 +1340,13 @@ GridMap* TerrainInfo::LoadMapAndVMap(uint32 const x, uint32 const y)
 
         if (!m_GridMaps[x][y])
         {
-            GridMap* map = new GridMap();
-
-            // map file name
-            int len = sWorld.GetDataPath().length() + strlen("maps/%03u%02u%02u.map") + 1;
-            char* tmp = new char[len];
-            snprintf(tmp, len, (char*)(sWorld.GetDataPath() + "maps/%03u%02u%02u.map").c_str(), m_mapId, y, x);
-
-            if (!map->loadData(tmp))
-            {
-                sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "Error load map file: \n %s\n", tmp);
-                // ASSERT(false);
-            }
-
-            delete[] tmp;
-            m_GridMaps[x][y] = map;
+            GridMap* map = files && files->gridMap ? files->gridMap.release() : ReadGridMap(x, y, preload);
 
             // load VMAPs for current map/grid...
             MapEntry const* mapEntry = sMapStorage.LookupEntry<MapEntry>(m_mapId);
             char const* mapName = mapEntry ? mapEntry->name : "UNNAMEDMAP\x0";
 
-            int vmapLoadResult = VMAP::VMapFactory::createOrGetVMapManager()->loadMap((sWorld.GetDataPath() + "vmaps").c_str(),  m_mapId, x, y);
+            int vmapLoadResult = VMAP::VMapFactory::createOrGetVMapManager()->loadMap((sWorld.GetDataPath() + "vmaps").c_str(),  m_mapId, x, y, files ? files->vmapTile.get() : nullptr);
             switch (vmapLoadResult)
             {
                 case VMAP::VMAP_LOAD_RESULT_OK:
@@ -1185,13 +1360,37 @@ GridMap* TerrainInfo::LoadMapAndVMap(uint32 const x, uint32 const y)
             }
 
             // load navmesh
-            MMAP::MMapFactory::createOrGetMMapManager()->loadMap(m_mapId, x, y);
+            MMAP::MMapFactory::createOrGetMMapManager()->loadMap(m_mapId, x, y, files ? files->mmapTile.get() : nullptr);
+
+            // Published last: readers skipping the lock above must find the vmap and mmap tiles in
+            std::atomic_thread_fence(std::memory_order_release);
+            m_GridMaps[x][y] = map;
         }
     }
 
     return  m_GridMaps[x][y];
 }
 
+GridMap* TerrainInfo::ReadGridMap(uint32 const x, uint32 const y, bool preload) const
+{
+    GridMap* map = new GridMap();
+
+    // map file name
+    int len = sWorld.GetDataPath().length() + strlen("maps/%03u%02u%02u.map") + 1;
+    char* tmp = new char[len];
+    snprintf(tmp, len, (char*)(sWorld.GetDataPath() + "maps/%03u%02u%02u.map").c_str(), m_mapId, y, x);
+
+    bool const loaded = sWorld.getConfig(CONFIG_BOOL_TERRAIN_MEMORY_MAPPED) ? map->loadMappedData(tmp, preload) : map->loadData(tmp);
+    if (!loaded)
+    {
+        sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "Error load map file: \n %s\n", tmp);
+        // ASSERT(false);
+    }
+
+    delete[] tmp;
+    return map;
+}
+
 float TerrainInfo::GetWaterLevel(float x, float y, float z, float* pGround /*= nullptr*/) const
 {
     if (const_cast<TerrainInfo*>(this)->GetGrid(x, y))
@@ -30,6 +30,7 @@
 #include <bitset>
 #include <list>
 #include <atomic>
+#include <vector>
 
 
 #define MAX_HEIGHT            100000.0f                     // can be use for find ground height at surface
@@ -48,6 +49,18 @@ class BattleGround;
 class Map;
 struct LiquidTypeEntry;
 
+namespace IO { namespace Filesystem {
+    class MappedFileReadonly;
+}}
+
+namespace VMAP {
+    struct StaticMapTile;
+}
+
+namespace MMAP {
+    struct MMapTileData;
+}
+
 class GridMap
 {
     private:
@@ -87,10 +100,24 @@ class GridMap
         uint8* m_liquidFlags = nullptr;
         float* m_liquid_map = nullptr;
 
+        // Set when loaded with loadMappedData: the arrays above point into the
+        // mapped file, except those not aligned in it, copied to m_mappedCopies
+        std::unique_ptr<IO::Filesystem::MappedFileReadonly> m_mappedFile;
+        std::vector<std::unique_ptr<uint8[]>> m_mappedCopies;
+
         bool loadAreaData(FILE* in, uint32 offset, uint32 size);
         bool loadHeightData(FILE* in, uint32 offset, uint32 size);
         bool loadGridMapLiquidData(FILE* in, uint32 offset, uint32 size);
         bool loadHolesData(FILE* in, uint32 offset, uint32 size);
+
+        bool mapAreaData(uint32 offset);
+        bool mapHeightData(uint32 offset);
+        bool mapGridMapLiquidData(uint32 offset);
+        bool mapHolesData(uint32 offset);
+        template<typename T>
+        bool mapHeader(uint32 offset, T& header) const;
+        template<typename T>
+        bool mapArray(uint32 offset, uint32 count, T*& array);
         bool isHole(int row, int col) const;
 
         // Get height functions and pointers
@@ -107,6 +134,9 @@ class GridMap
         ~GridMap();
 
         bool loadData(char const* filaname);
+        // Same data, the file being mapped read only instead of read into memory.
+        // preload reads it in at once, else pages are read on first use.
+        bool loadMappedData(char const* filename, bool preload);
         void unloadData();
 
         static bool ExistMap(uint32 mapid, int gx, int gy);
@@ -136,6 +166,19 @@ class Referencable
         Countable m_count;
 };
 
+// Terrain files of a grid read off the map thread, see TerrainInfo::Read()
+struct TerrainGridFiles
+{
+    TerrainGridFiles();
+    ~TerrainGridFiles();                    // frees what was not loaded
+    TerrainGridFiles(TerrainGridFiles const&) = delete;
+    TerrainGridFiles& operator=(TerrainGridFiles const&) = delete;
+
+    std::unique_ptr<GridMap> gridMap;
+    std::unique_ptr<VMAP::StaticMapTile> vmapTile;
+    std::unique_ptr<MMAP::MMapTileData> mmapTile;
+};
+
 using AtomicLong = std::atomic<long>;
 
 // class for sharing and managin GridMap objects
@@ -174,21 +217,29 @@ class TerrainInfo : public Referencable<AtomicLong>
         // this method should be used only by TerrainManager
         // to cleanup unreferenced GridMap objects - they are too heavy
         // to destroy them dynamically, especially on highly populated servers
-        // THIS METHOD IS NOT THREAD-SAFE!!!! AND IT SHOULDN'T BE THREAD-SAFE!!!!
+        // Called from the world thread only, locked against map threads loading grids
         void CleanUpGrids(uint32 const diff);
 
     protected:
         friend class Map;
+        friend class GridPrefetcher;               // holds loads ahead of the map
         // load/unload terrain data
-        GridMap* Load(uint32 const x, uint32 const y);
+        // preload: read mapped terrain files in at once (see GridMap::loadMappedData)
+        // files: read ahead by Read(), dropped if the grid is loaded already
+        GridMap* Load(uint32 const x, uint32 const y, bool preload = true, TerrainGridFiles* files = nullptr);
         void Unload(uint32 const x, uint32 const y);
 
+        // Any thread: reads the terrain files of grid (x, y) for a later Load().
+        // Nothing loaded is touched, vmap trees and navmeshes are only updated by Load()
+        void Read(uint32 const x, uint32 const y, bool preload, TerrainGridFiles& files) const;
+
     private:
         TerrainInfo(TerrainInfo const&);
         TerrainInfo& operator=(TerrainInfo const&);
 
         GridMap* GetGrid(float const x, float const y);
-        GridMap* LoadMapAndVMap(uint32 const x, uint32 const y);
+        GridMap* LoadMapAndVMap(uint32 const x, uint32 const y, bool preload, TerrainGridFiles* files = nullptr);
+        GridMap* ReadGridMap(uint32 const x, uint32 const y, bool preload) const;
 
         int RefGrid(uint32 const& x, uint32 const& y);
         int UnrefGrid(uint32 const& x, uint32 const& y);
@@ -0,0 +1,231 @@
+/*
+* This program is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation; either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program; if not, write to the Free Software
+* Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#include "GridPrefetcher.h"
+#include "GridMap.h"
+#include "ThreadPool.h"
+#include "Timer.h"
+
+GridPrefetcher::GridPrefetcher(uint32 numThreads, TerrainInfo* terrain) : m_terrain(terrain)
+{
+    m_workers.reset(new ThreadPool("GridLoad", numThreads));
+    m_workers->start();
+}
+
+GridPrefetcher::~GridPrefetcher()
+{
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_queued.clear();
+    }
+
+    // Workers take the lock once read, files not attached are freed with their entry
+    if (m_batch.valid())
+        m_batch.wait();
+
+    for (auto const& itr : m_grids)
+        if (itr.second.state == State::READY)
+            m_terrain->Unload(itr.first >> 16, itr.first & 0xFFFF);
+}
+
+void GridPrefetcher::Request(uint32 x, uint32 y)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    if (m_grids.find(MakeId(x, y)) != m_grids.end())
+        return;
+
+    m_grids[MakeId(x, y)] = { State::QUEUED, false, 0, nullptr };
+    m_queued.push_back(MakeId(x, y));
+    ++m_requested;
+}
+
+void GridPrefetcher::OnGridLoaded(uint32 x, uint32 y, uint32 stallMs)
+{
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        if (stallMs)
+        {
+            ++m_stalls;
+            m_stallTime += stallMs;
+        }
+
+        auto itr = m_grids.find(MakeId(x, y));
+        if (itr == m_grids.end())
+        {
+            ++m_misses;
+            return;
+        }
+
+        switch (itr->second.state)
+        {
+            case State::QUEUED:
+                // Loaded by the map itself, nothing to dispatch any more
+                ++m_late;
+                m_grids.erase(itr);
+                return;
+            case State::READING:
+                // The worker drops its files once done
+                ++m_late;
+                itr->second.used = true;
+                return;
+            case State::READ:
+                // Loaded by the map before Attach(), the files are of no use
+                ++m_late;
+                m_grids.erase(itr);
+                return;
+            case State::READY:
+                ++m_hits;
+                m_grids.erase(itr);
+                break;
+        }
+    }
+
+    // The map holds its own reference now
+    m_terrain->Unload(x, y);
+}
+
+void GridPrefetcher::Attach()
+{
+    std::vector<std::pair<uint32, std::unique_ptr<TerrainGridFiles>>> read;
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        for (auto& itr : m_grids)
+        {
+            if (itr.second.state != State::READ)
+                continue;
+
+            itr.second.state = State::READY;
+            itr.second.readyTime = WorldTimer::getMSTime();
+            read.emplace_back(itr.first, std::move(itr.second.files));
+        }
+    }
+
+    // Referenced until used or expired. Dropped if another map of the terrain loaded it meanwhile
+    for (auto& itr : read)
+        m_terrain->Load(itr.first >> 16, itr.first & 0xFFFF, true, itr.second.get());
+}
+
+void GridPrefetcher::Dispatch()
+{
+    std::vector<uint32> expired;
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        for (auto itr = m_grids.begin(); itr != m_grids.end();)
+        {
+            if (itr->second.state == State::READY && WorldTimer::getMSTimeDiffToNow(itr->second.readyTime) > PREFETCH_EXPIRY_MS)
+            {
+                expired.push_back(itr->first);
+                itr = m_grids.erase(itr);
+                ++m_expired;
+            }
+            else
+                ++itr;
+        }
+
+        // Previous batch still loading, keep the queue for the next tick
+        if (!m_queued.empty() && m_workers->status() == ThreadPool::Status::READY &&
+            (!m_batch.valid() || m_batch.wait_for(std::chrono::seconds(0)) == std::future_status::ready))
+        {
+            for (uint32 gridId : m_queued)
+            {
+                auto itr = m_grids.find(gridId);
+                if (itr == m_grids.end() || itr->second.state != State::QUEUED)
+                    continue;
+
+                itr->second.state = State::READING;
+                *m_workers << [this, gridId]() { Read(gridId); };
+            }
+            m_queued.clear();
+            m_batch = m_workers->processWorkload();
+        }
+    }
+
+    for (uint32 gridId : expired)
+        m_terrain->Unload(gridId >> 16, gridId & 0xFFFF);
+}
+
+void GridPrefetcher::Read(uint32 gridId)
+{
+    // Files only, nothing the map threads query is touched before Attach()
+    std::unique_ptr<TerrainGridFiles> files(new TerrainGridFiles());
+    m_terrain->Read(gridId >> 16, gridId & 0xFFFF, true, *files);
+
+    std::lock_guard<std::mutex> guard(m_lock);
+    auto itr = m_grids.find(gridId);
+    if (itr == m_grids.end())
+        return;
+
+    if (itr->second.used)
+    {
+        m_grids.erase(itr);
+        return;
+    }
+
+    itr->second.state = State::READ;
+    itr->second.files = std::move(files);
+}
+
+uint64 GridPrefetcher::GetRequestedCount() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_requested;
+}
+
+uint64 GridPrefetcher::GetHitCount() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_hits;
+}
+
+uint64 GridPrefetcher::GetLateCount() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_late;
+}
+
+uint64 GridPrefetcher::GetMissCount() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_misses;
+}
+
+uint64 GridPrefetcher::GetExpiredCount() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_expired;
+}
+
+uint64 GridPrefetcher::GetStallCount() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_stalls;
+}
+
+uint64 GridPrefetcher::GetStallTime() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_stallTime;
+}
+
+uint32 GridPrefetcher::GetPendingCount() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    uint32 count = 0;
+    for (auto const& itr : m_grids)
+        if (itr.second.state != State::READY)
+            ++count;
+    return count;
+}
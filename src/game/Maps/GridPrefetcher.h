@@ -0,0 +1,122 @@
+/*
+* This program is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation; either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program; if not, write to the Free Software
+* Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#ifndef MANGOS_GRID_PREFETCHER_H
+#define MANGOS_GRID_PREFETCHER_H
+
+#include "Common.h"
+
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+class TerrainInfo;
+class ThreadPool;
+struct TerrainGridFiles;
+
+/**
+ * Background reading of the terrain of grids a map is about to need.
+ *
+ * Creating a grid loads its .map file, vmap and mmap tiles on the map
+ * thread. The map predicts the grids its players are heading to and
+ * requests them here: worker threads only read their files, through
+ * TerrainInfo::Read(). The vmap trees and navmeshes are queried without
+ * locks, so the map thread loads what was read at the start of its next
+ * tick, in Attach(), while no path worker runs. The reference taken by
+ * that load keeps the terrain until the map creates the grid, which then
+ * only takes its own reference on data already in memory. Loads the map
+ * did not use within PREFETCH_EXPIRY_MS are released again.
+ *
+ * Grid coordinates are terrain ones, as given to TerrainInfo::Load().
+ *
+ * Requests made during a tick are dispatched at the end of it, while the
+ * previous batch still runs they wait for the next tick.
+ */
+class GridPrefetcher
+{
+    public:
+        GridPrefetcher(uint32 numThreads, TerrainInfo* terrain);
+        ~GridPrefetcher();
+
+        // Map thread: load the terrain of grid (x, y) ahead of its creation
+        void Request(uint32 x, uint32 y);
+
+        // Map thread: the map loaded the terrain of grid (x, y), which took
+        // stallMs on the map thread
+        void OnGridLoaded(uint32 x, uint32 y, uint32 stallMs);
+
+        // Map thread, start of tick with no path worker running: load what
+        // the workers read
+        void Attach();
+
+        // Map thread, end of tick: release expired loads, start the requested ones
+        void Dispatch();
+
+        // Stats
+        uint64 GetRequestedCount() const;
+        uint64 GetHitCount() const;         // loaded before the map needed it
+        uint64 GetLateCount() const;        // requested, not loaded yet
+        uint64 GetMissCount() const;        // not predicted
+        uint64 GetExpiredCount() const;     // loaded, not used in time
+        uint64 GetStallCount() const;       // loads that blocked the map thread
+        uint64 GetStallTime() const;        // ms
+        uint32 GetPendingCount() const;
+
+    private:
+        enum class State : uint8
+        {
+            QUEUED,
+            READING,
+            READ,       // files waiting for Attach()
+            READY,      // terrain referenced until used or expired
+        };
+
+        struct Entry
+        {
+            State state;
+            bool used;              // the map loaded it while it was read
+            uint32 readyTime;
+            std::unique_ptr<TerrainGridFiles> files;
+        };
+
+        void Read(uint32 gridId);
+
+        static uint32 MakeId(uint32 x, uint32 y) { return (x << 16) | y; }
+
+        TerrainInfo* m_terrain;
+
+        mutable std::mutex m_lock;
+        std::unordered_map<uint32 /*grid id*/, Entry> m_grids;
+        std::vector<uint32> m_queued;
+        std::future<void> m_batch;
+
+        std::unique_ptr<ThreadPool> m_workers;
+
+        uint64 m_requested = 0;
+        uint64 m_hits = 0;
+        uint64 m_late = 0;
+        uint64 m_misses = 0;
+        uint64 m_expired = 0;
+        uint64 m_stalls = 0;
+        uint64 m_stallTime = 0;
+
+        // Covers a prediction made the full look ahead before the grid is entered
+        static constexpr uint32 PREFETCH_EXPIRY_MS = 120000;
+};
+
+#endif
@@ -51,7 +51,13 @@
 #include "MovementBroadcaster.h"
 #include "PlayerBroadcaster.h"
 #include "GridSearchers.h"
-#include "ThreadPool.h"
+#include "TaskScheduler.h"
+#include "PathRequestService.h"
+#include "PathCache.h"
+#include "GridPrefetcher.h"
+#include "MoveSpline.h"
+#include "BotGrindTargetCache.h"
+#include "BotGroupStateCache.h"
 #include "AuraRemovalMgr.h"
 #include "world/world_event_wareffort.h"
 #include "CreatureGroups.h"
@@ -59,8 +65,13 @@
 
 Map::~Map()
 {
+    m_pathRequests->WaitForCompletion();
+
     UnloadAll(true);
 
+    // Holds terrain references until then
+    m_gridPrefetcher.reset();
+
     if (!m_scriptSchedule.empty())
         sScriptMgr.DecreaseScheduledScriptCount(m_scriptSchedule.size());
 
@@ -114,9 +125,15 @@ void Map::LoadMapAndVMap(int gx, int gy)
     if (m_bLoadedGrids[gx][gy])
         return;
 
+    uint32 const loadStart = WorldTimer::getMSTime();
     GridMap * pInfo = m_terrainData->Load(gx, gy);
+    if (m_gridPrefetcher)
+        m_gridPrefetcher->OnGridLoaded(gx, gy, WorldTimer::getMSTimeDiffToNow(loadStart));
     if (pInfo)
+    {
         m_bLoadedGrids[gx][gy] = true;
+        m_pathCache->InvalidateGrid(gx, gy);   // navmesh tile came with it
+    }
 }
 
 Map::Map(uint32 id, time_t expiry, uint32 InstanceId)
@@ -155,21 +172,20 @@ Map::Map(uint32 id, time_t expiry, uint32 InstanceId)
     m_persistentState = sMapPersistentStateMgr.AddPersistentState(m_mapEntry, GetInstanceId(), 0, IsDungeon());
     m_persistentState->SetUsedByMapState(this);
     m_weatherSystem = new WeatherSystem(this);
+    m_pathCache.reset(new PathCache(sWorld.getConfig(CONFIG_UINT32_PATHFINDING_CACHE_SIZE_KB) * 1024));
+    m_pathRequests.reset(new PathRequestService(IsContinent() ? sWorld.getConfig(CONFIG_UINT32_CONTINENTS_PATHFINDING_THREADS) : 1, m_pathCache.get()));
+    m_botGrindTargets.reset(new BotGrindTargetCache());
+    m_botGroupStates.reset(new BotGroupStateCache());
 
     if (IsContinent())
     {
-        int numObjThreads = (int)sWorld.getConfig(CONFIG_UINT32_MAP_OBJECTSUPDATE_THREADS);
-        if (numObjThreads > 1)
-        {
-            m_objectThreads.reset(new ThreadPool("MapObj", numObjThreads -1));
-            m_objectThreads->start<ThreadPool::MySQL<ThreadPool::MultiQueue>>();
-        }
-        m_motionThreads.reset(new ThreadPool("MapMotion", sWorld.getConfig(CONFIG_UINT32_CONTINENTS_MOTIONUPDATE_THREADS)));
-        m_visibilityThreads.reset(new ThreadPool("MapVis", std::max((int)sWorld.getConfig(CONFIG_UINT32_MAP_VISIBILITYUPDATE_THREADS) -1,0)));
-        m_cellThreads.reset(new ThreadPool("MapCell", std::max((int)sWorld.getConfig(CONFIG_UINT32_MTCELLS_THREADS) - 1, 0)));
-        m_visibilityThreads->start<ThreadPool::MySQL<ThreadPool::MultiQueue>>();
-        m_cellThreads->start();
-        m_motionThreads->start();
+        m_objectUpdateTasks = std::max((int)sWorld.getConfig(CONFIG_UINT32_MAP_OBJECTSUPDATE_THREADS) - 1, 0);
+        m_visibilityUpdateTasks = std::max((int)sWorld.getConfig(CONFIG_UINT32_MAP_VISIBILITYUPDATE_THREADS) - 1, 0);
+        m_cellUpdateTasks = std::max((int)sWorld.getConfig(CONFIG_UINT32_MTCELLS_THREADS) - 1, 0);
+        m_playerUpdateTasks = std::max((int)sWorld.getConfig(CONFIG_UINT32_MTPLAYERS_THREADS) - 1, 0);
+        m_asyncMotionUpdate = sWorld.getConfig(CONFIG_UINT32_CONTINENTS_MOTIONUPDATE_THREADS) > 0;
+        if (uint32 prefetchThreads = sWorld.getConfig(CONFIG_UINT32_CONTINENTS_GRIDPREFETCH_THREADS))
+            m_gridPrefetcher.reset(new GridPrefetcher(prefetchThreads, m_terrainData));
     }
 
     sTransportMgr.SpawnTransportsOnMap(this);
@@ -315,6 +331,7 @@ void Map::DeleteFromWorld(Player* player)
 void
 Map::EnsureGridCreated(GridPair const& p)
 {
+    std::lock_guard<std::recursive_mutex> guard(m_gridLoadLock);
     if (!getNGrid(p.x_coord, p.y_coord))
     {
         setNGrid(new NGridType(p.x_coord * MAX_NUMBER_OF_GRIDS + p.y_coord, p.x_coord, p.y_coord, m_gridExpiry, sWorld.getConfig(CONFIG_BOOL_GRID_UNLOAD)),
@@ -339,6 +356,7 @@ Map::EnsureGridCreated(GridPair const& p)
 void
 Map::EnsureGridLoadedAtEnter(Cell const& cell, Player* player)
 {
+    std::lock_guard<std::recursive_mutex> guard(m_gridLoadLock);
     NGridType* grid;
 
     if (EnsureGridLoaded(cell))
@@ -362,6 +380,7 @@ Map::EnsureGridLoadedAtEnter(Cell const& cell, Player* player)
 
 bool Map::EnsureGridLoaded(Cell const& cell)
 {
+    std::lock_guard<std::recursive_mutex> guard(m_gridLoadLock);
     EnsureGridCreated(GridPair(cell.GridX(), cell.GridY()));
     NGridType* grid = getNGrid(cell.GridX(), cell.GridY());
 
@@ -750,7 +769,11 @@ inline void Map::MarkCellsAroundObject(WorldObject const* object)
         for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
         {
             uint32 cell_id = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
+            if (isCellMarked(cell_id))
+                continue;
+
             markCell(cell_id);
+            m_activeCellStripes[y / m_activeCellStripeHeight].push_back(cell_id);
         }
     }
 }
@@ -762,20 +785,13 @@ inline void Map::UpdateActiveCellsCallback(uint32 diff, uint32 now, uint32 threa
     TypeContainerVisitor<MaNGOS::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
     TypeContainerVisitor<MaNGOS::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
 
-    int safeDistCells = sWorld.getConfig(CONFIG_UINT32_MTCELLS_SAFEDISTANCE) / SIZE_OF_GRID_CELL + 1;
     totalThreads *= 2;
     threadId = 2 * threadId + step;
-    for (int y = 0; y < TOTAL_NUMBER_OF_CELLS_PER_MAP; ++y)
+    for (uint32 stripe = threadId; stripe < m_activeCellStripes.size(); stripe += totalThreads)
     {
-        // Skip grids not for this thread
-        if ((y / safeDistCells) % totalThreads != threadId)
-            continue;
-        for (int x = 0; x < TOTAL_NUMBER_OF_CELLS_PER_MAP; ++x)
+        for (uint32 cellId : m_activeCellStripes[stripe])
         {
-            uint32 cellId = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
-            if (!isCellMarked(cellId))
-                continue;
-            CellPair pair(x, y);
+            CellPair pair(cellId % TOTAL_NUMBER_OF_CELLS_PER_MAP, cellId / TOTAL_NUMBER_OF_CELLS_PER_MAP);
             Cell cell(pair);
             cell.SetNoCreate();
             Visit(cell, grid_object_update);
@@ -786,7 +802,20 @@ inline void Map::UpdateActiveCellsCallback(uint32 diff, uint32 now, uint32 threa
 
 inline void Map::UpdateActiveCellsAsynch(uint32 now, uint32 diff)
 {
-    resetMarkedCells();
+    // A stripe is higher than the safe distance, so cells updated at the same
+    // time are always at least one stripe apart
+    uint32 const stripeHeight = sWorld.getConfig(CONFIG_UINT32_MTCELLS_SAFEDISTANCE) / SIZE_OF_GRID_CELL + 1;
+    if (stripeHeight != m_activeCellStripeHeight)
+    {
+        m_activeCellStripeHeight = stripeHeight;
+        m_activeCellStripes.assign((TOTAL_NUMBER_OF_CELLS_PER_MAP + stripeHeight - 1) / stripeHeight, std::vector<uint32>());
+    }
+
+    if (m_markedCellsDirty)
+    {
+        resetMarkedCells();
+        m_markedCellsDirty = false;
+    }
 
     // Mark all cells that need update
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
@@ -795,23 +824,34 @@ inline void Map::UpdateActiveCellsAsynch(uint32 now, uint32 diff)
     for (m_activeNonPlayersIter = m_activeNonPlayers.begin(); m_activeNonPlayersIter != m_activeNonPlayers.end(); ++m_activeNonPlayersIter)
         MarkCellsAroundObject(*m_activeNonPlayersIter);
 
-    const int nthreads = m_cellThreads->size();
+    // Row by row, as the cells were updated when the whole map was scanned
+    for (std::vector<uint32>& stripe : m_activeCellStripes)
+        std::sort(stripe.begin(), stripe.end());
+
+    const int nthreads = m_cellUpdateTasks;
     for (int step = 0; step < 2; step++)
     {
+        TaskGroup cells;
         for (int i = 0; i < nthreads; ++i)
-            m_cellThreads << [this, diff, now, i, nthreads, step](){
+            cells.Run([this, diff, now, i, nthreads, step](){
                 UpdateActiveCellsCallback(diff, now, i, nthreads+1, step);
-            };
-        std::future<void> job = m_cellThreads->processWorkload();
+            });
         UpdateActiveCellsCallback(diff, now, nthreads, nthreads+1, step);
-        if (job.valid())
-            job.wait();
+        cells.Wait();
+    }
+
+    for (std::vector<uint32>& stripe : m_activeCellStripes)
+    {
+        for (uint32 cellId : stripe)
+            marked_cells.reset(cellId);
+        stripe.clear();
     }
 }
 
 inline void Map::UpdateActiveCellsSynch(uint32 now, uint32 diff)
 {
     resetMarkedCells();
+    m_markedCellsDirty = true;
     // the player iterator is stored in the map object
     // to make sure calls to Map::Remove don't invalidate it
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
@@ -846,19 +886,20 @@ inline void Map::UpdateCells(uint32 map_diff)
     m_currentTime = std::chrono::time_point_cast<std::chrono::milliseconds>(Clock::now());
 
     // update active cells around players and active objects
-    if (IsContinent() && m_cellThreads->status() == ThreadPool::Status::READY)
+    if (m_cellUpdateTasks)
         UpdateActiveCellsAsynch(now, diff);
     else
         UpdateActiveCellsSynch(now, diff);
 
-    if (IsContinent() && m_motionThreads->status() == ThreadPool::Status::READY && !m_unitsMvtUpdate.empty())
+    if (m_asyncMotionUpdate && !m_unitsMvtUpdate.empty())
     {
+        TaskGroup motions;
         for (std::unordered_set<Unit*>::iterator it = m_unitsMvtUpdate.begin(); it != m_unitsMvtUpdate.end(); it++)
-            m_motionThreads << [it,diff](){
+            motions.Run([it,diff](){
                  if ((*it)->IsInWorld())
                     (*it)->GetMotionMaster()->UpdateMotionAsync(diff);
-            };
-        m_motionThreads->processWorkload().wait();
+            });
+        motions.Wait();
     }
     m_unitsMvtUpdate.clear();
 }
@@ -902,6 +943,77 @@ void Map::UpdateSessionsMovementAndSpellsIfNeeded()
     m_lastMvtSpellsUpdate = WorldTimer::getMSTime();
 }
 
+void Map::PrefetchGridsAhead(uint32 diff)
+{
+    if (!m_gridPrefetcher)
+        return;
+
+    if (m_gridPrefetchTimer > diff)
+    {
+        m_gridPrefetchTimer -= diff;
+        m_gridPrefetcher->Dispatch();
+        return;
+    }
+    m_gridPrefetchTimer = 1000;
+
+    // Grids the activation area will touch there, as in EnsureGridCreated
+    auto requestAround = [this](float x, float y)
+    {
+        if (!MaNGOS::IsValidMapCoord(x, y))
+            return;
+
+        CellArea const area = Cell::CalculateCellArea(x, y, GetGridActivationDistance());
+        for (uint32 gridX = area.low_bound.x_coord / MAX_NUMBER_OF_CELLS; gridX <= area.high_bound.x_coord / MAX_NUMBER_OF_CELLS; ++gridX)
+        {
+            for (uint32 gridY = area.low_bound.y_coord / MAX_NUMBER_OF_CELLS; gridY <= area.high_bound.y_coord / MAX_NUMBER_OF_CELLS; ++gridY)
+            {
+                uint32 const gx = (MAX_NUMBER_OF_GRIDS - 1) - gridX;
+                uint32 const gy = (MAX_NUMBER_OF_GRIDS - 1) - gridY;
+                if (gx < MAX_NUMBER_OF_GRIDS && gy < MAX_NUMBER_OF_GRIDS && !m_bLoadedGrids[gx][gy])
+                    m_gridPrefetcher->Request(gx, gy);
+            }
+        }
+    };
+
+    int32 const lookAhead = sWorld.getConfig(CONFIG_UINT32_CONTINENTS_GRIDPREFETCH_LOOKAHEAD);
+    for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
+    {
+        Player* plr = m_mapRefIter->getSource();
+        if (!plr || !plr->IsInWorld() || plr->GetTransport())
+            continue;
+
+        if (plr->movespline->Initialized() && !plr->movespline->Finalized())
+        {
+            // Server side movement (bots, taxi): where the spline will be, and where it ends
+            Movement::Location const ahead = plr->movespline->ComputePositionAfterTime(lookAhead);
+            Vector3 const destination = plr->movespline->FinalDestination();
+            requestAround(ahead.x, ahead.y);
+            requestAround(destination.x, destination.y);
+        }
+        else if (plr->IsMoving())
+        {
+            // Client side movement: straight on at the current speed
+            float const distance = plr->GetSpeed(plr->IsWalking() ? MOVE_WALK : MOVE_RUN) * lookAhead / IN_MILLISECONDS;
+            float const angle = plr->GetOrientation() + (plr->IsWalkingBackward() ? M_PI_F : 0.0f);
+            requestAround(plr->GetPositionX() + distance * cos(angle), plr->GetPositionY() + distance * sin(angle));
+        }
+    }
+
+    m_gridPrefetcher->Dispatch();
+}
+
+void Map::UpdatePlayer(Player* plr, uint32 now, uint32 diff, bool updateInactivePlayers)
+{
+    if (!updateInactivePlayers && (!plr->IsInCombat() && !plr->GetSession()->HasRecentPacket(PACKET_PROCESS_SPELLS) && !plr->HasScheduledEvent()))
+    {
+        plr->AddSkippedUpdateTime(diff);
+        return;
+    }
+    WorldObject::UpdateHelper helper(plr);
+    helper.UpdateRealTime(now, diff + plr->GetSkippedUpdateTime());
+    plr->ResetSkippedUpdateTime();
+}
+
 void Map::UpdatePlayers()
 {
     uint32 now = WorldTimer::getMSTime();
@@ -911,28 +1023,209 @@ void Map::UpdatePlayers()
         return;
 
     m_currentTime = std::chrono::time_point_cast<std::chrono::milliseconds>(Clock::now());
+    m_botGrindTargets->NewPass();
+    m_botGroupStates->NewPass();
 
     ++m_inactivePlayersSkippedUpdates;
     bool updateInactivePlayers = m_inactivePlayersSkippedUpdates > sWorld.getConfig(CONFIG_UINT32_INACTIVE_PLAYERS_SKIP_UPDATES);
     if (!IsContinent())
         updateInactivePlayers = true;
+    if (IsContinent() && (m_playerUpdateTasks || sWorld.getConfig(CONFIG_BOOL_MTPLAYERS_VERIFY)))
+        UpdatePlayersInRegions(now, diff, updateInactivePlayers);
+    else
+    {
+        for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
+        {
+            Player* plr = m_mapRefIter->getSource();
+            if (!plr || !plr->IsInWorld())
+                continue;
+            UpdatePlayer(plr, now, diff, updateInactivePlayers);
+        }
+    }
+    if (updateInactivePlayers)
+        m_inactivePlayersSkippedUpdates = 0;
+    m_lastPlayersUpdate = now;
+}
+
+void Map::UpdatePlayerRegionsCallback(uint32 now, uint32 diff, bool updateInactivePlayers, std::vector<uint32> const& regions, std::atomic<uint32>& nextRegion)
+{
+    // Regions are taken in turn, the players of a bot camp make some far longer than others
+    for (uint32 i = nextRegion++; i < regions.size(); i = nextRegion++)
+    {
+        for (ObjectGuid const& guid : m_playerRegions[regions[i]])
+        {
+            // May have left the map during the pass
+            if (Player* plr = GetPlayer(guid))
+                if (plr->IsInWorld())
+                    UpdatePlayer(plr, now, diff, updateInactivePlayers);
+        }
+    }
+}
+
+void Map::UpdatePlayersInRegions(uint32 now, uint32 diff, bool updateInactivePlayers)
+{
+    // A region is a band of cell rows higher than the safe distance. Its halo
+    // is the band on each side: regions updated at the same time are at least
+    // one band apart, so players and what they act on within the safe
+    // distance are never shared between two threads.
+    uint32 const regionHeight = sWorld.getConfig(CONFIG_UINT32_MTCELLS_SAFEDISTANCE) / SIZE_OF_GRID_CELL + 1;
+    if (regionHeight != m_playerRegionHeight)
+    {
+        m_playerRegionHeight = regionHeight;
+        m_playerRegions.assign((TOTAL_NUMBER_OF_CELLS_PER_MAP + regionHeight - 1) / regionHeight, std::vector<ObjectGuid>());
+    }
+
+    auto getRegion = [this](Player const* plr) -> int32
+    {
+        if (!plr->IsPositionValid())
+            return -1;
+        return MaNGOS::ComputeCellPair(plr->GetPositionX(), plr->GetPositionY()).y_coord / m_playerRegionHeight;
+    };
+
+    // Bots acknowledge their near teleports in their update, which moves them
+    // anywhere on the map: they are updated after the regions.
+    auto getUpdateRegion = [&getRegion](Player const* plr) -> int32
+    {
+        return plr->IsBeingTeleportedNear() ? -1 : getRegion(plr);
+    };
+
+    // Group members act on each other from any distance (heals, buffs, the
+    // bots' shared group view), so a group is updated by a single thread:
+    // in its region if all its members on the map are in the same one,
+    // after the regions otherwise.
+    std::unordered_map<uint32 /*group id*/, int32> groupRegions;
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
         Player* plr = m_mapRefIter->getSource();
         if (!plr || !plr->IsInWorld())
             continue;
-        if (!updateInactivePlayers && (!plr->IsInCombat() && !plr->GetSession()->HasRecentPacket(PACKET_PROCESS_SPELLS) && !plr->HasScheduledEvent()))
+        if (Group* group = plr->GetGroup())
+        {
+            int32 const region = getUpdateRegion(plr);
+            auto itr = groupRegions.emplace(group->GetId(), region);
+            if (!itr.second && itr.first->second != region)
+                itr.first->second = -1;
+        }
+    }
+
+    // Region threads must not create grids: the terrain loaded with them goes
+    // into the vmap tree and navmesh the other threads query without locks.
+    // A player stays within its halo, so the grids its activation area can
+    // reach during the update are loaded here first.
+    float const reach = GetGridActivationDistance() + regionHeight * SIZE_OF_GRID_CELL;
+    auto loadGridsInReach = [this, reach](Player const* plr)
+    {
+        CellArea const area = Cell::CalculateCellArea(plr->GetPositionX(), plr->GetPositionY(), reach);
+        for (uint32 gridX = area.low_bound.x_coord / MAX_NUMBER_OF_CELLS; gridX <= area.high_bound.x_coord / MAX_NUMBER_OF_CELLS; ++gridX)
         {
-            plr->AddSkippedUpdateTime(diff);
+            for (uint32 gridY = area.low_bound.y_coord / MAX_NUMBER_OF_CELLS; gridY <= area.high_bound.y_coord / MAX_NUMBER_OF_CELLS; ++gridY)
+            {
+                if (!loaded(GridPair(gridX, gridY)))
+                    EnsureGridLoaded(Cell(CellPair(gridX * MAX_NUMBER_OF_CELLS, gridY * MAX_NUMBER_OF_CELLS)));
+            }
+        }
+    };
+
+    for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
+    {
+        Player* plr = m_mapRefIter->getSource();
+        if (!plr || !plr->IsInWorld())
             continue;
+        int32 const region = plr->GetGroup() ? groupRegions[plr->GetGroup()->GetId()] : getUpdateRegion(plr);
+        if (region < 0)
+            m_playersOutsideRegions.push_back(plr->GetObjectGuid());
+        else
+            m_playerRegions[region].push_back(plr->GetObjectGuid());
+    }
+
+    // Loading grids runs scripts and AI, out of the players iteration
+    for (std::vector<ObjectGuid> const& region : m_playerRegions)
+        for (ObjectGuid const& guid : region)
+            if (Player* plr = GetPlayer(guid))
+                loadGridsInReach(plr);
+
+    if (sWorld.getConfig(CONFIG_BOOL_MTPLAYERS_VERIFY))
+    {
+        // Same order as the threads take them, one at a time on this thread,
+        // so two runs over the same world update players the same way
+        std::unordered_set<ObjectGuid> updated;
+        uint32 updatedTwice = 0;
+        uint32 outOfHalo = 0;
+        uint32 handedOver = 0;
+        auto updateChecked = [&](ObjectGuid const& guid, int32 region)
+        {
+            Player* plr = GetPlayer(guid);
+            if (!plr || !plr->IsInWorld())
+                return;
+            if (!updated.insert(guid).second)
+            {
+                ++updatedTwice;
+                sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "[MTPlayers] Map %u: %s updated twice in the same pass", GetId(), plr->GetName());
+                return;
+            }
+
+            UpdatePlayer(plr, now, diff, updateInactivePlayers);
+
+            int32 const endRegion = getRegion(plr);
+            if (region < 0 || endRegion == region)
+                return;
+            ++handedOver;
+            // Ended up where the thread of another region may have been working
+            if (endRegion < 0 || std::abs(endRegion - region) > 1)
+            {
+                ++outOfHalo;
+                sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "[MTPlayers] Map %u: %s left the halo of region %i during its update (now in %i, at %.1f %.1f)",
+                    GetId(), plr->GetName(), region, endRegion, plr->GetPositionX(), plr->GetPositionY());
+            }
+        };
+
+        for (uint32 step = 0; step < 2; ++step)
+            for (uint32 region = step; region < m_playerRegions.size(); region += 2)
+                for (ObjectGuid const& guid : m_playerRegions[region])
+                    updateChecked(guid, region);
+        for (ObjectGuid const& guid : m_playersOutsideRegions)
+            updateChecked(guid, -1);
+
+        if (updatedTwice || outOfHalo)
+            sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "[MTPlayers] Map %u: %u players updated, %u updated twice, %u out of halo, %u handed over",
+                GetId(), uint32(updated.size()), updatedTwice, outOfHalo, handedOver);
+        else
+            sLog.Out(LOG_PERFORMANCE, LOG_LVL_DETAIL, "[MTPlayers] Map %u: %u players updated, %u outside regions, %u handed over",
+                GetId(), uint32(updated.size()), uint32(m_playersOutsideRegions.size()), handedOver);
+    }
+    else
+    {
+        // Every other region at a time, as for the cells
+        uint32 const nthreads = m_playerUpdateTasks;
+        std::vector<uint32> regions;
+        for (uint32 step = 0; step < 2; ++step)
+        {
+            regions.clear();
+            for (uint32 region = step; region < m_playerRegions.size(); region += 2)
+                if (!m_playerRegions[region].empty())
+                    regions.push_back(region);
+            if (regions.empty())
+                continue;
+
+            std::atomic<uint32> nextRegion(0);
+            TaskGroup players;
+            for (uint32 i = 0; i < nthreads && i + 1 < regions.size(); ++i)
+                players.Run([this, now, diff, updateInactivePlayers, &regions, &nextRegion]() {
+                    UpdatePlayerRegionsCallback(now, diff, updateInactivePlayers, regions, nextRegion);
+                });
+            UpdatePlayerRegionsCallback(now, diff, updateInactivePlayers, regions, nextRegion);
+            players.Wait();
         }
-        WorldObject::UpdateHelper helper(plr);
-        helper.UpdateRealTime(now, diff + plr->GetSkippedUpdateTime());
-        plr->ResetSkippedUpdateTime();
+
+        for (ObjectGuid const& guid : m_playersOutsideRegions)
+            if (Player* plr = GetPlayer(guid))
+                if (plr->IsInWorld())
+                    UpdatePlayer(plr, now, diff, updateInactivePlayers);
     }
-    if (updateInactivePlayers)
-        m_inactivePlayersSkippedUpdates = 0;
-    m_lastPlayersUpdate = now;
+
+    for (std::vector<ObjectGuid>& region : m_playerRegions)
+        region.clear();
+    m_playersOutsideRegions.clear();
 }
 
 void Map::DoUpdate(uint32 maxDiff)
@@ -951,7 +1244,18 @@ void Map::Update(uint32 t_diff)
 {
     uint32 updateMapTime = WorldTimer::getMSTime();
     m_currentTime = std::chrono::time_point_cast<std::chrono::milliseconds>(Clock::now());
-    m_dynamicTree.update(t_diff);
+    {
+        // May rebalance the tree, while path workers of the last tick still read it
+        std::lock_guard<std::shared_timed_mutex> lock(m_dynamicTreeLock);
+        m_dynamicTree.update(t_diff);
+    }
+
+    // Paths requested during the previous tick
+    m_pathRequests->DeliverResults();
+
+    // No path worker runs until the next dispatch, grids read ahead can join the vmap and navmesh
+    if (m_gridPrefetcher)
+        m_gridPrefetcher->Attach();
 
     UpdateSessionsMovementAndSpellsIfNeeded();
     // update worldsessions for existing players
@@ -1038,6 +1342,23 @@ void Map::Update(uint32 t_diff)
 
     m_weatherSystem->UpdateWeathers(t_diff);
 
+    // Bots that reached their save timer this tick, in one go
+    if (!m_queuedBotSaves.empty())
+    {
+        std::vector<Player*> bots;
+        for (ObjectGuid const& guid : m_queuedBotSaves)
+            if (Player* pBot = GetPlayer(guid))
+                bots.push_back(pBot);
+        m_queuedBotSaves.clear();
+        Player::SaveBotsToDB(bots);
+    }
+
+    // Compute this tick's path requests while the world moves on
+    m_pathRequests->Dispatch();
+
+    // Same for the terrain of the grids players are heading to
+    PrefetchGridsAhead(t_diff);
+
     bool packetBroadcastSlow = sWorld.GetBroadcaster()->IsMapSlow(GetInstanceId());
     if (sWorld.getConfig(CONFIG_UINT32_PERFLOG_SLOW_MAP_UPDATE) && updateMapTime > sWorld.getConfig(CONFIG_UINT32_PERFLOG_SLOW_MAP_UPDATE))
         sLog.Out(LOG_PERFORMANCE, LOG_LVL_BASIC, "Update single map %3u inst %2u: %3ums "
@@ -1215,6 +1536,8 @@ void Map::Remove(Player* player, bool remove)
     if (m_data)
         m_data->OnPlayerLeave(player);
 
+    m_pathRequests->ForgetOwner(player);
+
     m_mCreatureSummonCount.erase(player->GetGUID());
     m_mCreatureSummonLimit.erase(player->GetGUID());
 
@@ -1299,6 +1622,7 @@ Map::Remove(T* obj, bool remove)
 
     m_mCreatureSummonCount.erase(obj->GetGUID());
     m_mCreatureSummonLimit.erase(obj->GetGUID());
+    m_pathRequests->ForgetOwner(obj);
 
     if (obj->IsActiveObject())
         RemoveFromActive(obj);
@@ -1415,6 +1739,7 @@ Map::PlayerRelocation(Player* player, float x, float y, float z, float orientati
     NGridType* newGrid = getNGrid(new_cell.GridX(), new_cell.GridY());
     if (!same_cell && newGrid->GetGridState() != GRID_STATE_ACTIVE)
     {
+        std::lock_guard<std::recursive_mutex> guard(m_gridLoadLock);
         ResetGridExpiry(*newGrid, 0.1f);
         newGrid->SetGridState(GRID_STATE_ACTIVE);
     }
@@ -1573,6 +1898,7 @@ bool Map::UnloadGrid(uint32 const& x, uint32 const& y, bool pForce)
     {
         m_bLoadedGrids[gx][gy] = false;
         m_terrainData->Unload(gx, gy);
+        m_pathCache->InvalidateGrid(gx, gy);
     }
 
     sLog.Out(LOG_BASIC, LOG_LVL_DEBUG, "Unloading grid[%u,%u] for map %u finished", x, y, m_id);
@@ -1822,6 +2148,14 @@ bool Map::HaveRealPlayers() const
     return false;
 }
 
+bool Map::HaveClientViewers() const
+{
+    for (const auto& itr : m_mapRefManager)
+        if (!itr.getSource()->IsHeadlessViewer())
+            return true;
+    return false;
+}
+
 uint32 Map::GetPlayersCountExceptGMs() const
 {
     uint32 count = 0;
@@ -1912,6 +2246,7 @@ bool Map::ActiveObjectsNearGrid(uint32 x, uint32 y) const
 
 void Map::AddToActive(WorldObject* obj)
 {
+    std::lock_guard<std::recursive_mutex> guard(m_gridLoadLock);
     m_activeNonPlayers.insert(obj);
 
     // also not allow unloading spawn grid to prevent creating creature clone at load
@@ -1940,6 +2275,7 @@ void Map::RemoveFromActive(WorldObject* obj)
 {
     // Map::Update for active object in proccess. Only erase and dec grid active lock if the
     // obj is actually active
+    std::lock_guard<std::recursive_mutex> guard(m_gridLoadLock);
     ActiveNonPlayers::iterator itr = m_activeNonPlayers.find(obj);
     if (itr != m_activeNonPlayers.end())
     {
@@ -2704,6 +3040,13 @@ void Map::StartAreaTriggerScript(AreaTriggerEntry const* pTrigger, Player* pPlay
  *
  * @param guid must be player guid (HIGHGUID_PLAYER)
  */
+void Map::QueueBotSave(Player* bot)
+{
+    // Bots leaving the map before the end of the tick are saved on logout/teleport instead
+    std::lock_guard<std::mutex> guard(m_queuedBotSavesLock);
+    m_queuedBotSaves.push_back(bot->GetObjectGuid());
+}
+
 Player* Map::GetPlayer(ObjectGuid guid)
 {
     Player* plr = ObjectAccessor::FindPlayer(guid);         // return only in world players
@@ -2870,16 +3213,26 @@ void Map::SendObjectUpdates()
     uint32 objectsCount = m_objectsToClientUpdate.size();
     if (!objectsCount)
         return;
+
+    // Only headless bots on this map: drop the pending changes without building any packet
+    if (!HaveClientViewers())
+    {
+        for (Object* obj : m_objectsToClientUpdate)
+            obj->ClearUpdateMask(false);
+        m_objectsToClientUpdate.clear();
+        return;
+    }
+
     m_processingSendObjUpdates = true;
 
     // Compute maximum number of threads
 //#define FORCE_OLD_THREADCOUNT
 #ifndef FORCE_OLD_THREADCOUNT
-    int threads = m_objectThreads ? m_objectThreads->size() +1 : 1;
+    int threads = m_objectUpdateTasks + 1;
 #else
     int threads = 1;
     if (IsContinent())
-        threads = m_objectThreads ? m_objectThreads->size() +1 : 1;
+        threads = m_objectUpdateTasks + 1;
     if (!m_objUpdatesThreads)
         m_objUpdatesThreads = 1;
     if (threads < m_objUpdatesThreads)
@@ -2917,17 +3270,13 @@ void Map::SendObjectUpdates()
         for (UpdateDataMapType::iterator iter = update_players.begin(); iter != update_players.end(); ++iter)
             iter->second.Send(iter->first->GetSession());
     };
-    std::future<void> job;
-    if (m_objectThreads) {
-        for (int i = 1; i < threads; i++)
-            m_objectThreads << f;
-        job = m_objectThreads->processWorkload();
-    }
+    TaskGroup job;
+    for (int i = 1; i < threads; i++)
+        job.Run(f);
 
     f();
 
-    if (job.valid())
-        job.wait();
+    job.Wait();
     if (ait >= m_objectsToClientUpdate.size()) //ait is increased before checks, so max value is `objectsCount + threads`
         m_objectsToClientUpdate.clear();
     else
@@ -2947,17 +3296,13 @@ void Map::SendObjectUpdates()
         for (UpdateDataMapType::iterator iter = update_players.begin(); iter != update_players.end(); ++iter)
             iter->second.Send(iter->first->GetSession());
     };
-    std::future<void> job;
-    if (m_objectThreads) {
-        for (int i = 1; i < threads; i++)
-            m_objectThreads << std::bind(f, i);
-        job = m_objectThreads->processWorkload();
-    }
+    TaskGroup job;
+    for (int i = 1; i < threads; i++)
+        job.Run(std::bind(f, i));
 
     f(0);
 
-    if (job.valid())
-        job.wait();
+    job.Wait();
     for (int i = 0; i < threads; i++)
         m_objectsToClientUpdate.erase(t[step * i], t[counters[i]]);
 #endif
@@ -2992,7 +3337,7 @@ void Map::UpdateVisibilityForRelocations()
     // Compute number of threads to spawn
     uint32 threads = 1;
     if (IsContinent())
-        threads = m_visibilityThreads->size() + 1;
+        threads = m_visibilityUpdateTasks + 1;
     if (!m_unitRelocationThreads)
         m_unitRelocationThreads = 1;
     if (threads < m_unitRelocationThreads)
@@ -3019,16 +3364,12 @@ void Map::UpdateVisibilityForRelocations()
             it = ait++;
         }
     };
+    TaskGroup job;
     for (uint32 i = 0; i < threads -1; ++i)
-        m_visibilityThreads << f;
-
-    std::future<void> job;
-    if (m_visibilityThreads)
-        job = m_visibilityThreads->processWorkload();
+        job.Run(f);
 
     f();
-    if (job.valid())
-        job.wait();
+    job.Wait();
     if (ait >= m_unitsRelocated.size()) //ait is increased before checks, so max value is `objectsCount + threads`
         m_unitsRelocated.clear();
     else
@@ -3130,6 +3471,31 @@ bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, floa
     && (!checkDynLos || CheckDynamicTreeLoS(x1, y1, z1, x2, y2, z2, ignoreM2Model));
 }
 
+void Map::areInLineOfSight(VMAP::LineOfSightSegment* segments, uint32 count, bool checkDynLos, bool ignoreM2Model) const
+{
+    for (uint32 i = 0; i < count; ++i)
+    {
+        ASSERT(MaNGOS::IsValidMapCoord(segments[i].x1, segments[i].y1, segments[i].z1));
+        ASSERT(MaNGOS::IsValidMapCoord(segments[i].x2, segments[i].y2, segments[i].z2));
+    }
+
+    VMAP::VMapFactory::createOrGetVMapManager()->areInLineOfSight(GetId(), segments, count, ignoreM2Model);
+
+    if (!checkDynLos)
+        return;
+
+    std::shared_lock<std::shared_timed_mutex> lock(m_dynamicTreeLock);
+    if (!m_dynamicTree.size())
+        return;
+
+    for (uint32 i = 0; i < count; ++i)
+    {
+        VMAP::LineOfSightSegment& segment = segments[i];
+        if (segment.inLineOfSight)
+            segment.inLineOfSight = m_dynamicTree.isInLineOfSight(segment.x1, segment.y1, segment.z1, segment.x2, segment.y2, segment.z2, ignoreM2Model);
+    }
+}
+
 bool Map::GetLosHitPosition(float srcX, float srcY, float srcZ, float& destX, float& destY, float& destZ, float modifyDist) const
 {
     ASSERT(MaNGOS::IsValidMapCoord(srcX, srcY, srcZ));
@@ -3415,6 +3781,12 @@ GameObjectModel const* Map::FindDynamicObjectCollisionModel(float x1, float y1,
     return result;
 }
 
+void Map::Balance()
+{
+    std::lock_guard<std::shared_timed_mutex> lock(m_dynamicTreeLock);
+    m_dynamicTree.balance();
+}
+
 void Map::RemoveGameObjectModel(const GameObjectModel &model)
 {
     std::lock_guard<std::shared_timed_mutex> lock(m_dynamicTreeLock);
@@ -39,6 +39,7 @@
 #include "ScriptCommands.h"
 #include "CreatureLinkingMgr.h"
 
+#include <atomic>
 #include <bitset>
 #include <list>
 #include <set>
@@ -61,6 +62,11 @@ class BattleGroundPersistentState;
 class ChatHandler;
 class BattleGround;
 class WeatherSystem;
+class PathRequestService;
+class PathCache;
+class GridPrefetcher;
+class BotGrindTargetCache;
+class BotGroupStateCache;
 class GenericTransport;
 class ElevatorTransport;
 class ShipTransport;
@@ -68,6 +74,7 @@ class ShipTransport;
 namespace VMAP
 {
     class ModelInstance;
+    struct LineOfSightSegment;
 };
 
 // GCC have alternative #pragma pack(N) syntax and old gcc version not support pack(push,N), also any gcc version not support it at some platform
@@ -315,8 +322,6 @@ struct ScriptedEvent
     ScriptedEvent(ScriptedEvent const&) = delete;
 };
 
-class ThreadPool;
-
 class Map : public GridRefManager<NGridType>
 {
     friend class MapReference;
@@ -357,6 +362,10 @@ class Map : public GridRefManager<NGridType>
         inline void UpdateCells(uint32 diff);
         void UpdateSync(uint32 const);
         void UpdatePlayers();
+        void PrefetchGridsAhead(uint32 diff);
+        void UpdatePlayer(Player* plr, uint32 now, uint32 diff, bool updateInactivePlayers);
+        void UpdatePlayersInRegions(uint32 now, uint32 diff, bool updateInactivePlayers);
+        void UpdatePlayerRegionsCallback(uint32 now, uint32 diff, bool updateInactivePlayers, std::vector<uint32> const& regions, std::atomic<uint32>& nextRegion);
         void DoUpdate(uint32 maxDiff);
         virtual void Update(uint32);
         void UpdateSessionsMovementAndSpellsIfNeeded();
@@ -446,6 +455,21 @@ class Map : public GridRefManager<NGridType>
 
         bool HavePlayers() const { return !m_mapRefManager.isEmpty(); }
         bool HaveRealPlayers() const; // no bots
+        bool HaveClientViewers() const; // players that need update packets (no headless bots)
+
+        // Asynchronous path requests, results are delivered at the start of the next tick
+        PathRequestService& GetPathRequests() { return *m_pathRequests; }
+        PathCache& GetPathCache() { return *m_pathCache; }
+        GridPrefetcher const* GetGridPrefetcher() const { return m_gridPrefetcher.get(); }
+
+        // Periodic bot saves, written together at the end of the tick
+        void QueueBotSave(Player* bot);
+
+        // Grind targets shared by the bots on this map, renewed every player update pass
+        BotGrindTargetCache& GetBotGrindTargets() { return *m_botGrindTargets; }
+
+        // Group member snapshots for healer and support bots, renewed every player update pass
+        BotGroupStateCache& GetBotGroupStates() { return *m_botGroupStates; }
         uint32 GetPlayersCountExceptGMs() const;
         bool ActiveObjectsNearGrid(uint32 x,uint32 y) const;
 
@@ -556,6 +580,8 @@ class Map : public GridRefManager<NGridType>
         // GameObjectCollision
         float GetHeight(float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
         bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, bool checkDynLos = true, bool ignoreM2Model = true) const;
+        // isInLineOfSight of many segments, one tree lookup and lock for all
+        void areInLineOfSight(VMAP::LineOfSightSegment* segments, uint32 count, bool checkDynLos = true, bool ignoreM2Model = true) const;
         // First collision with object
         bool GetLosHitPosition(float srcX, float srcY, float srcZ, float& destX, float& destY, float& destZ, float modifyDist) const;
         // Use navemesh to walk
@@ -566,7 +592,7 @@ class Map : public GridRefManager<NGridType>
         VMAP::ModelInstance* FindCollisionModel(float x1, float y1, float z1, float x2, float y2, float z2);
         GameObjectModel const* FindDynamicObjectCollisionModel(float x1, float y1, float z1, float x2, float y2, float z2);
 
-        void Balance() { m_dynamicTree.balance(); }
+        void Balance();
         void RemoveGameObjectModel(GameObjectModel const& model);
         void InsertGameObjectModel(GameObjectModel const& model);
         bool ContainsGameObjectModel(GameObjectModel const& model) const;
@@ -667,10 +693,21 @@ class Map : public GridRefManager<NGridType>
         void RemoveCorpses(bool unload = false);
         void RemoveOldBones(uint32 const diff);
 
-        std::unique_ptr<ThreadPool> m_objectThreads;
-        std::unique_ptr<ThreadPool> m_motionThreads;
-        std::unique_ptr<ThreadPool> m_visibilityThreads;
-        std::unique_ptr<ThreadPool> m_cellThreads;
+        // Extra tasks each update is split into on sTaskScheduler, the map's own
+        // thread takes one more share. 0 keeps the update on the map's thread.
+        uint32 m_objectUpdateTasks = 0;
+        uint32 m_visibilityUpdateTasks = 0;
+        uint32 m_cellUpdateTasks = 0;
+        uint32 m_playerUpdateTasks = 0;
+        bool m_asyncMotionUpdate = false;
+        std::unique_ptr<PathCache> m_pathCache;
+        std::unique_ptr<PathRequestService> m_pathRequests;
+        std::unique_ptr<GridPrefetcher> m_gridPrefetcher;
+        uint32 m_gridPrefetchTimer = 0;
+        std::mutex m_queuedBotSavesLock;
+        std::vector<ObjectGuid> m_queuedBotSaves;
+        std::unique_ptr<BotGrindTargetCache> m_botGrindTargets;
+        std::unique_ptr<BotGroupStateCache> m_botGroupStates;
 
     protected:
         MapEntry const* m_mapEntry;
@@ -718,6 +755,26 @@ class Map : public GridRefManager<NGridType>
 
         std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP*TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
 
+        // Cells marked for the asynch update, one list per stripe of
+        // m_activeCellStripeHeight rows. Cleared along with their marks once
+        // updated, so the next pass does not have to reset marked_cells.
+        std::vector<std::vector<uint32>> m_activeCellStripes;
+        uint32 m_activeCellStripeHeight = 0;
+        bool m_markedCellsDirty = true;          // marks left by a synch update
+
+        // Players of the region update, one list per band of m_playerRegionHeight
+        // cell rows, and those of groups spread over several bands or about to
+        // land a near teleport. Rebuilt from positions at the start of each
+        // pass, which hands the players that crossed into another band over to it.
+        std::vector<std::vector<ObjectGuid>> m_playerRegions;
+        std::vector<ObjectGuid> m_playersOutsideRegions;
+        uint32 m_playerRegionHeight = 0;
+
+        // Grids a region update may reach are loaded before it starts, but the
+        // threads still change the active objects list, map wide.
+        // Recursive, loading a grid adds its active objects.
+        std::recursive_mutex    m_gridLoadLock;
+
         mutable std::mutex      m_objectsToRemoveLock;
         std::set<WorldObject *> m_objectsToRemove;
 
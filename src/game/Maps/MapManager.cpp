@@ -33,6 +33,7 @@
 #include "Map.h"
 #include "BattleGround.h"
 #include "ThreadPool.h"
+#include "TaskScheduler.h"
 #include "IO/Multithreading/CreateThread.h"
 
 typedef MaNGOS::ClassLevelLockable<MapManager, std::recursive_mutex> MapManagerLock;
@@ -43,11 +44,9 @@ MapManager::MapManager()
     :
     i_gridCleanUpDelay(sWorld.getConfig(CONFIG_UINT32_INTERVAL_GRIDCLEAN)),
     i_MaxInstanceId(RESERVED_INSTANCES_LAST),
-    m_threads(new ThreadPool("MapManager", sWorld.getConfig(CONFIG_UINT32_MAPUPDATE_INSTANCED_UPDATE_THREADS))),
     m_instanceCreationThreads(new ThreadPool("NewMapForPlayer", 1))
 {
     i_timer.SetInterval(sWorld.getConfig(CONFIG_UINT32_INTERVAL_MAPUPDATE));
-    m_threads->start<ThreadPool::MySQL<>>();
     m_instanceCreationThreads->start<>();
 }
 
@@ -62,6 +61,10 @@ MapManager::~MapManager()
 void
 MapManager::Initialize()
 {
+    // Every map update runs on these workers
+    sTaskScheduler.Start(sWorld.getConfig(CONFIG_UINT32_MAPUPDATE_SCHEDULER_THREADS));
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "Map update scheduler started with %u workers", sTaskScheduler.GetWorkerCount());
+
     InitStateMachine();
     InitMaxInstanceId();
     for (auto itr = sMapStorage.begin<MapEntry>(); itr < sMapStorage.end<MapEntry>(); ++itr)
@@ -309,8 +312,9 @@ void MapManager::Update(uint32 diff)
     uint32 now = WorldTimer::getMSTime();
 
     uint32 inactiveTimeLimit = sWorld.getConfig(CONFIG_UINT32_EMPTY_MAPS_UPDATE_TIME);
-    std::vector<std::function<void()>> continentsUpdaters;
-    std::vector<std::function<void()>> instancesUpdaters;
+    bool const asyncInstances = sWorld.getConfig(CONFIG_UINT32_MAPUPDATE_INSTANCED_UPDATE_THREADS) > 0;
+    std::vector<Map*> continents;
+    std::vector<Map*> instances;
 
     for (MapMapType::iterator iter = i_maps.begin(); iter != i_maps.end(); ++iter)
     {
@@ -322,60 +326,57 @@ void MapManager::Update(uint32 diff)
         iter->second->MarkNotUpdated();
         if (iter->second->Instanceable())
         {
-            if (m_threads->status() == ThreadPool::Status::READY)
-                instancesUpdaters.emplace_back([iter,mapsDiff](){
-                    iter->second->DoUpdate(mapsDiff);
-                });
+            if (asyncInstances)
+                instances.push_back(iter->second);
             else
                 iter->second->DoUpdate(mapsDiff);
         }
-        else // One threat per continent part
+        else // One task per continent part
         {
-            continentsUpdaters.emplace_back([iter,mapsDiff](){
-                Map *m = iter->second;
-                if (!m->IsUpdateFinished() || !sMapMgr.IsContinentUpdateFinished())
-                    m->DoUpdate(mapsDiff);
-            });
+            continents.push_back(iter->second);
             continentsIdx++;
         }
     }
 
     std::vector<std::function<void()>> instanceCreators;
     instanceCreators.emplace_back([this]() {CreateNewInstancesForPlayers();});
-    std::future<void> instances = m_instanceCreationThreads->processWorkload(std::move(instanceCreators),
+    std::future<void> instanceCreation = m_instanceCreationThreads->processWorkload(std::move(instanceCreators),
         ThreadPool::Callable());
 
     i_maxContinentThread = continentsIdx;
     i_continentUpdateFinished.store(0);
 
-    if (!m_continentThreads || m_continentThreads->size() < continentsUpdaters.size())
-    {
-        m_continentThreads.reset(new ThreadPool("MapContinent", continentsUpdaters.size()));
-        m_continentThreads->start<>();
-    }
-    std::future<void> continents = m_continentThreads->processWorkload(std::move(continentsUpdaters),
-                                                                       ThreadPool::Callable());
+    // Continent updates wait on each other at their end, helping with any
+    // queued task meanwhile (see waitContinentUpdateFinishedUntil)
+    TaskGroup continentUpdates;
+    for (Map* m : continents)
+        continentUpdates.Run([m, mapsDiff](){
+            if (!m->IsUpdateFinished() || !sMapMgr.IsContinentUpdateFinished())
+                m->DoUpdate(mapsDiff);
+        });
 
+    // Instances are updated again until the continents are done
     std::chrono::high_resolution_clock::time_point start;
     do {
-        start = std::chrono::high_resolution_clock::now();
-        std::future<void> f = m_threads->processWorkload(instancesUpdaters,
-                                                         ThreadPool::Callable());
-
-        if (f.valid())
-            f.wait();
-        else
+        if (instances.empty())
             break;
+
+        start = std::chrono::high_resolution_clock::now();
+        TaskGroup instanceUpdates;
+        for (Map* m : instances)
+            instanceUpdates.Run([m, mapsDiff](){
+                m->DoUpdate(mapsDiff);
+            });
+        instanceUpdates.Wait();
     }while(!sMapMgr.waitContinentUpdateFinishedUntil(start + std::chrono::milliseconds(sWorld.getConfig(CONFIG_UINT32_INTERVAL_MAPUPDATE))));
 
-    if (continents.valid())
-        continents.wait();
+    continentUpdates.Wait();
 
     SwitchPlayersInstances();
     asyncMapUpdating = false;
 
-    if (instances.valid())
-        instances.wait();
+    if (instanceCreation.valid())
+        instanceCreation.wait();
 
     // Execute far teleports after all map updates have finished
     ExecuteDelayedPlayerTeleports();
@@ -437,6 +438,10 @@ bool MapManager::IsValidMAP(uint32 mapid)
 
 void MapManager::UnloadAll()
 {
+    // Join the map update workers while maps and databases are still there,
+    // tasks queued from now on run on the calling thread
+    sTaskScheduler.Stop();
+
     for (const auto& itr : i_maps)
         itr.second->UnloadAll(true);
 
@@ -997,6 +1002,15 @@ bool MapManager::waitContinentUpdateFinishedFor(std::chrono::milliseconds time)
 
 bool MapManager::waitContinentUpdateFinishedUntil(std::chrono::high_resolution_clock::time_point time) const
 {
-    std::unique_lock<std::mutex> lock(m_continentMutex);
-    return m_continentCV.wait_until(lock,time,std::bind(&MapManager::IsContinentUpdateFinished,this));
+    // Run queued map tasks instead of sleeping: a continent not started
+    // yet may be one of them
+    while (!IsContinentUpdateFinished() && std::chrono::high_resolution_clock::now() < time)
+    {
+        if (sTaskScheduler.RunPendingTask())
+            continue;
+
+        std::unique_lock<std::mutex> lock(m_continentMutex);
+        m_continentCV.wait_for(lock, std::chrono::milliseconds(1), std::bind(&MapManager::IsContinentUpdateFinished,this));
+    }
+    return IsContinentUpdateFinished();
 }
@@ -208,8 +208,6 @@ class MapManager : public MaNGOS::Singleton<MapManager, MaNGOS::ClassLevelLockab
         mutable std::condition_variable      m_continentCV;
         std::atomic<int> i_continentUpdateFinished{0};
 
-        std::unique_ptr<ThreadPool> m_threads;
-        std::unique_ptr<ThreadPool> m_continentThreads;
         std::unique_ptr<ThreadPool> m_instanceCreationThreads;
         bool asyncMapUpdating = false;
 
@@ -119,7 +119,7 @@ uint32 MMapManager::packTileID(int32 x, int32 y)
     return uint32(x << 16 | y);
 }
 
-bool MMapManager::loadMap(uint32 mapId, int32 x, int32 y)
+bool MMapManager::loadMap(uint32 mapId, int32 x, int32 y, MMapTileData* tile)
 {
     // make sure the mmap is loaded and ready to load tiles
     if (!loadMapData(mapId))
@@ -137,6 +137,44 @@ bool MMapManager::loadMap(uint32 mapId, int32 x, int32 y)
     if (mmap->mmapLoadedTiles.find(packedGridPos) != mmap->mmapLoadedTiles.end())
         return false;
 
+    MMapTileData localTile;
+    if (!tile || !tile->read)
+    {
+        tile = &localTile;
+        readTile(mapId, x, y, localTile);
+    }
+
+    if (!tile->data)
+        return false;
+
+    //dtMeshHeader* header = (dtMeshHeader*)data;
+    dtTileRef tileRef = 0;
+
+    // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
+    dtStatus dResult = mmap->navMesh->addTile(tile->data, tile->size, DT_TILE_FREE_DATA, 0, &tileRef);
+    if (dtStatusSucceed(dResult))
+    {
+        tile->data = nullptr;
+        mmap->mmapLoadedTiles.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
+        ++loadedTiles;
+        return true;
+    }
+    else
+    {
+        sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "MMAP:loadMap: Could not load %03u%02i%02i.mmtile into navmesh [result 0x%x]", mapId, x, y, dResult);
+        return false;
+    }
+
+    return false;
+}
+
+bool MMapManager::readTile(uint32 mapId, int32 x, int32 y, MMapTileData& tile) const
+{
+    tile.read = true;
+
+    if (!sWorld.getConfig(CONFIG_BOOL_MMAP_ENABLED))
+        return false;
+
     // load this tile :: mmaps/MMMXXYY.mmtile
     uint32 pathLen = sWorld.GetDataPath().length() + strlen("mmaps/%03i%02i%02i.mmtile") + 1;
     char *fileName = new char[pathLen];
@@ -186,31 +224,16 @@ bool MMapManager::loadMap(uint32 mapId, int32 x, int32 y)
     if (!result)
     {
         sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "MMAP:loadMap: Bad header or data in mmap %03u%02i%02i.mmtile", mapId, x, y);
+        dtFree(data);
         fclose(file);
         return false;
     }
 
     fclose(file);
 
-    //dtMeshHeader* header = (dtMeshHeader*)data;
-    dtTileRef tileRef = 0;
-
-    // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
-    dtStatus dResult = mmap->navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef);
-    if (dtStatusSucceed(dResult))
-    {
-        mmap->mmapLoadedTiles.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
-        ++loadedTiles;
-        return true;
-    }
-    else
-    {
-        sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "MMAP:loadMap: Could not load %03u%02i%02i.mmtile into navmesh [result 0x%x]", mapId, x, y, dResult);
-        dtFree(data);
-        return false;
-    }
-
-    return false;
+    tile.data = data;
+    tile.size = fileHeader.size;
+    return true;
 }
 
 bool MMapManager::unloadMap(uint32 mapId, int32 x, int32 y)
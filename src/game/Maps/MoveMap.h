@@ -73,6 +73,24 @@ namespace MMAP
 
     typedef std::unordered_map<uint32, MMapData*> MMapDataSet;
 
+    // mmtile read ahead of being added to its navmesh, see MMapManager::readTile()
+    struct MMapTileData
+    {
+        MMapTileData() : data(nullptr), size(0), read(false) {}
+        ~MMapTileData()
+        {
+            // not added to a navmesh
+            if (data)
+                dtFree(data);
+        }
+        MMapTileData(MMapTileData const&) = delete;
+        MMapTileData& operator=(MMapTileData const&) = delete;
+
+        unsigned char* data;
+        uint32 size;
+        bool read;                          // readTile() ran, data stays null without a tile
+    };
+
     // singelton class
     // holds all all access to mmap loading unloading and meshes
     class MMapManager
@@ -81,7 +99,10 @@ namespace MMAP
             MMapManager() : loadedTiles(0) {}
             ~MMapManager();
 
-            bool loadMap(uint32 mapId, int32 x, int32 y);
+            // tile: read ahead by readTile(), read here otherwise
+            bool loadMap(uint32 mapId, int32 x, int32 y, MMapTileData* tile = nullptr);
+            // Reads a tile file, without touching any navmesh: safe from any thread
+            bool readTile(uint32 mapId, int32 x, int32 y, MMapTileData& tile) const;
             bool loadGameObject(uint32 displayId);
             void loadAllGameObjectModels(std::set<uint32> const& displayIds);
             bool unloadMap(uint32 mapId, int32 x, int32 y);
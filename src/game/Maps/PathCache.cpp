@@ -0,0 +1,182 @@
+/*
+* This program is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation; either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program; if not, write to the Free Software
+* Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#include "PathCache.h"
+#include "GridDefines.h"
+
+#include <algorithm>
+#include <cmath>
+
+std::size_t PathCache::KeyHash::operator()(Key const& key) const
+{
+    std::size_t seed = 0;
+    for (int32 value : { key.sx, key.sy, key.sz, key.dx, key.dy, key.dz })
+        seed ^= std::hash<int32>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+}
+
+PathCache::Key PathCache::MakeKey(Vector3 const& start, Vector3 const& dest)
+{
+    Key key;
+    key.sx = int32(std::floor(start.x / START_QUANTUM));
+    key.sy = int32(std::floor(start.y / START_QUANTUM));
+    key.sz = int32(std::floor(start.z / START_QUANTUM));
+    key.dx = int32(std::floor(dest.x / DEST_QUANTUM));
+    key.dy = int32(std::floor(dest.y / DEST_QUANTUM));
+    key.dz = int32(std::floor(dest.z / DEST_QUANTUM));
+    return key;
+}
+
+void PathCache::GetGrid(float x, float y, int& gx, int& gy)
+{
+    // Same (swapped) layout as TerrainInfo::GetGrid
+    gx = int(32 - y / SIZE_OF_GRIDS);
+    gy = int(32 - x / SIZE_OF_GRIDS);
+}
+
+bool PathCache::Find(Vector3 const& start, Vector3 const& dest, PathRequestResult& result)
+{
+    if (!IsEnabled())
+        return false;
+
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    auto itr = m_index.find(MakeKey(start, dest));
+    if (itr == m_index.end())
+    {
+        ++m_misses;
+        return false;
+    }
+
+    m_entries.splice(m_entries.begin(), m_entries, itr->second);
+    result = itr->second->result;
+    ++m_hits;
+    return true;
+}
+
+void PathCache::Store(Vector3 const& start, Vector3 const& dest, PathRequestResult const& result)
+{
+    if (!IsEnabled() || (result.type & PATHFIND_NOPATH) || result.path.empty())
+        return;
+
+    uint32 bytes = sizeof(Entry) + uint32(result.path.size() * sizeof(Vector3));
+    if (bytes > m_budget)
+        return;
+
+    Entry entry;
+    entry.key = MakeKey(start, dest);
+    entry.result = result;
+    entry.bytes = bytes;
+
+    int gx, gy;
+    GetGrid(start.x, start.y, gx, gy);
+    entry.minGX = entry.maxGX = gx;
+    entry.minGY = entry.maxGY = gy;
+    for (Vector3 const& point : result.path)
+    {
+        GetGrid(point.x, point.y, gx, gy);
+        entry.minGX = std::min<int16>(entry.minGX, gx);
+        entry.maxGX = std::max<int16>(entry.maxGX, gx);
+        entry.minGY = std::min<int16>(entry.minGY, gy);
+        entry.maxGY = std::max<int16>(entry.maxGY, gy);
+    }
+
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    auto existing = m_index.find(entry.key);
+    if (existing != m_index.end())
+        Erase(existing->second);
+
+    while (m_used + bytes > m_budget && !m_entries.empty())
+    {
+        Erase(std::prev(m_entries.end()));
+        ++m_evictions;
+    }
+
+    m_entries.push_front(std::move(entry));
+    m_index[m_entries.front().key] = m_entries.begin();
+    m_used += bytes;
+}
+
+void PathCache::InvalidateGrid(int gx, int gy)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    // A path ending at a grid border may change when the neighbour loads
+    for (auto itr = m_entries.begin(); itr != m_entries.end();)
+    {
+        auto next = std::next(itr);
+        if (gx >= itr->minGX - 1 && gx <= itr->maxGX + 1 &&
+            gy >= itr->minGY - 1 && gy <= itr->maxGY + 1)
+        {
+            Erase(itr);
+            ++m_invalidations;
+        }
+        itr = next;
+    }
+}
+
+void PathCache::Clear()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_invalidations += m_entries.size();
+    m_entries.clear();
+    m_index.clear();
+    m_used = 0;
+}
+
+void PathCache::Erase(EntryList::iterator itr)
+{
+    m_used -= itr->bytes;
+    m_index.erase(itr->key);
+    m_entries.erase(itr);
+}
+
+uint32 PathCache::GetEntryCount() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return uint32(m_entries.size());
+}
+
+uint32 PathCache::GetUsedBytes() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_used;
+}
+
+uint64 PathCache::GetHits() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_hits;
+}
+
+uint64 PathCache::GetMisses() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_misses;
+}
+
+uint64 PathCache::GetEvictions() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_evictions;
+}
+
+uint64 PathCache::GetInvalidations() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_invalidations;
+}
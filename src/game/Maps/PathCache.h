@@ -0,0 +1,114 @@
+/*
+* This program is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation; either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program; if not, write to the Free Software
+* Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#ifndef MANGOS_PATH_CACHE_H
+#define MANGOS_PATH_CACHE_H
+
+#include "Common.h"
+#include "PathRequestService.h"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * Per-map cache of computed player paths.
+ *
+ * Bots path to the same vendors, trainers, quest givers and grind spots over
+ * and over. Results are keyed by the start and destination positions rounded
+ * to a small grid, so requests from roughly the same spot to the same place
+ * share one Detour query.
+ *
+ * Entries are evicted least recently used first once the memory budget is
+ * reached, and dropped when a navmesh tile they span (or borders) is loaded
+ * or unloaded on the map. Only paths computed for players are stored: the
+ * navmesh filter differs between creatures.
+ */
+class PathCache
+{
+    public:
+        explicit PathCache(uint32 budgetBytes) : m_budget(budgetBytes) {}
+
+        bool IsEnabled() const { return m_budget != 0; }
+
+        // Copy a cached path into result. Counts a hit or a miss.
+        bool Find(Vector3 const& start, Vector3 const& dest, PathRequestResult& result);
+
+        // Store a computed path. NOPATH results are not cached.
+        void Store(Vector3 const& start, Vector3 const& dest, PathRequestResult const& result);
+
+        // Forget paths touching terrain grid gx, gy (TerrainInfo coordinates)
+        void InvalidateGrid(int gx, int gy);
+        void Clear();
+
+        // Stats
+        uint32 GetEntryCount() const;
+        uint32 GetUsedBytes() const;
+        uint32 GetBudgetBytes() const { return m_budget; }
+        uint64 GetHits() const;
+        uint64 GetMisses() const;
+        uint64 GetEvictions() const;
+        uint64 GetInvalidations() const;
+
+    private:
+        struct Key
+        {
+            int32 sx, sy, sz;
+            int32 dx, dy, dz;
+
+            bool operator==(Key const& other) const
+            {
+                return sx == other.sx && sy == other.sy && sz == other.sz &&
+                       dx == other.dx && dy == other.dy && dz == other.dz;
+            }
+        };
+
+        struct KeyHash
+        {
+            std::size_t operator()(Key const& key) const;
+        };
+
+        struct Entry
+        {
+            Key key;
+            PathRequestResult result;
+            uint32 bytes;
+            int16 minGX, maxGX, minGY, maxGY;       // terrain grids spanned
+        };
+
+        typedef std::list<Entry> EntryList;
+
+        static Key MakeKey(Vector3 const& start, Vector3 const& dest);
+        static void GetGrid(float x, float y, int& gx, int& gy);
+        void Erase(EntryList::iterator itr);
+
+        mutable std::mutex m_lock;
+        EntryList m_entries;                                // most recently used first
+        std::unordered_map<Key, EntryList::iterator, KeyHash> m_index;
+        uint32 m_budget;
+        uint32 m_used = 0;
+
+        uint64 m_hits = 0;
+        uint64 m_misses = 0;
+        uint64 m_evictions = 0;
+        uint64 m_invalidations = 0;
+
+        // Key resolution in yards: starts are shared more loosely than destinations
+        static constexpr float START_QUANTUM = 4.0f;
+        static constexpr float DEST_QUANTUM = 2.0f;
+};
+
+#endif
@@ -29,9 +29,12 @@
 #include "Detour/Include/DetourCommon.h"
 #include "World.h"  // For WorldTimer
 #include <map>
+#include <mutex>
 
 // Rate limiting for bot pathfinding errors (10 seconds per bot)
+// Paths are also built on the map path workers
 static std::map<uint32, uint32> s_botInvalidPolyLastLog;
+static std::mutex s_botInvalidPolyLogLock;
 static constexpr uint32 INVALID_POLY_LOG_INTERVAL_MS = 10000;
 
 // Helper: Returns true if this unit is a player bot (for debug logging)
@@ -42,6 +45,63 @@ static inline bool IsPlayerBot(Unit const* unit)
     return static_cast<Player const*>(unit)->IsBot();
 }
 
+////////////////// PathOwnerState //////////////////
+PathOwnerState::PathOwnerState(Unit const* owner) :
+    map(owner->FindMap()), terrain(map ? map->GetTerrain() : nullptr), guidLow(owner->GetGUIDLow()), mapId(owner->GetMapId()),
+    boundingRadius(owner->GetObjectBoundingRadius()), minSwimDepth(owner->GetMinSwimDepth()), typeId(owner->GetTypeId()),
+    isBot(IsPlayerBot(owner)), canWalk(owner->CanWalk()), canSwim(owner->CanSwim()), canFly(owner->CanFly()),
+    ignorePathfinding(owner->HasUnitState(UNIT_STATE_IGNORE_PATHFINDING)), onTransport(owner->GetTransport() != nullptr),
+    waterWalk(owner->HasAuraType(SPELL_AURA_WATER_WALK)), moving(owner->IsMoving()), inCombat(owner->IsInCombat())
+{
+    owner->GetPosition(position.x, position.y, position.z);
+    if (isBot)
+        name = owner->GetName();
+}
+
+// Same as Unit::CanSwimAtPosition
+bool PathOwnerState::CanSwimAtPosition(Vector3 const& pos) const
+{
+    return terrain->IsSwimmable(pos.x, pos.y, pos.z, minSwimDepth);
+}
+
+// Same as WorldObject::UpdateAllowedPositionZ for units
+void PathOwnerState::UpdateAllowedPositionZ(float x, float y, float &z) const
+{
+    if (onTransport)
+        return;
+
+    // creatures that can't fly and players (for server controlled moves)
+    // are kept between the ground and the water surface
+    if (typeId == TYPEID_PLAYER || !canFly)
+    {
+        float ground_z = z;
+        float max_z = (typeId == TYPEID_PLAYER || canSwim)
+                      ? terrain->GetWaterOrGroundLevel(x, y, z, &ground_z, !waterWalk)
+                      : ((ground_z = map->GetHeight(x, y, z, true)));
+        if (max_z > INVALID_HEIGHT)
+        {
+            if (z > max_z)
+                z = max_z;
+            else if (z < ground_z)
+                z = ground_z;
+        }
+    }
+    else
+    {
+        float ground_z = map->GetHeight(x, y, z, true);
+        if (z < ground_z)
+            z = ground_z;
+    }
+}
+
+// Same as WorldObject::UpdateGroundPositionZ
+void PathOwnerState::UpdateGroundPositionZ(float x, float y, float &z) const
+{
+    float new_z = map->GetHeight(x, y, z, true);
+    if (new_z > INVALID_HEIGHT)
+        z = new_z + 0.05f;                                  // just to be sure that we are not a few pixel under the surface
+}
+
 // Distance to target
 #define SMOOTH_PATH_SLOP 0.4f
 // Distance between path steps
@@ -50,13 +110,21 @@ static inline bool IsPlayerBot(Unit const* unit)
 ////////////////// PathInfo //////////////////
 PathInfo::PathInfo(Unit const* owner) :
     m_polyLength(0), m_type(PATHFIND_BLANK), m_useStraightPath(false), m_forceDestination(false),
-    m_pointPathLimit(MAX_POINT_PATH_LENGTH), m_transport(nullptr), m_sourceUnit(owner),
+    m_pointPathLimit(MAX_POINT_PATH_LENGTH), m_transport(nullptr), m_sourceUnit(owner), m_owner(owner),
     m_navMesh(nullptr), m_navMeshQuery(nullptr), m_targetAllowedFlags(0)
 {
     //DEBUG_FILTER_LOG(LOG_FILTER_PATHFINDING, "++ PathFinder::PathInfo for %u \n", m_sourceUnit->GetGUIDLow());
     createFilter();
 }
 
+PathInfo::PathInfo(PathOwnerState const& owner) :
+    m_polyLength(0), m_type(PATHFIND_BLANK), m_useStraightPath(false), m_forceDestination(false),
+    m_pointPathLimit(MAX_POINT_PATH_LENGTH), m_transport(nullptr), m_sourceUnit(nullptr), m_owner(owner),
+    m_navMesh(nullptr), m_navMeshQuery(nullptr), m_targetAllowedFlags(0)
+{
+    createFilter();
+}
+
 
 PathInfo::~PathInfo()
 {
@@ -82,6 +150,9 @@ bool PathInfo::calculate(Vector3 const& start, Vector3 dest, bool forceDest, boo
     m_forceDestination = forceDest;
     m_type = PATHFIND_BLANK;
 
+    if (m_sourceUnit)
+        m_owner = PathOwnerState(m_sourceUnit);
+
     Vector3 oldDest = getEndPosition();
     setEndPosition(dest);
     setStartPosition(start);
@@ -98,7 +169,7 @@ bool PathInfo::calculate(Vector3 const& start, Vector3 dest, bool forceDest, boo
         }
         m_navMeshQuery = mmap->GetModelNavMeshQuery(m_transport->GetDisplayId());
     }
-    else if (!(m_navMeshQuery = mmap->GetNavMeshQuery(m_sourceUnit->GetMapId())))
+    else if (!(m_navMeshQuery = mmap->GetNavMeshQuery(m_owner.mapId)))
     {
         BuildPathWithoutMMaps(start, dest);
         return true;
@@ -111,7 +182,7 @@ bool PathInfo::calculate(Vector3 const& start, Vector3 dest, bool forceDest, boo
 
     // make sure navMesh works - we can run on map w/o mmap
     // check if the start and end point have a .mmtile loaded (can we pass via not loaded tile on the way?)
-    if (!m_navMesh || !m_navMeshQuery || m_sourceUnit->HasUnitState(UNIT_STATE_IGNORE_PATHFINDING) ||
+    if (!m_navMesh || !m_navMeshQuery || m_owner.ignorePathfinding ||
         !HaveTiles(start) || !HaveTiles(dest))
     {
         BuildShortcut();
@@ -123,7 +194,7 @@ bool PathInfo::calculate(Vector3 const& start, Vector3 dest, bool forceDest, boo
 
     // check if destination moved - if not we can optimize something here
     // we are following old, precalculated path?
-    float dist = m_sourceUnit->GetObjectBoundingRadius();
+    float dist = m_owner.boundingRadius;
     if (inRange(oldDest, dest, dist, dist) && m_pathPoints.size() > 2)
     {
         // our target is not moving - we just coming closer
@@ -181,11 +252,11 @@ dtPolyRef PathInfo::getPolyByLocation(float const* point, float *distance, uint3
 void PathInfo::BuildPolyPath(Vector3 const& startPos, Vector3 const& endPos)
 {
     // DEBUG: Log entry with coordinates (bots only)
-    if (IsPlayerBot(m_sourceUnit))
+    if (m_owner.isBot)
     {
         sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
             "[BOT] PathFinder::BuildPolyPath ENTER: %s from (%.1f,%.1f,%.1f) to (%.1f,%.1f,%.1f)",
-            m_sourceUnit->GetName(), startPos.x, startPos.y, startPos.z, endPos.x, endPos.y, endPos.z);
+            m_owner.name.c_str(), startPos.x, startPos.y, startPos.z, endPos.x, endPos.y, endPos.z);
     }
 
     // *** getting start/end poly logic ***
@@ -194,14 +265,14 @@ void PathInfo::BuildPolyPath(Vector3 const& startPos, Vector3 const& endPos)
     float startPoint[VERTEX_SIZE] = {startPos.y, startPos.z, startPos.x};
     float endPoint[VERTEX_SIZE] = {endPos.y, endPos.z, endPos.x};
 
-    bool const canSwimToDestination = m_sourceUnit->CanSwim() &&
-                                      m_sourceUnit->CanSwimAtPosition(startPos) &&
-                                      m_sourceUnit->CanSwimAtPosition(endPos);
+    bool const canSwimToDestination = m_owner.canSwim &&
+                                      m_owner.CanSwimAtPosition(startPos) &&
+                                      m_owner.CanSwimAtPosition(endPos);
 
     // First case : easy flying / swimming
-    if (canSwimToDestination || m_sourceUnit->CanFly())
+    if (canSwimToDestination || m_owner.canFly)
     {
-        if (!m_sourceUnit->GetMap()->FindCollisionModel(startPos.x, startPos.y, startPos.z, endPos.x, endPos.y, endPos.z))
+        if (!m_owner.map->FindCollisionModel(startPos.x, startPos.y, startPos.z, endPos.x, endPos.y, endPos.z))
         {
             if (canSwimToDestination)
                 BuildUnderwaterPath();
@@ -212,18 +283,18 @@ void PathInfo::BuildPolyPath(Vector3 const& startPos, Vector3 const& endPos)
             }
             return;
         }
-        else if (m_sourceUnit->CanFly())
+        else if (m_owner.canFly)
             m_forceDestination = true;
     }
     dtPolyRef startPoly = getPolyByLocation(startPoint, &distToStartPoly);
     dtPolyRef endPoly = getPolyByLocation(endPoint, &distToEndPoly, m_targetAllowedFlags);
 
     // DEBUG: Log poly lookup results (bots only)
-    if (IsPlayerBot(m_sourceUnit))
+    if (m_owner.isBot)
     {
         sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
             "[BOT] PathFinder::BuildPolyPath %s: startPoly=%u (dist=%.1f) endPoly=%u (dist=%.1f)",
-            m_sourceUnit->GetName(), startPoly, distToStartPoly, endPoly, distToEndPoly);
+            m_owner.name.c_str(), startPoly, distToStartPoly, endPoly, distToEndPoly);
     }
 
     // we have a hole in our mesh
@@ -231,11 +302,12 @@ void PathInfo::BuildPolyPath(Vector3 const& startPos, Vector3 const& endPos)
     // its up to caller how he will use this info
     if (startPoly == INVALID_POLYREF || endPoly == INVALID_POLYREF)
     {
-        if (IsPlayerBot(m_sourceUnit))
+        if (m_owner.isBot)
         {
             // Rate-limit error logging (10 seconds per bot)
-            uint32 botGuid = m_sourceUnit->GetGUIDLow();
+            uint32 botGuid = m_owner.guidLow;
             uint32 currentTime = WorldTimer::getMSTime();
+            std::lock_guard<std::mutex> guard(s_botInvalidPolyLogLock);
             auto it = s_botInvalidPolyLastLog.find(botGuid);
 
             if (it == s_botInvalidPolyLastLog.end() ||
@@ -250,20 +322,21 @@ void PathInfo::BuildPolyPath(Vector3 const& startPos, Vector3 const& endPos)
                 sLog.Out(LOG_BASIC, LOG_LVL_ERROR,
                     "[BOT] PathFinder::BuildPolyPath: Invalid poly - startPoly=%u endPoly=%u for %s "
                     "from (%.1f,%.1f,%.1f) to (%.1f,%.1f,%.1f) | Map=%u Zone=%u Area=%u dist=%.1f moving=%d inCombat=%d",
-                    startPoly, endPoly, m_sourceUnit->GetName(),
+                    startPoly, endPoly, m_owner.name.c_str(),
                     startPos.x, startPos.y, startPos.z, endPos.x, endPos.y, endPos.z,
-                    m_sourceUnit->GetMapId(), m_sourceUnit->GetZoneId(), m_sourceUnit->GetAreaId(),
-                    dist, m_sourceUnit->IsMoving() ? 1 : 0, m_sourceUnit->IsInCombat() ? 1 : 0);
+                    m_owner.mapId, m_owner.terrain->GetZoneId(m_owner.position.x, m_owner.position.y, m_owner.position.z),
+                    m_owner.terrain->GetAreaId(m_owner.position.x, m_owner.position.y, m_owner.position.z),
+                    dist, m_owner.moving ? 1 : 0, m_owner.inCombat ? 1 : 0);
                 s_botInvalidPolyLastLog[botGuid] = currentTime;
             }
         }
         BuildShortcut();
         // Check for swimming or flying shortcut
-        if ((startPoly == INVALID_POLYREF && m_sourceUnit->GetTerrain()->IsSwimmable(startPos.x, startPos.y, startPos.z)) ||
-            (endPoly == INVALID_POLYREF && m_sourceUnit->GetTerrain()->IsSwimmable(endPos.x, endPos.y, endPos.z)))
-            m_type = m_sourceUnit->CanSwim() ? PathType(PATHFIND_NORMAL | PATHFIND_NOT_USING_PATH) : PATHFIND_NOPATH;
+        if ((startPoly == INVALID_POLYREF && m_owner.terrain->IsSwimmable(startPos.x, startPos.y, startPos.z)) ||
+            (endPoly == INVALID_POLYREF && m_owner.terrain->IsSwimmable(endPos.x, endPos.y, endPos.z)))
+            m_type = m_owner.canSwim ? PathType(PATHFIND_NORMAL | PATHFIND_NOT_USING_PATH) : PATHFIND_NOPATH;
         else
-            m_type = (m_sourceUnit->GetTypeId() == TYPEID_UNIT && ((Creature*)m_sourceUnit)->CanFly())
+            m_type = (m_owner.typeId == TYPEID_UNIT && m_owner.canFly)
                      ? PathType(PATHFIND_NORMAL | PATHFIND_NOT_USING_PATH | PATHFIND_FLYPATH) : PATHFIND_NOPATH;
         return;
     }
@@ -280,7 +353,7 @@ void PathInfo::BuildPolyPath(Vector3 const& startPos, Vector3 const& endPos)
             return;
         }
 
-        if (m_sourceUnit->CanFly())
+        if (m_owner.canFly)
         {
             BuildShortcut();
             m_type = PathType(PATHFIND_NORMAL | PATHFIND_NOT_USING_PATH);
@@ -294,7 +367,7 @@ void PathInfo::BuildPolyPath(Vector3 const& startPos, Vector3 const& endPos)
             setActualEndPosition(Vector3(endPoint[2], endPoint[0], endPoint[1]));
         }
 
-        if (!(m_sourceUnit->CanSwim() && m_sourceUnit->CanSwimAtPosition(m_actualEndPosition)))
+        if (!(m_owner.canSwim && m_owner.CanSwimAtPosition(m_actualEndPosition)))
             m_type = PATHFIND_INCOMPLETE;
     }
 
@@ -405,7 +478,7 @@ void PathInfo::BuildPolyPath(Vector3 const& startPos, Vector3 const& endPos)
             // this is probably an error state, but we'll leave it
             // and hopefully recover on the next Update
             // we still need to copy our preffix
-            sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "%u's Path Build failed: 0 length path r=0x%x", m_sourceUnit->GetGUIDLow(), dtResult);
+            sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "%u's Path Build failed: 0 length path r=0x%x", m_owner.guidLow, dtResult);
         }
 
         //DEBUG_FILTER_LOG(LOG_FILTER_PATHFINDING, "++  m_polyLength=%u prefixPolyLength=%u suffixPolyLength=%u \n",m_polyLength, prefixPolyLength, suffixPolyLength);
@@ -425,11 +498,11 @@ void PathInfo::BuildPolyPath(Vector3 const& startPos, Vector3 const& endPos)
         clear();
 
         // DEBUG: Log before findPath (bots only)
-        if (IsPlayerBot(m_sourceUnit))
+        if (m_owner.isBot)
         {
             sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
                 "[BOT] PathFinder::BuildPolyPath %s: Calling findPath startPoly=%u endPoly=%u",
-                m_sourceUnit->GetName(), startPoly, endPoly);
+                m_owner.name.c_str(), startPoly, endPoly);
         }
 
         dtStatus dtResult = m_navMeshQuery->findPath(
@@ -443,21 +516,21 @@ void PathInfo::BuildPolyPath(Vector3 const& startPos, Vector3 const& endPos)
                                 MAX_PATH_LENGTH);   // max number of polygons in output path
 
         // DEBUG: Log findPath result (bots only)
-        if (IsPlayerBot(m_sourceUnit))
+        if (m_owner.isBot)
         {
             sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
                 "[BOT] PathFinder::BuildPolyPath %s: findPath result=0x%x polyLength=%u",
-                m_sourceUnit->GetName(), dtResult, m_polyLength);
+                m_owner.name.c_str(), dtResult, m_polyLength);
         }
 
         if (!m_polyLength || dtStatusFailed(dtResult))
         {
             // only happens if we passed bad data to findPath(), or navmesh is messed up
-            if (IsPlayerBot(m_sourceUnit))
+            if (m_owner.isBot)
             {
                 sLog.Out(LOG_BASIC, LOG_LVL_ERROR,
                     "[BOT] PathFinder::BuildPolyPath %s: findPath FAILED result=0x%x polyLength=%u - returning NOPATH",
-                    m_sourceUnit->GetName(), dtResult, m_polyLength);
+                    m_owner.name.c_str(), dtResult, m_polyLength);
             }
             BuildShortcut();
             m_type = PATHFIND_NOPATH;
@@ -472,11 +545,11 @@ void PathInfo::BuildPolyPath(Vector3 const& startPos, Vector3 const& endPos)
         m_type = PATHFIND_INCOMPLETE;
 
     // DEBUG: Log before BuildPointPath (bots only)
-    if (IsPlayerBot(m_sourceUnit))
+    if (m_owner.isBot)
     {
         sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
             "[BOT] PathFinder::BuildPolyPath %s: Success so far, polyLength=%u type=%u, calling BuildPointPath",
-            m_sourceUnit->GetName(), m_polyLength, m_type);
+            m_owner.name.c_str(), m_polyLength, m_type);
     }
 
     BuildPointPath(startPoint, endPoint, distToStartPoly, distToEndPoly);
@@ -485,11 +558,11 @@ void PathInfo::BuildPolyPath(Vector3 const& startPos, Vector3 const& endPos)
 void PathInfo::BuildPointPath(float const* startPoint, float const* endPoint, float distToStartPoly, float distToEndPoly)
 {
     // DEBUG: Log entry (bots only)
-    if (IsPlayerBot(m_sourceUnit))
+    if (m_owner.isBot)
     {
         sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
             "[BOT] PathFinder::BuildPointPath ENTER: %s polyLength=%u useStraight=%d",
-            m_sourceUnit->GetName(), m_polyLength, m_useStraightPath);
+            m_owner.name.c_str(), m_polyLength, m_useStraightPath);
     }
 
     // generate the point-path out of our up-to-date poly-path
@@ -522,21 +595,21 @@ void PathInfo::BuildPointPath(float const* startPoint, float const* endPoint, fl
     }
 
     // DEBUG: Log smoothPath/straightPath result (bots only)
-    if (IsPlayerBot(m_sourceUnit))
+    if (m_owner.isBot)
     {
         sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
             "[BOT] PathFinder::BuildPointPath %s: result=0x%x pointCount=%u",
-            m_sourceUnit->GetName(), dtResult, pointCount);
+            m_owner.name.c_str(), dtResult, pointCount);
     }
 
     // True pathfinding failure
     if (dtStatusFailed(dtResult))
     {
-        if (IsPlayerBot(m_sourceUnit))
+        if (m_owner.isBot)
         {
             sLog.Out(LOG_BASIC, LOG_LVL_ERROR,
                 "[BOT] PathFinder::BuildPointPath %s: FAILED result=0x%x pointCount=%u polyLength=%u - returning NOPATH",
-                m_sourceUnit->GetName(), dtResult, pointCount, m_polyLength);
+                m_owner.name.c_str(), dtResult, pointCount, m_polyLength);
         }
         BuildShortcut();
         m_type = PATHFIND_NOPATH;
@@ -561,7 +634,7 @@ void PathInfo::BuildPointPath(float const* startPoint, float const* endPoint, fl
     for (uint32 i = 0; i < pointCount; ++i)
     {
         Vector3 p = Vector3(pathPoints[i * VERTEX_SIZE + 2], pathPoints[i * VERTEX_SIZE], pathPoints[i * VERTEX_SIZE + 1]);
-        m_sourceUnit->UpdateAllowedPositionZ(p.x, p.y, p.z);
+        m_owner.UpdateAllowedPositionZ(p.x, p.y, p.z);
         m_pathPoints[i] = p;
     }
 
@@ -587,7 +660,7 @@ void PathInfo::BuildPointPath(float const* startPoint, float const* endPoint, fl
 
         
         m_type |= PATHFIND_DEST_FORCED;
-        if (m_sourceUnit->CanFly())
+        if (m_owner.canFly)
             m_type |= PATHFIND_FLYPATH;
     }
 
@@ -606,7 +679,7 @@ void PathInfo::BuildShortcut()
     m_pathPoints[1] = getActualEndPosition();
 
     m_type = PATHFIND_SHORTCUT;
-    if (m_sourceUnit->CanFly())
+    if (m_owner.canFly)
         m_type |= PATHFIND_FLYPATH | PATHFIND_NORMAL;
 }
 
@@ -622,16 +695,16 @@ void PathInfo::BuildUnderwaterPath()
     m_pathPoints[1] = getActualEndPosition();
 
     GridMapLiquidData liquidData;
-    uint32 liquidStatus = m_sourceUnit->GetTerrain()->getLiquidStatus(getActualEndPosition().x, getActualEndPosition().y, getActualEndPosition().z, MAP_ALL_LIQUIDS, &liquidData);
+    uint32 liquidStatus = m_owner.terrain->getLiquidStatus(getActualEndPosition().x, getActualEndPosition().y, getActualEndPosition().z, MAP_ALL_LIQUIDS, &liquidData);
     // No water here ...
     if (liquidStatus == LIQUID_MAP_NO_WATER)
     {
         m_type = PATHFIND_SHORTCUT;
-        if (m_sourceUnit->CanWalk())
+        if (m_owner.canWalk)
         {
             // Find real height
             m_type |= PATHFIND_NORMAL;
-            m_sourceUnit->UpdateGroundPositionZ(m_pathPoints[1].x, m_pathPoints[1].y, m_pathPoints[1].z);
+            m_owner.UpdateGroundPositionZ(m_pathPoints[1].x, m_pathPoints[1].y, m_pathPoints[1].z);
         }
         else
         {
@@ -643,7 +716,7 @@ void PathInfo::BuildUnderwaterPath()
     m_type = PATHFIND_BLANK;
     if (m_pathPoints[1].z > liquidData.level)
     {
-        if (!m_sourceUnit->CanFly())
+        if (!m_owner.canFly)
         {
             m_pathPoints[1].z = liquidData.level;
             if (m_pathPoints[1].z > (liquidData.level + 2))
@@ -721,22 +794,22 @@ bool BuildPathStep(Vector3 const& currentPos, Vector3 const& targetPos, Map cons
 
 void PathInfo::BuildPathWithoutMMaps(Vector3 const& start, Vector3 const& dest)
 {
-    bool const destInWater = m_sourceUnit->CanSwimAtPosition(dest);
+    bool const destInWater = m_owner.CanSwimAtPosition(dest);
 
-    if (!m_sourceUnit->CanSwim() && destInWater)
+    if (!m_owner.canSwim && destInWater)
     {
         BuildShortcut();
         m_type = PathType(PATHFIND_NOPATH);
         return;
     }
 
-    if (m_sourceUnit->CanFly())
+    if (m_owner.canFly)
     {
         BuildShortcut();
         return;
     }
 
-    if (!m_sourceUnit->CanWalk() && !destInWater)
+    if (!m_owner.canWalk && !destInWater)
     {
         BuildShortcut();
         m_type = PathType(PATHFIND_NOPATH);
@@ -745,7 +818,7 @@ void PathInfo::BuildPathWithoutMMaps(Vector3 const& start, Vector3 const& dest)
 
     float totalDistance = Geometry::GetDistance3D(start, dest);
     if (totalDistance <= STEP_SIZE ||
-        (m_sourceUnit->CanSwim() && destInWater && m_sourceUnit->CanSwimAtPosition(start)))
+        (m_owner.canSwim && destInWater && m_owner.CanSwimAtPosition(start)))
     {
         BuildShortcut();
         m_type |= PATHFIND_NORMAL;
@@ -762,7 +835,7 @@ void PathInfo::BuildPathWithoutMMaps(Vector3 const& start, Vector3 const& dest)
 
     maxSteps *= 2;
 
-    if (BuildPathStep(dest, start, m_sourceUnit->FindMap(), m_pathPoints, checkedPositions, maxSteps, Geometry::GetAngle(start, dest)))
+    if (BuildPathStep(dest, start, m_owner.map, m_pathPoints, checkedPositions, maxSteps, Geometry::GetAngle(start, dest)))
     {
         m_pathPoints.push_back(dest);
         m_type = PathType(PATHFIND_NORMAL);
@@ -779,12 +852,12 @@ void PathInfo::createFilter()
     unsigned short includeFlags = 0x0;
     unsigned short excludeFlags = 0x0;
 
-    if (m_sourceUnit->CanWalk())
+    if (m_owner.canWalk)
         includeFlags |= NAV_GROUND;          // walk
 
-    if (m_sourceUnit->CanSwim())
+    if (m_owner.canSwim)
     {
-        if (m_sourceUnit->GetTypeId() == TYPEID_PLAYER)
+        if (m_owner.typeId == TYPEID_PLAYER)
             includeFlags |= NAV_WATER;
         else // creatures don't take environmental damage
             includeFlags |= (NAV_WATER | NAV_MAGMA | NAV_SLIME);
@@ -1052,7 +1125,7 @@ dtStatus PathInfo::findSmoothPath(float const* startPos, float const* endPos,
         npolys = fixupShortcuts(polys, npolys, m_navMeshQuery);
 
         if (dtStatusFailed(m_navMeshQuery->getPolyHeight(polys[0], result, &result[1])))
-            sLog.Out(LOG_BASIC, LOG_LVL_DEBUG, "Cannot find height at position X: %f Y: %f Z: %f for %s", result[2], result[0], result[1], m_sourceUnit->GetName());
+            sLog.Out(LOG_BASIC, LOG_LVL_DEBUG, "Cannot find height at position X: %f Y: %f Z: %f for %s", result[2], result[0], result[1], m_owner.name.c_str());
         result[1] += 0.5f;
         dtVcopy(iterPos, result);
 
@@ -1230,7 +1303,7 @@ void PathInfo::CutPathWithDynamicLoS()
     Vector3 out;
     // We have always keep at least 2 points (else, there is no mvt !)
     for (uint32 i = 1; i <= maxIndex; ++i)
-        if (m_sourceUnit->GetMap()->GetDynamicObjectHitPos(m_pathPoints[i - 1], m_pathPoints[i], out, -0.1f))
+        if (m_owner.map->GetDynamicObjectHitPos(m_pathPoints[i - 1], m_pathPoints[i], out, -0.1f))
         {
             m_pathPoints[i] = out;
             m_pathPoints.resize(i + 1);
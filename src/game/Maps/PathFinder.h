@@ -30,6 +30,8 @@ using Movement::Vector3;
 using Movement::PointsArray;
 
 class Unit;
+class Map;
+class TerrainInfo;
 class GenericTransport;
 struct GridMapLiquidData;
 
@@ -56,10 +58,44 @@ enum PathType
     PATHFIND_CASTER         = 0x0100,
 };
 
+// What a path needs to know about the unit walking it. Taken on the map
+// thread, so a path can be built on another thread while the unit changes.
+struct PathOwnerState
+{
+    PathOwnerState() = default;
+    explicit PathOwnerState(Unit const* owner);
+
+    bool CanSwimAtPosition(Vector3 const& pos) const;
+    void UpdateAllowedPositionZ(float x, float y, float &z) const;
+    void UpdateGroundPositionZ(float x, float y, float &z) const;
+
+    Map* map = nullptr;
+    TerrainInfo const* terrain = nullptr;
+    Vector3 position;
+    std::string name;                   // bots only, for the debug logs
+    uint32 guidLow = 0;
+    uint32 mapId = 0;
+    float boundingRadius = 0.0f;
+    float minSwimDepth = 0.0f;
+    uint8 typeId = 0;
+    bool isBot = false;
+    bool canWalk = false;
+    bool canSwim = false;
+    bool canFly = false;
+    bool ignorePathfinding = false;
+    bool onTransport = false;
+    bool waterWalk = false;
+    bool moving = false;
+    bool inCombat = false;
+};
+
 class PathInfo
 {
     public:
         PathInfo(Unit const* owner);
+        // Detached from the unit, for paths built off the map thread.
+        // UpdateForCaster, UpdateForMelee and calculate(x, y, z) need the unit.
+        explicit PathInfo(PathOwnerState const& owner);
         ~PathInfo();
 
         // return value : true if new path was calculated
@@ -106,7 +142,8 @@ class PathInfo
         Vector3        m_endPosition;      // {x, y, z} of the destination
         Vector3        m_actualEndPosition;  // {x, y, z} of the closest possible point to given destination
         GenericTransport*       m_transport;
-        Unit const* const       m_sourceUnit;       // the unit that is moving
+        Unit const* const       m_sourceUnit;       // the unit that is moving, null when detached
+        PathOwnerState          m_owner;            // its state, refreshed on each calculate when attached
         dtNavMesh const*        m_navMesh;          // the nav mesh
         dtNavMeshQuery const*   m_navMeshQuery;     // the nav mesh query used to find the path
         uint32          m_targetAllowedFlags;
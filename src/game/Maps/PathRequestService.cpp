@@ -0,0 +1,237 @@
+/*
+* This program is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation; either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program; if not, write to the Free Software
+* Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#include "PathRequestService.h"
+#include "PathCache.h"
+#include "Unit.h"
+#include "Timer.h"
+
+#include <algorithm>
+
+std::atomic<PathTicket> PathRequestService::s_nextTicket(1);
+
+PathRequestService::PathRequestService(uint32 numTasks, PathCache* cache) : m_numTasks(numTasks), m_cache(cache)
+{
+}
+
+PathRequestService::~PathRequestService()
+{
+    WaitForCompletion();
+}
+
+PathTicket PathRequestService::Submit(Unit const* owner, Vector3 const& start, Vector3 const& dest)
+{
+    if (!owner)
+        return 0;
+
+    PathTicket ticket = s_nextTicket++;
+    if (!ticket)                                        // skip 0 on wrap-around
+        ticket = s_nextTicket++;
+
+    Job job;
+    job.ticket = ticket;
+    job.owner = owner;
+    job.start = start;
+    job.dest = dest;
+    job.cacheable = m_cache && owner->GetTypeId() == TYPEID_PLAYER;
+
+    if (job.cacheable && m_cache->Find(start, dest, job.result))
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        ReadyResult& ready = m_ready[ticket];
+        ready.result = std::move(job.result);
+        ready.deliveredTime = WorldTimer::getMSTime();
+        ++m_submitted;
+        ++m_completed;
+        return ticket;
+    }
+
+    job.ownerState = PathOwnerState(owner);
+
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_queued.push_back(std::move(job));
+    ++m_submitted;
+    return ticket;
+}
+
+PathRequestStatus PathRequestService::Poll(PathTicket ticket, PathRequestResult& result)
+{
+    if (!ticket)
+        return PathRequestStatus::UNKNOWN;
+
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    auto itr = m_ready.find(ticket);
+    if (itr != m_ready.end())
+    {
+        result = std::move(itr->second.result);
+        m_ready.erase(itr);
+        return PathRequestStatus::READY;
+    }
+
+    auto matches = [ticket](Job const& job) { return job.ticket == ticket; };
+    if (std::any_of(m_queued.begin(), m_queued.end(), matches))
+        return PathRequestStatus::PENDING;
+
+    if (!m_cancelledInFlight.count(ticket) && std::any_of(m_inFlight.begin(), m_inFlight.end(), matches))
+        return PathRequestStatus::PENDING;
+
+    return PathRequestStatus::UNKNOWN;
+}
+
+void PathRequestService::Cancel(PathTicket ticket)
+{
+    if (!ticket)
+        return;
+
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    if (m_ready.erase(ticket))
+        return;
+
+    auto matches = [ticket](Job const& job) { return job.ticket == ticket; };
+    auto queuedItr = std::find_if(m_queued.begin(), m_queued.end(), matches);
+    if (queuedItr != m_queued.end())
+    {
+        m_queued.erase(queuedItr);
+        return;
+    }
+
+    // Workers own the in-flight jobs, drop the result at delivery instead
+    if (std::any_of(m_inFlight.begin(), m_inFlight.end(), matches))
+        m_cancelledInFlight.insert(ticket);
+}
+
+void PathRequestService::ForgetOwner(WorldObject const* owner)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    if (!m_queued.empty())
+    {
+        m_queued.erase(std::remove_if(m_queued.begin(), m_queued.end(),
+            [owner](Job const& job) { return job.owner == owner; }), m_queued.end());
+    }
+
+    // Workers only use the owner's snapshot, drop the result at delivery
+    for (Job const& job : m_inFlight)
+    {
+        if (job.owner == owner)
+            m_cancelledInFlight.insert(job.ticket);
+    }
+}
+
+void PathRequestService::DeliverResults()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    uint32 const now = WorldTimer::getMSTime();
+
+    // Forget results their owner never came back for
+    for (auto itr = m_ready.begin(); itr != m_ready.end();)
+    {
+        if (WorldTimer::getMSTimeDiff(itr->second.deliveredTime, now) > RESULT_EXPIRY_MS)
+            itr = m_ready.erase(itr);
+        else
+            ++itr;
+    }
+
+    if (m_inFlight.empty())
+        return;
+
+    WaitForBatch();
+
+    for (Job& job : m_inFlight)
+    {
+        ++m_completed;
+        if (job.cacheable)
+            m_cache->Store(job.start, job.dest, job.result);
+
+        if (m_cancelledInFlight.count(job.ticket))
+            continue;
+
+        ReadyResult& ready = m_ready[job.ticket];
+        ready.result = std::move(job.result);
+        ready.deliveredTime = now;
+    }
+
+    m_inFlight.clear();
+    m_cancelledInFlight.clear();
+}
+
+void PathRequestService::Dispatch()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    // Previous batch not delivered yet, keep the queue for the next tick
+    if (m_queued.empty() || !m_inFlight.empty())
+        return;
+
+    m_inFlight.swap(m_queued);
+
+    if (!m_numTasks)
+    {
+        for (Job& job : m_inFlight)
+            Compute(job);
+        return;
+    }
+
+    // m_inFlight is not touched again until the batch has finished
+    std::vector<Job>* jobs = &m_inFlight;
+    uint32 const numTasks = std::min<uint32>(m_numTasks, m_inFlight.size());
+    for (uint32 first = 0; first < numTasks; ++first)
+    {
+        m_batch.Run([jobs, first, numTasks]()
+        {
+            for (size_t i = first; i < jobs->size(); i += numTasks)
+                Compute((*jobs)[i]);
+        });
+    }
+}
+
+void PathRequestService::WaitForCompletion()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    WaitForBatch();
+}
+
+void PathRequestService::WaitForBatch()
+{
+    // Runs the tasks no scheduler thread took yet
+    m_batch.Wait();
+}
+
+void PathRequestService::Compute(Job& job)
+{
+    PathInfo path(job.ownerState);
+    path.calculate(job.start, job.dest);
+
+    job.result.type = path.getPathType();
+    job.result.path = path.getPath();
+    job.result.actualEnd = path.getActualEndPosition();
+    job.result.length = path.Length();
+}
+
+uint32 PathRequestService::GetQueuedCount() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return uint32(m_queued.size() + m_inFlight.size());
+}
+
+uint32 PathRequestService::GetReadyCount() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return uint32(m_ready.size());
+}
@@ -0,0 +1,143 @@
+/*
+* This program is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation; either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program; if not, write to the Free Software
+* Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#ifndef MANGOS_PATH_REQUEST_SERVICE_H
+#define MANGOS_PATH_REQUEST_SERVICE_H
+
+#include "Common.h"
+#include "PathFinder.h"
+#include "TaskScheduler.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class PathCache;
+class Unit;
+class WorldObject;
+
+// Handle to a submitted path request. 0 is never a valid ticket.
+typedef uint32 PathTicket;
+
+enum class PathRequestStatus : uint8
+{
+    PENDING,    // queued or being computed, poll again next tick
+    READY,      // result filled in and consumed
+    UNKNOWN     // never submitted on this map, cancelled or expired
+};
+
+struct PathRequestResult
+{
+    PathType type = PATHFIND_BLANK;
+    PointsArray path;
+    Vector3 actualEnd;
+    float length = 0.0f;
+};
+
+/**
+ * Asynchronous path computation for one map.
+ *
+ * Requests submitted during a map tick are split into numTasks tasks on the
+ * map update scheduler when the tick ends, and become readable at the start
+ * of the next tick, so a caller waits one tick instead of stalling the map
+ * thread on Detour queries. Each scheduler thread gets its own
+ * dtNavMeshQuery from MMapManager.
+ *
+ * Workers never touch the owner: Submit copies the state the path depends on
+ * (PathOwnerState). Map::Remove calls ForgetOwner() so requests of an owner
+ * leaving the map are dropped.
+ *
+ * With 0 tasks, or a scheduler without workers, queued requests are computed
+ * on the map thread at the end of the tick, with the same next-tick delivery.
+ *
+ * Player paths are looked up in the map's PathCache first (a hit is READY
+ * right away) and stored there when computed.
+ */
+class PathRequestService
+{
+    public:
+        PathRequestService(uint32 numTasks, PathCache* cache);
+        ~PathRequestService();
+
+        // Map thread: queue a path for owner from start to dest
+        PathTicket Submit(Unit const* owner, Vector3 const& start, Vector3 const& dest);
+
+        // Map thread: on READY, result is moved out and the ticket is released
+        PathRequestStatus Poll(PathTicket ticket, PathRequestResult& result);
+
+        // Drop a request at any stage. Safe to call on unknown tickets.
+        void Cancel(PathTicket ticket);
+
+        // Drop all requests of an owner leaving the map
+        void ForgetOwner(WorldObject const* owner);
+
+        // Map::Update hooks
+        void DeliverResults();      // start of tick
+        void Dispatch();            // end of tick
+
+        // Block until the in-flight batch is done
+        void WaitForCompletion();
+
+        // Stats
+        uint32 GetQueuedCount() const;
+        uint32 GetReadyCount() const;
+        uint64 GetSubmittedCount() const { return m_submitted; }
+        uint64 GetCompletedCount() const { return m_completed; }
+
+    private:
+        struct Job
+        {
+            PathTicket ticket;
+            Unit const* owner;                          // only compared, never read by workers
+            PathOwnerState ownerState;
+            Vector3 start;
+            Vector3 dest;
+            bool cacheable;
+            PathRequestResult result;
+        };
+
+        struct ReadyResult
+        {
+            PathRequestResult result;
+            uint32 deliveredTime;
+        };
+
+        static void Compute(Job& job);
+        void WaitForBatch();
+
+        mutable std::mutex m_lock;
+        std::vector<Job> m_queued;
+        std::vector<Job> m_inFlight;                    // owned by the tasks until DeliverResults
+        TaskGroup m_batch;
+        std::unordered_set<PathTicket> m_cancelledInFlight;
+        std::unordered_map<PathTicket, ReadyResult> m_ready;
+
+        uint32 m_numTasks;
+        PathCache* m_cache;
+
+        uint64 m_submitted = 0;
+        uint64 m_completed = 0;
+
+        static std::atomic<PathTicket> s_nextTicket;
+
+        // Results nobody polled for this long are dropped
+        static constexpr uint32 RESULT_EXPIRY_MS = 30000;
+};
+
+#endif
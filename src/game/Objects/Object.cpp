@@ -269,7 +269,7 @@ void Object::BuildMovementUpdateBlock(UpdateData& data, uint8 flags) const
 
 void Object::BuildCreateUpdateBlockForPlayer(UpdateData& data, Player* target) const
 {
-    if (!target)
+    if (!target || target->IsHeadlessViewer())
         return;
 
     uint8 updatetype   = UPDATETYPE_CREATE_OBJECT;
@@ -403,6 +403,9 @@ void WorldObject::DirectSendPublicValueUpdate(UpdateMask& updateMask)
 
 void Object::BuildValuesUpdateBlockForPlayer(UpdateData& data, Player* target) const
 {
+    if (target && target->IsHeadlessViewer())
+        return;
+
     UpdateMask updateMask;
     updateMask.SetCount(m_valuesCount);
 
@@ -413,6 +416,9 @@ void Object::BuildValuesUpdateBlockForPlayer(UpdateData& data, Player* target) c
 
 void Object::BuildValuesUpdateBlockForPlayerWithFlags(UpdateData& data, Player* target, UpdateFieldFlags flags, bool includingEmpty) const
 {
+    if (target && target->IsHeadlessViewer())
+        return;
+
     UpdateMask updateMask;
     updateMask.SetCount(GetValuesCount());
     MarkUpdateFieldsWithFlagForUpdate(updateMask, (uint16)flags, includingEmpty);
@@ -422,6 +428,9 @@ void Object::BuildValuesUpdateBlockForPlayerWithFlags(UpdateData& data, Player*
 
 void Object::BuildValuesUpdateBlockForPlayer(UpdateData& data, UpdateMask& updateMask, Player* target) const
 {
+    if (target && target->IsHeadlessViewer())
+        return;
+
     ByteBuffer& buf = data.AddUpdateBlockAndGetBuffer();
 
     buf << uint8(UPDATETYPE_VALUES);
@@ -1339,6 +1348,10 @@ bool Object::PrintIndexError(uint32 index, bool set) const
 
 void Object::BuildUpdateDataForPlayer(Player* pl, UpdateDataMapType& update_players)
 {
+    // Headless bot viewers never receive update blocks
+    if (pl->IsHeadlessViewer())
+        return;
+
     UpdateDataMapType::iterator iter = update_players.find(pl);
 
     if (iter == update_players.end())
@@ -74,6 +74,7 @@
 #include "ZoneScriptMgr.h"
 #include "PlayerBotMgr.h"
 #include "PlayerBotAI.h"
+#include "BotEvents.h"
 #include "AccountMgr.h"
 #include "Anticheat.h"
 #include "MovementBroadcaster.h"
@@ -107,8 +108,19 @@ static uint32 copseReclaimDelay[MAX_DEATH_COUNT] = { 30, 60, 120 };
 
 //== Player ====================================================
 
+// Order-dependent fingerprint of the rows of a save section
+static void HashCombineForSave(uint64& seed, uint64 value)
+{
+    seed ^= std::hash<uint64>()(value) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+// Fingerprint of a section not written since login. An empty section hashes
+// to 0, so starting at 0 would skip deleting the rows of the last aura or
+// cooldown that went away.
+static constexpr uint64 SAVE_HASH_NOT_SAVED = ~uint64(0);
+
 Player::Player(WorldSession* session) : Unit(),
-    m_mover(this), m_camera(this), m_reputationMgr(this), m_saveDisabled(false), m_enableInstanceSwitch(true),
+    m_mover(this), m_camera(this), m_reputationMgr(this), m_saveDisabled(false), m_dbAccountId(0), m_savedAurasHash(SAVE_HASH_NOT_SAVED), m_savedCooldownsHash(SAVE_HASH_NOT_SAVED), m_enableInstanceSwitch(true),
     m_currentTicketCounter(0), m_repopAtGraveyardPending(false), m_knownLanguagesMask(0),
     m_honorMgr(this), m_personalXpRate(-1.0f), m_isStandUpScheduled(false), m_foodEmoteTimer(0)
 {
@@ -1258,9 +1270,18 @@ void Player::Update(uint32 update_diff, uint32 p_time)
     {
         if (update_diff >= m_nextSave)
         {
-            // m_nextSave reseted in SaveToDB call
-            SaveToDB();
-            sLog.Out(LOG_BASIC, LOG_LVL_DETAIL, "Player '%s' (GUID: %u) saved", GetName(), GetGUIDLow());
+            if (IsBot() && sPlayerBotMgr.IsAsyncSaveEnabled())
+            {
+                // Saved with the other bots of the map at the end of the tick
+                m_nextSave = sPlayerBotMgr.GetSaveInterval();
+                GetMap()->QueueBotSave(this);
+            }
+            else
+            {
+                // m_nextSave reseted in SaveToDB call
+                SaveToDB();
+                sLog.Out(LOG_BASIC, LOG_LVL_DETAIL, "Player '%s' (GUID: %u) saved", GetName(), GetGUIDLow());
+            }
         }
         else
             m_nextSave -= update_diff;
@@ -3634,10 +3655,13 @@ bool Player::AddSpell(uint32 spellId, bool active, bool learning, bool dependent
                 if (next_active_spell_id)
                 {
                     // update spell ranks in spellbook and action bar
-                    WorldPacket data(SMSG_SUPERCEDED_SPELL, (4));
-                    data << uint16(spellId);
-                    data << uint16(next_active_spell_id);
-                    GetSession()->SendPacket(&data);
+                    if (!GetSession()->PostBotEvent(BotEvent(BOT_EVENT_SPELLS_CHANGED)))
+                    {
+                        WorldPacket data(SMSG_SUPERCEDED_SPELL, (4));
+                        data << uint16(spellId);
+                        data << uint16(next_active_spell_id);
+                        GetSession()->SendPacket(&data);
+                    }
                 }
                 else
                     SendSpellRemoved(spellId);
@@ -3728,7 +3752,8 @@ bool Player::AddSpell(uint32 spellId, bool active, bool learning, bool dependent
                     {
                         if (nextId == spellId)
                         {
-                            if (IsInWorld())                // not send spell (re-/over-)learn packets at loading
+                            if (IsInWorld() &&              // not send spell (re-/over-)learn packets at loading
+                               !GetSession()->PostBotEvent(BotEvent(BOT_EVENT_SPELLS_CHANGED)))
                             {
                                 WorldPacket data(SMSG_SUPERCEDED_SPELL, (4));
                                 data << uint16(m_spell.first);
@@ -3744,7 +3769,8 @@ bool Player::AddSpell(uint32 spellId, bool active, bool learning, bool dependent
                         }
                         else if (m_spell.first == spellId)
                         {
-                            if (IsInWorld())                // not send spell (re-/over-)learn packets at loading
+                            if (IsInWorld() &&              // not send spell (re-/over-)learn packets at loading
+                               !GetSession()->PostBotEvent(BotEvent(BOT_EVENT_SPELLS_CHANGED)))
                             {
                                 WorldPacket data(SMSG_SUPERCEDED_SPELL, (4));
                                 data << uint16(spellId);
@@ -3853,7 +3879,7 @@ void Player::LearnSpell(uint32 spellId, bool dependent, bool talent)
     bool learning = AddSpell(spellId, active, true, dependent, false);
 
     // prevent duplicated entires in spell book, also not send if not in world (loading)
-    if (learning && IsInWorld())
+    if (learning && IsInWorld() && !GetSession()->PostBotEvent(BotEvent(BOT_EVENT_SPELLS_CHANGED)))
     {
         WorldPacket data(SMSG_LEARNED_SPELL, 4);
         data << uint32(spellId);
@@ -3989,10 +4015,13 @@ void Player::RemoveSpell(uint32 spellId, bool disabled, bool learnLowRank)
                     if (AddSpell(previousId, true, false, spell.dependent, spell.disabled))
                     {
                         // downgrade spell ranks in spellbook and action bar
-                        WorldPacket data(SMSG_SUPERCEDED_SPELL, 4);
-                        data << uint16(spellId);
-                        data << uint16(previousId);
-                        GetSession()->SendPacket(&data);
+                        if (!GetSession()->PostBotEvent(BotEvent(BOT_EVENT_SPELLS_CHANGED)))
+                        {
+                            WorldPacket data(SMSG_SUPERCEDED_SPELL, 4);
+                            data << uint16(spellId);
+                            data << uint16(previousId);
+                            GetSession()->SendPacket(&data);
+                        }
                         previousActivated = true;
                     }
                 }
@@ -4070,15 +4099,11 @@ void Player::_LoadSpellCooldowns(std::unique_ptr<QueryResult> result)
     }
 }
 
-void Player::_SaveSpellCooldowns() const
+void Player::_SaveSpellCooldowns(bool incremental)
 {
-    static SqlStatementID deleteSpellCooldown;
-
-    // delete all old cooldown
-    SqlStatement stmt = CharacterDatabase.CreateStatement(deleteSpellCooldown, "DELETE FROM `character_spell_cooldown` WHERE `guid` = ?");
-    stmt.PExecute(GetGUIDLow());
-
-    static SqlStatementID insertSpellCooldown;
+    std::ostringstream ss;
+    uint64 hash = 0;
+    uint32 count = 0;
 
     for (auto& cdItr : m_cooldownMap)
     {
@@ -4092,16 +4117,32 @@ void Player::_SaveSpellCooldowns() const
             uint64 spellExpireTime = uint64(Clock::to_time_t(sTime));
             uint64 catExpireTime = uint64(Clock::to_time_t(cTime));
 
-            stmt = CharacterDatabase.CreateStatement(insertSpellCooldown, "INSERT INTO `character_spell_cooldown` (`guid`, `spell`, `spell_expire_time`, `category`, `category_expire_time`, `item_id`) VALUES( ?, ?, ?, ?, ?, ?)");
-            stmt.addUInt32(GetGUIDLow());
-            stmt.addUInt32(cdData->GetSpellId());
-            stmt.addUInt64(spellExpireTime);
-            stmt.addUInt32(cdData->GetCategory());
-            stmt.addUInt64(catExpireTime);
-            stmt.addUInt32(cdData->GetItemId());
-            stmt.Execute();
+            HashCombineForSave(hash, cdData->GetSpellId());
+            HashCombineForSave(hash, spellExpireTime);
+            HashCombineForSave(hash, cdData->GetCategory());
+            HashCombineForSave(hash, catExpireTime);
+            HashCombineForSave(hash, cdData->GetItemId());
+
+            ss << (count++ ? ", (" : "(") << GetGUIDLow() << ", " << cdData->GetSpellId() << ", " << spellExpireTime << ", "
+               << cdData->GetCategory() << ", " << catExpireTime << ", " << cdData->GetItemId() << ")";
         }
     }
+
+    if (incremental && hash == m_savedCooldownsHash)
+        return;
+    m_savedCooldownsHash = hash;
+
+    static SqlStatementID deleteSpellCooldown;
+
+    // delete all old cooldown
+    SqlStatement stmt = CharacterDatabase.CreateStatement(deleteSpellCooldown, "DELETE FROM `character_spell_cooldown` WHERE `guid` = ?");
+    stmt.PExecute(GetGUIDLow());
+
+    if (!count)
+        return;
+
+    std::string const query = "INSERT INTO `character_spell_cooldown` (`guid`, `spell`, `spell_expire_time`, `category`, `category_expire_time`, `item_id`) VALUES " + ss.str();
+    CharacterDatabase.Execute(query.c_str());
 }
 
 void Player::UpdateResetTalentsMultiplier() const
@@ -14720,6 +14761,7 @@ bool Player::LoadFromDB(ObjectGuid guid, SqlQueryHolder* holder)
     MANGOS_ASSERT(lowGuid == guid.GetCounter());
 
     uint32 dbAccountId = fields[1].GetUInt32();
+    m_dbAccountId = dbAccountId;
 
     // check if the character's account in the db and the logged in account match.
     // player should be able to load/delete character only with correct account!
@@ -16468,24 +16510,67 @@ void Player::UpdateCharacterFlags()
 }
 
 void Player::SaveToDB(bool online, bool force)
+{
+    if (!_PrepareSave(force))
+        return;
+
+    CharacterDatabase.BeginTransaction(GetGUIDLow());
+    _SaveCharacter(online, false);
+    CharacterDatabase.CommitTransaction();
+
+    _FinishSave(true);
+}
+
+void Player::SaveBotsToDB(std::vector<Player*> const& bots)
+{
+    // A transaction is queued on the serial worker of its serial id. Bots are grouped
+    // by worker so each one stays ordered with its own serialized saves (trades, mail...)
+    uint32 const workers = std::max(CharacterDatabase.GetSerialWorkerCount(), 1u);
+
+    std::map<uint32, std::vector<Player*>> groups;
+    for (Player* pBot : bots)
+    {
+        if (pBot->_PrepareSave(false))
+            groups[pBot->GetGUIDLow() % workers].push_back(pBot);
+    }
+
+    for (auto const& group : groups)
+    {
+        CharacterDatabase.BeginTransaction(group.second.front()->GetGUIDLow());
+        for (Player* pBot : group.second)
+            pBot->_SaveCharacter(true, true);
+        CharacterDatabase.CommitTransaction();
+    }
+
+    for (auto const& group : groups)
+        for (Player* pBot : group.second)
+            pBot->_FinishSave(false);
+}
+
+bool Player::_PrepareSave(bool force)
 {
     // we should assure this: ASSERT((m_nextSave != sWorld.getConfig(CONFIG_UINT32_INTERVAL_SAVE)));
     // delay auto save at any saves (manual, in code, or autosave)
-    m_nextSave = sWorld.getConfig(CONFIG_UINT32_INTERVAL_SAVE);
+    m_nextSave = IsBot() ? sPlayerBotMgr.GetSaveInterval() : sWorld.getConfig(CONFIG_UINT32_INTERVAL_SAVE);
 
     // Do not save bots
     if (IsSavingDisabled())
-        return;
+        return false;
 
     // lets allow only players in world to be saved
     if (!force && IsBeingTeleportedFar())
     {
         ScheduleDelayedOperation(DELAYED_SAVE_PLAYER);
-        return;
+        return false;
     }
 
-    CharacterDatabase.BeginTransaction(GetGUIDLow());
+    return true;
+}
 
+// Everything written inside the save transaction.
+// Incremental saves skip the sections that did not change since they were last written.
+void Player::_SaveCharacter(bool online, bool incremental)
+{
     m_honorMgr.Update();
 
     static SqlStatementID insChar;
@@ -16514,12 +16599,17 @@ void Player::SaveToDB(bool online, bool force)
     uint32 saveAccountId = GetSession()->GetAccountId();
     if (IsBot())
     {
-        // Query DB directly for the real account ID
-        std::unique_ptr<QueryResult> result = CharacterDatabase.PQuery(
-            "SELECT account FROM characters WHERE guid = %u", GetGUIDLow());
-        if (result)
+        // Account read when the character was loaded, query only for bots created in memory
+        uint32 dbAccountId = m_dbAccountId;
+        if (!dbAccountId)
+        {
+            std::unique_ptr<QueryResult> result = CharacterDatabase.PQuery(
+                "SELECT account FROM characters WHERE guid = %u", GetGUIDLow());
+            if (result)
+                dbAccountId = result->Fetch()[0].GetUInt32();
+        }
+        if (dbAccountId)
         {
-            uint32 dbAccountId = result->Fetch()[0].GetUInt32();
             // Only use DB value if it's a real account ID (not a corrupted session ID)
             if (dbAccountId > 0 && dbAccountId < 10000)
             {
@@ -16656,12 +16746,13 @@ void Player::SaveToDB(bool online, bool force)
     uberInsert.addUInt64(uint64(m_createTime));
     uberInsert.Execute();
 
+    // Inventory, quests, spells, skills, reputation and honor only write changed rows
     _SaveBGData();
     _SaveInventory();
     _SaveQuestStatus();
     _SaveSpells();
-    _SaveSpellCooldowns();
-    _SaveAuras();
+    _SaveSpellCooldowns(incremental);
+    _SaveAuras(incremental);
     _SaveSkills();
     m_reputationMgr.SaveToDB();
     m_honorMgr.Save();
@@ -16669,12 +16760,13 @@ void Player::SaveToDB(bool online, bool force)
     // Systeme de phasing
     sObjectMgr.SetPlayerWorldMask(GetGUIDLow(), GetWorldMask());
     GetSession()->SaveTutorialsData();                      // changed only while character in game
+}
 
-    CharacterDatabase.CommitTransaction();
-
+void Player::_FinishSave(bool saveStats)
+{
     // check if stats should only be saved on logout
     // save stats can be out of transaction
-    if (m_session->IsLogingOut() || !sWorld.getConfig(CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT))
+    if (saveStats && (m_session->IsLogingOut() || !sWorld.getConfig(CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT)))
         _SaveStats();
 
     // save pet (hunter pet level and experience and all type pets health/mana).
@@ -16721,49 +16813,62 @@ void Player::SaveGoldToDB()
     stmt.PExecute(GetMoney(), GetGUIDLow());
 }
 
-void Player::_SaveAuras()
+void Player::_SaveAuras(bool incremental)
 {
+    std::vector<AuraSaveStruct> auras;
+    uint64 hash = 0;
+
+    AuraSaveStruct s;
+    for (const auto& auraHolder : GetSpellAuraHolderMap())
+    {
+        if (!SaveAura(auraHolder.second, s))
+            continue;
+
+        // Remaining durations are left out, they change on every save
+        HashCombineForSave(hash, s.casterGuid.GetRawValue());
+        HashCombineForSave(hash, s.itemLowGuid);
+        HashCombineForSave(hash, s.spellId);
+        HashCombineForSave(hash, s.stacks);
+        HashCombineForSave(hash, s.charges);
+        HashCombineForSave(hash, s.effIndexMask);
+        auras.push_back(s);
+    }
+
+    if (incremental && hash == m_savedAurasHash)
+        return;
+    m_savedAurasHash = hash;
+
     static SqlStatementID deleteAuras ;
-    static SqlStatementID insertAuras ;
 
     SqlStatement stmt = CharacterDatabase.CreateStatement(deleteAuras, "DELETE FROM `character_aura` WHERE `guid` = ?");
     stmt.PExecute(GetGUIDLow());
 
-    SpellAuraHolderMap const& auraHolders = GetSpellAuraHolderMap();
-
-    if (auraHolders.empty())
+    if (auras.empty())
         return;
 
-    stmt = CharacterDatabase.CreateStatement(insertAuras, "INSERT INTO `character_aura` (`guid`, `caster_guid`, `item_guid`, `spell`, `stacks`, `charges`, "
-            "`base_points0`, `base_points1`, `base_points2`, `periodic_time0`, `periodic_time1`, `periodic_time2`, `max_duration`, `duration`, `effect_index_mask`) "
-            "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
+    std::ostringstream ss;
+    ss.imbue(std::locale::classic());
+    ss.precision(9);
+    ss << "INSERT INTO `character_aura` (`guid`, `caster_guid`, `item_guid`, `spell`, `stacks`, `charges`, "
+          "`base_points0`, `base_points1`, `base_points2`, `periodic_time0`, `periodic_time1`, `periodic_time2`, `max_duration`, `duration`, `effect_index_mask`) VALUES ";
 
-    AuraSaveStruct s;
-    for (const auto& auraHolder : auraHolders)
+    for (size_t i = 0; i < auras.size(); ++i)
     {
-        SpellAuraHolder* holder = auraHolder.second;
-
-        if (!SaveAura(holder, s))
-            continue;
+        AuraSaveStruct const& aura = auras[i];
 
-        stmt.addUInt32(GetGUIDLow());
-        stmt.addUInt64(s.casterGuid.GetRawValue());
-        stmt.addUInt32(s.itemLowGuid);
-        stmt.addUInt32(s.spellId);
-        stmt.addUInt32(s.stacks);
-        stmt.addUInt8(s.charges);
+        ss << (i ? ", (" : "(") << GetGUIDLow() << ", " << aura.casterGuid.GetRawValue() << ", " << aura.itemLowGuid << ", "
+           << aura.spellId << ", " << aura.stacks << ", " << uint32(aura.charges);
 
-        for (float i : s.damage)
-            stmt.addFloat(i);
+        for (float damage : aura.damage)
+            ss << ", " << finiteAlways(damage);
 
-        for (uint32 i : s.periodicTime)
-            stmt.addUInt32(i);
+        for (uint32 periodicTime : aura.periodicTime)
+            ss << ", " << periodicTime;
 
-        stmt.addInt32(s.maxDuration);
-        stmt.addInt32(s.duration);
-        stmt.addInt8(s.effIndexMask);
-        stmt.Execute();
+        ss << ", " << aura.maxDuration << ", " << aura.duration << ", " << int32(aura.effIndexMask) << ")";
     }
+
+    CharacterDatabase.Execute(ss.str().c_str());
 }
 
 bool Player::SaveAura(SpellAuraHolder const* holder, AuraSaveStruct& saveStruct)
@@ -18953,7 +19058,8 @@ void AddBroadcastListener(T* target, Player* me)
 template<>
 void AddBroadcastListener(Player* target, Player* me)
 {
-    if (target->m_broadcaster)
+    // Headless viewers have no socket to forward movement to
+    if (target->m_broadcaster && !me->IsHeadlessViewer())
         target->m_broadcaster->AddListener(me);
 }
 
@@ -21089,6 +21195,9 @@ void Player::SendSpellCooldown(uint32 spellId, uint32 cooldown, ObjectGuid targe
 
 void Player::SendSpellRemoved(uint32 spellId) const
 {
+    if (GetSession()->PostBotEvent(BotEvent(BOT_EVENT_SPELLS_CHANGED)))
+        return;
+
     WorldPacket data(SMSG_REMOVED_SPELL, 4);
     data << uint16(spellId);
     GetSession()->SendPacket(&data);
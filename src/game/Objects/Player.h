@@ -1231,7 +1231,10 @@ class Player final: public Unit
         /*********************************************************/
         
     private:
-        void _SaveAuras();
+        bool _PrepareSave(bool force);
+        void _SaveCharacter(bool online, bool incremental);
+        void _FinishSave(bool saveStats);
+        void _SaveAuras(bool incremental = false);
         void _SaveInventory();
         void _SaveQuestStatus();
         void _SaveSkills();
@@ -1240,10 +1243,18 @@ class Player final: public Unit
         void _SaveStats();
         uint32 m_nextSave;
         bool m_saveDisabled; // used for temporary bots and faction change
+        uint32 m_dbAccountId; // account in the characters row, bots log in on generated session accounts
+        // Fingerprints of the sections that are rewritten as a whole, as last written.
+        // Incremental saves skip a section whose fingerprint did not change.
+        uint64 m_savedAurasHash;
+        uint64 m_savedCooldownsHash;
     public:
         // Saves a new character directly in the database, without creating a Player object in memory.
         static bool SaveNewPlayer(WorldSession* session, uint32 guidlow, std::string const& name, uint8 raceId, uint8 classId, uint8 gender, uint8 skin, uint8 face, uint8 hairStyle, uint8 hairColor, uint8 facialHair);
         void SaveToDB(bool online = true, bool force = false);
+        // Periodic save of several bots of one map: unchanged sections are skipped
+        // and the bots share one transaction per database serial worker.
+        static void SaveBotsToDB(std::vector<Player*> const& bots);
         void SaveInventoryAndGoldToDB();                    // fast save function for item/money cheating preventing
         void SaveGoldToDB();
         static void SavePositionInDB(ObjectGuid guid, uint32 mapId, float x, float y, float z, float o, uint32 zone);
@@ -1363,7 +1374,7 @@ class Player final: public Unit
         void SendClearAllCooldowns(Unit const* target) const;
         void SendSpellCooldown(uint32 spellId, uint32 cooldown, ObjectGuid target) const;
         void _LoadSpellCooldowns(std::unique_ptr<QueryResult> result);
-        void _SaveSpellCooldowns() const;
+        void _SaveSpellCooldowns(bool incremental = false);
 
         template <typename F>
         void RemoveSomeCooldown(F check)
@@ -1964,6 +1975,7 @@ class Player final: public Unit
         uint32 m_playedTime[MAX_PLAYED_TIME_INDEX];
     public:
         WorldSession* GetSession() const { return m_session; }
+        bool IsHeadlessViewer() const { return m_session && m_session->IsHeadless(); }
         void SetSession(WorldSession* s);
         bool IsBot() const { return m_session->GetBot() != nullptr; }
 
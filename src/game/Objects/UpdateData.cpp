@@ -187,6 +187,12 @@ bool UpdateData::BuildPacket(WorldPacket* packet, UpdatePacket const* updPacket,
 
 void UpdateData::Send(WorldSession* session, bool hasTransport)
 {
+    if (session->IsHeadless())
+    {
+        Clear();
+        return;
+    }
+
     WorldPacket data;
     if (m_datas.empty() && !m_outOfRangeGUIDs.empty())
     {
@@ -9,6 +9,7 @@
 #include "QuestingActivity.h"
 #include "PlayerBots/Utilities/BotObjectInteraction.h"
 #include "PlayerBots/BotMovementManager.h"
+#include "PlayerBots/BotProfiler.h"
 #include "Player.h"
 #include "Creature.h"
 #include "GameObject.h"
@@ -59,6 +60,8 @@ void QuestingActivity::SetMovementManager(BotMovementManager* pMgr)
 
 bool QuestingActivity::Update(Player* pBot, uint32 diff)
 {
+    BotProfileScope profile(BOT_PROFILE_QUESTING);
+
     if (!pBot || !pBot->IsAlive())
         return false;
 
@@ -323,6 +323,11 @@ Unit* BattleBotAI::SelectAttackTarget(Unit* pExcept) const
     me->GetAlivePlayerListInRange(me, players, VISIBILITY_DISTANCE_NORMAL);
     float const maxAggroDistance = GetMaxAggroDistanceForMap();
 
+    // Line of sight of the candidates is checked in one batch, a flag
+    // carrier only wins over the ones listed before it
+    std::vector<Unit*> candidates;
+    Player* pFlagCarrier = nullptr;
+
     for (const auto& pTarget : players)
     {
         if (pTarget == pExcept)
@@ -331,15 +336,10 @@ Unit* BattleBotAI::SelectAttackTarget(Unit* pExcept) const
         if (!IsValidHostileTarget(pTarget))
             continue;
 
-        if (me->GetTeam() == HORDE)
-        {
-            if (pTarget->HasAura(AURA_WARSONG_FLAG))
-                return pTarget;
-        }
-        else
+        if (pTarget->HasAura(me->GetTeam() == HORDE ? AURA_WARSONG_FLAG : AURA_SILVERWING_FLAG))
         {
-            if (pTarget->HasAura(AURA_SILVERWING_FLAG))
-                return pTarget;
+            pFlagCarrier = pTarget;
+            break;
         }
 
         // Aggro weak enemies from further away.
@@ -350,14 +350,21 @@ Unit* BattleBotAI::SelectAttackTarget(Unit* pExcept) const
         if (me->GetDistanceZ(pTarget) > 10.0f)
             continue;
 
-        if (me->IsWithinLOSInMap(pTarget))
-            return pTarget;
+        candidates.push_back(pTarget);
     }
 
+    if (Unit* pTarget = SelectFirstInLineOfSight(candidates))
+        return pTarget;
+
+    if (pFlagCarrier)
+        return pFlagCarrier;
+
     // 3. Check party attackers.
 
     if (Group* pGroup = me->GetGroup())
     {
+        candidates.clear();
+
         for (GroupReference* itr = pGroup->GetFirstMember(); itr != nullptr; itr = itr->next())
         {
             if (Unit* pMember = itr->getSource())
@@ -373,12 +380,14 @@ Unit* BattleBotAI::SelectAttackTarget(Unit* pExcept) const
                     if (pAttacker != pExcept &&
                         IsValidHostileTarget(pAttacker) &&
                         me->IsWithinDist(pAttacker, maxAggroDistance * 2.0f) &&
-                        me->GetDistanceZ(pAttacker) < 10.0f &&
-                        me->IsWithinLOSInMap(pAttacker))
-                        return pAttacker;
+                        me->GetDistanceZ(pAttacker) < 10.0f)
+                        candidates.push_back(pAttacker);
                 }
             }
         }
+
+        if (Unit* pAttacker = SelectFirstInLineOfSight(candidates))
+            return pAttacker;
     }
 
     return nullptr;
@@ -466,6 +475,13 @@ void BattleBotAI::StopMoving()
     me->GetMotionMaster()->MoveIdle();
 }
 
+bool BattleBotAI::WantsPacket(uint16 opcode) const
+{
+    if (opcode == MSG_PVP_LOG_DATA)
+        return true;
+    return CombatBotBaseAI::WantsPacket(opcode);
+}
+
 void BattleBotAI::OnPacketReceived(WorldPacket const* packet)
 {
     //printf("Bot received %s\n", LookupOpcodeName(packet->GetOpcode()));
@@ -650,6 +666,8 @@ bool BattleBotAI::CheckForUnreachableTarget()
 
 void BattleBotAI::UpdateAI(uint32 const diff)
 {
+    ProcessEvents();
+
     m_updateTimer.Update(diff);
     if (m_updateTimer.Passed())
         m_updateTimer.Reset(BB_UPDATE_INTERVAL);
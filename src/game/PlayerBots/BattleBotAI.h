@@ -49,6 +49,7 @@ public:
     void OnPlayerLogin() final;
     void UpdateAI(uint32 const diff) final;
     void OnPacketReceived(WorldPacket const* packet) final;
+    bool WantsPacket(uint16 opcode) const final;
     void MovementInform(uint32 MovementType, uint32 Data = 0) final;
 
     bool ShouldIgnoreCombat() const;
@@ -117,6 +118,7 @@ public:
     bool m_doingGraveyardJump = false;
     bool m_movingInReverse = false;
     uint32 m_currentPoint = 0;
+    uint32 m_lastPoint = 0;
     BattleBotPath* m_currentPath = nullptr;
     uint8 m_waitingSpot = BB_WSG_WAIT_SPOT_SPAWN;
 };
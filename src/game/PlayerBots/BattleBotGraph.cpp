@@ -0,0 +1,334 @@
+/*
+ * BattleBotGraph.cpp
+ *
+ * Navigation graph over the battleground waypoint paths.
+ * Built once at server startup.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#include "BattleBotGraph.h"
+#include "Geometry.h"
+#include "Log.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+using namespace Geometry;
+
+// ============================================================================
+// Static member initialization
+// ============================================================================
+
+BattleBotGraph BattleBotGraph::s_graphWS;
+BattleBotGraph BattleBotGraph::s_graphAB;
+BattleBotGraph BattleBotGraph::s_graphAV;
+bool BattleBotGraph::s_graphsBuilt = false;
+std::mutex BattleBotGraph::s_graphMutex;
+
+constexpr float BattleBotGraph::NODE_MERGE_DISTANCE;
+constexpr float BattleBotGraph::POINT_CELL_SIZE;
+
+// ============================================================================
+// Graph Building
+// ============================================================================
+
+void BattleBotGraph::Build()
+{
+    std::lock_guard<std::mutex> lock(s_graphMutex);
+
+    if (s_graphsBuilt)
+        return;
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[BattleBotGraph] Building battleground waypoint graphs...");
+
+    s_graphWS.BuildFrom(vPaths_WS);
+    s_graphAB.BuildFrom(vPaths_AB);
+    s_graphAV.BuildFrom(vPaths_AV);
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, ">> Waypoint graphs built: WS %u/%u, AB %u/%u, AV %u/%u nodes/edges",
+        s_graphWS.GetNodeCount(), s_graphWS.GetEdgeCount(),
+        s_graphAB.GetNodeCount(), s_graphAB.GetEdgeCount(),
+        s_graphAV.GetNodeCount(), s_graphAV.GetEdgeCount());
+
+    s_graphsBuilt = true;
+}
+
+void BattleBotGraph::BuildFrom(std::vector<BattleBotPath*> const& vPaths)
+{
+    for (BattleBotPath* pPath : vPaths)
+    {
+        if (pPath->empty())
+            continue;
+
+        PathInfo info;
+        info.pPath = pPath;
+        info.reversible = std::find(vPaths_NoReverseAllowed.begin(), vPaths_NoReverseAllowed.end(), pPath) == vPaths_NoReverseAllowed.end();
+
+        info.lengthTo.resize(pPath->size());
+        info.lengthTo[0] = 0.0f;
+        for (uint32 i = 1; i < pPath->size(); ++i)
+            info.lengthTo[i] = info.lengthTo[i - 1] + GetDistance3D((*pPath)[i - 1], (*pPath)[i]);
+
+        m_paths.push_back(std::move(info));
+    }
+
+    BuildNodes();
+    BuildEdges();
+    BuildRouteTables();
+    BuildPointGrid();
+}
+
+uint32 BattleBotGraph::FindOrAddNode(BattleBotWaypoint const& point)
+{
+    for (uint32 node = 0; node < m_nodes.size(); ++node)
+    {
+        if (GetDistance3D(m_nodes[node], point) < NODE_MERGE_DISTANCE)
+            return node;
+    }
+
+    m_nodes.push_back({ point.x, point.y, point.z });
+    return uint32(m_nodes.size() - 1);
+}
+
+void BattleBotGraph::BuildNodes()
+{
+    // Endpoints first, so that every junction found below is a known node
+    std::vector<std::pair<uint32, uint32>> endNodes(m_paths.size());
+    for (uint32 path = 0; path < m_paths.size(); ++path)
+    {
+        BattleBotPath const& points = *m_paths[path].pPath;
+        endNodes[path].first = FindOrAddNode(points.front());
+        endNodes[path].second = FindOrAddNode(points.back());
+    }
+
+    for (uint32 path = 0; path < m_paths.size(); ++path)
+    {
+        PathInfo& info = m_paths[path];
+        BattleBotPath const& points = *info.pPath;
+        uint32 const lastPoint = uint32(points.size() - 1);
+
+        std::vector<std::pair<uint32 /*point*/, uint32 /*node*/>> cuts;
+        cuts.emplace_back(0, endNodes[path].first);
+        if (lastPoint)
+            cuts.emplace_back(lastPoint, endNodes[path].second);
+
+        // Junctions: the interior point closest to another path's endpoint
+        for (uint32 node = 0; node < m_nodes.size(); ++node)
+        {
+            if (node == endNodes[path].first || node == endNodes[path].second)
+                continue;
+
+            uint32 closestPoint = 0;
+            float closestDistance = NODE_MERGE_DISTANCE;
+            for (uint32 i = 1; i < lastPoint; ++i)
+            {
+                float const distance = GetDistance3D(m_nodes[node], points[i]);
+                if (distance < closestDistance)
+                {
+                    closestPoint = i;
+                    closestDistance = distance;
+                }
+            }
+
+            if (closestPoint)
+                cuts.emplace_back(closestPoint, node);
+        }
+
+        std::sort(cuts.begin(), cuts.end());
+        for (auto const& cut : cuts)
+        {
+            // Two nodes near the same point, keep the first
+            if (!info.cuts.empty() && info.cuts.back() == cut.first)
+                continue;
+
+            info.cuts.push_back(cut.first);
+            info.cutNodes.push_back(cut.second);
+        }
+    }
+}
+
+void BattleBotGraph::BuildEdges()
+{
+    for (PathInfo const& info : m_paths)
+    {
+        for (uint32 i = 1; i < info.cuts.size(); ++i)
+        {
+            uint32 const fromNode = info.cutNodes[i - 1];
+            uint32 const toNode = info.cutNodes[i];
+            if (fromNode == toNode)
+                continue;
+
+            float const length = info.lengthTo[info.cuts[i]] - info.lengthTo[info.cuts[i - 1]];
+            m_edges.push_back({ info.pPath, info.cuts[i - 1], info.cuts[i], fromNode, toNode, length });
+
+            if (info.reversible)
+                m_edges.push_back({ info.pPath, info.cuts[i], info.cuts[i - 1], toNode, fromNode, length });
+        }
+    }
+}
+
+void BattleBotGraph::BuildRouteTables()
+{
+    uint32 const nodeCount = uint32(m_nodes.size());
+    m_distances.assign(nodeCount * nodeCount, FLT_MAX);
+    m_nextEdges.assign(nodeCount * nodeCount, -1);
+
+    for (uint32 node = 0; node < nodeCount; ++node)
+        m_distances[node * nodeCount + node] = 0.0f;
+
+    for (uint32 edge = 0; edge < m_edges.size(); ++edge)
+    {
+        BattleBotGraphEdge const& e = m_edges[edge];
+        uint32 const index = e.fromNode * nodeCount + e.toNode;
+        if (e.length < m_distances[index])
+        {
+            m_distances[index] = e.length;
+            m_nextEdges[index] = int32(edge);
+        }
+    }
+
+    // Floyd-Warshall, the graphs have at most a few dozen nodes
+    for (uint32 via = 0; via < nodeCount; ++via)
+    {
+        for (uint32 from = 0; from < nodeCount; ++from)
+        {
+            float const toVia = m_distances[from * nodeCount + via];
+            if (toVia == FLT_MAX)
+                continue;
+
+            for (uint32 to = 0; to < nodeCount; ++to)
+            {
+                float const fromVia = m_distances[via * nodeCount + to];
+                if (fromVia == FLT_MAX)
+                    continue;
+
+                uint32 const index = from * nodeCount + to;
+                if (toVia + fromVia < m_distances[index])
+                {
+                    m_distances[index] = toVia + fromVia;
+                    m_nextEdges[index] = m_nextEdges[from * nodeCount + via];
+                }
+            }
+        }
+    }
+}
+
+uint32 BattleBotGraph::GetCellKey(int32 cellX, int32 cellY)
+{
+    return (uint32(cellX + 0x8000) << 16) | uint32(cellY + 0x8000);
+}
+
+void BattleBotGraph::BuildPointGrid()
+{
+    for (uint32 path = 0; path < m_paths.size(); ++path)
+    {
+        BattleBotPath const& points = *m_paths[path].pPath;
+        for (uint32 i = 0; i < points.size(); ++i)
+        {
+            int32 const cellX = int32(std::floor(points[i].x / POINT_CELL_SIZE));
+            int32 const cellY = int32(std::floor(points[i].y / POINT_CELL_SIZE));
+            m_pointGrid[GetCellKey(cellX, cellY)].push_back({ path, i });
+        }
+    }
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+BattleBotGraph const* BattleBotGraph::ForPaths(std::vector<BattleBotPath*> const& vPaths)
+{
+    if (!s_graphsBuilt)
+        Build();
+
+    if (&vPaths == &vPaths_WS)
+        return &s_graphWS;
+    if (&vPaths == &vPaths_AB)
+        return &s_graphAB;
+    if (&vPaths == &vPaths_AV)
+        return &s_graphAV;
+
+    return nullptr;
+}
+
+uint32 BattleBotGraph::FindNearestNode(float x, float y, float z) const
+{
+    uint32 nearestNode = 0;
+    float nearestDistance = FLT_MAX;
+    for (uint32 node = 0; node < m_nodes.size(); ++node)
+    {
+        float const distance = GetDistance3D(m_nodes[node].x, m_nodes[node].y, m_nodes[node].z, x, y, z);
+        if (distance < nearestDistance)
+        {
+            nearestNode = node;
+            nearestDistance = distance;
+        }
+    }
+    return nearestNode;
+}
+
+bool BattleBotGraph::FindRoute(float x, float y, float z, float maxEntryDistance, uint32 goalNode, BattleBotRoute& route) const
+{
+    if (goalNode >= m_nodes.size())
+        return false;
+
+    route.pPath = nullptr;
+    route.cost = FLT_MAX;
+
+    int32 const minCellX = int32(std::floor((x - maxEntryDistance) / POINT_CELL_SIZE));
+    int32 const maxCellX = int32(std::floor((x + maxEntryDistance) / POINT_CELL_SIZE));
+    int32 const minCellY = int32(std::floor((y - maxEntryDistance) / POINT_CELL_SIZE));
+    int32 const maxCellY = int32(std::floor((y + maxEntryDistance) / POINT_CELL_SIZE));
+
+    for (int32 cellX = minCellX; cellX <= maxCellX; ++cellX)
+    {
+        for (int32 cellY = minCellY; cellY <= maxCellY; ++cellY)
+        {
+            auto itr = m_pointGrid.find(GetCellKey(cellX, cellY));
+            if (itr == m_pointGrid.end())
+                continue;
+
+            for (PathPoint const& entry : itr->second)
+            {
+                PathInfo const& info = m_paths[entry.path];
+                BattleBotWaypoint const& point = (*info.pPath)[entry.point];
+                float const entryDistance = GetDistance3D(point.x, point.y, point.z, x, y, z);
+                if (entryDistance >= maxEntryDistance)
+                    continue;
+
+                // Last cut at or before the point
+                uint32 const segment = uint32(std::upper_bound(info.cuts.begin(), info.cuts.end(), entry.point) - info.cuts.begin() - 1);
+
+                // Forward to the next cut
+                if (segment + 1 < info.cuts.size())
+                {
+                    uint32 const endPoint = info.cuts[segment + 1];
+                    float const toGoal = GetDistance(info.cutNodes[segment + 1], goalNode);
+                    if (toGoal != FLT_MAX)
+                    {
+                        float const cost = entryDistance + info.lengthTo[endPoint] - info.lengthTo[entry.point] + toGoal;
+                        if (cost < route.cost)
+                            route = { info.pPath, entry.point, endPoint, cost };
+                    }
+                }
+
+                // Backward to the previous cut
+                uint32 const backCut = info.cuts[segment] == entry.point ? segment - 1 : segment;
+                if (info.reversible && entry.point > 0 && backCut < info.cuts.size())
+                {
+                    uint32 const endPoint = info.cuts[backCut];
+                    float const toGoal = GetDistance(info.cutNodes[backCut], goalNode);
+                    if (toGoal != FLT_MAX)
+                    {
+                        float const cost = entryDistance + info.lengthTo[entry.point] - info.lengthTo[endPoint] + toGoal;
+                        if (cost < route.cost)
+                            route = { info.pPath, entry.point, endPoint, cost };
+                    }
+                }
+            }
+        }
+    }
+
+    return route.pPath != nullptr;
+}
@@ -0,0 +1,134 @@
+/*
+ * BattleBotGraph.h
+ *
+ * Navigation graph over the hand-made battleground waypoint paths.
+ * Built once at server startup, then read by all battle bots without
+ * locking.
+ *
+ * Nodes are path endpoints, merged when they lie within interaction
+ * distance of each other. A path passing close to another path's
+ * endpoint is split there, so routes can change paths at junctions
+ * and not only at the ends. Edges are the path segments between nodes,
+ * one per walkable direction (see vPaths_NoReverseAllowed).
+ *
+ * Shortest distances and next hops between all nodes are precomputed,
+ * so routing to an objective costs one table lookup per nearby path
+ * point instead of a scan of every path.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#ifndef MANGOS_BATTLEBOTGRAPH_H
+#define MANGOS_BATTLEBOTGRAPH_H
+
+#include "Common.h"
+#include "BattleBotWaypoints.h"
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+struct BattleBotGraphNode
+{
+    float x;
+    float y;
+    float z;
+};
+
+// Walks pPath from fromPoint to toPoint, in reverse if toPoint < fromPoint
+struct BattleBotGraphEdge
+{
+    BattleBotPath* pPath;
+    uint32 fromPoint;
+    uint32 toPoint;
+    uint32 fromNode;
+    uint32 toNode;
+    float length;
+};
+
+// Where to join the graph and how far to walk on the first path
+struct BattleBotRoute
+{
+    BattleBotPath* pPath = nullptr;
+    uint32 startPoint = 0;
+    uint32 endPoint = 0;
+    float cost = 0.0f;          // to the start point, along the path, then to the goal node
+};
+
+// ============================================================================
+// BattleBotGraph — one per battleground, static registry
+// ============================================================================
+
+class BattleBotGraph
+{
+public:
+    // ---- Graph building (called from PlayerBotMgr::Load) ----
+    static void Build();
+    static bool IsBuilt() { return s_graphsBuilt; }
+
+    // Graph of vPaths_WS, vPaths_AB or vPaths_AV, nullptr for other path lists
+    static BattleBotGraph const* ForPaths(std::vector<BattleBotPath*> const& vPaths);
+
+    // ---- Queries ----
+
+    uint32 GetNodeCount() const { return uint32(m_nodes.size()); }
+    uint32 GetEdgeCount() const { return uint32(m_edges.size()); }
+    BattleBotGraphNode const& GetNode(uint32 node) const { return m_nodes[node]; }
+    BattleBotGraphEdge const& GetEdge(uint32 edge) const { return m_edges[edge]; }
+
+    uint32 FindNearestNode(float x, float y, float z) const;
+
+    // Shortest walking distance between nodes, FLT_MAX if unreachable
+    float GetDistance(uint32 fromNode, uint32 toNode) const { return m_distances[fromNode * m_nodes.size() + toNode]; }
+
+    // First edge on the shortest route, -1 if unreachable or already there
+    int32 GetNextEdge(uint32 fromNode, uint32 toNode) const { return m_nextEdges[fromNode * m_nodes.size() + toNode]; }
+
+    // Cheapest way to goalNode from any path point within maxEntryDistance of (x, y, z)
+    bool FindRoute(float x, float y, float z, float maxEntryDistance, uint32 goalNode, BattleBotRoute& route) const;
+
+private:
+    struct PathInfo
+    {
+        BattleBotPath* pPath;
+        bool reversible;
+        std::vector<float> lengthTo;    // walking distance from the first point
+        std::vector<uint32> cuts;       // sorted points where the path meets a node
+        std::vector<uint32> cutNodes;   // node at each cut
+    };
+
+    struct PathPoint
+    {
+        uint32 path;
+        uint32 point;
+    };
+
+    void BuildFrom(std::vector<BattleBotPath*> const& vPaths);
+    void BuildNodes();
+    void BuildEdges();
+    void BuildRouteTables();
+    void BuildPointGrid();
+
+    uint32 FindOrAddNode(BattleBotWaypoint const& point);
+    static uint32 GetCellKey(int32 cellX, int32 cellY);
+
+    std::vector<PathInfo> m_paths;
+    std::vector<BattleBotGraphNode> m_nodes;
+    std::vector<BattleBotGraphEdge> m_edges;
+    std::vector<float> m_distances;     // node count squared
+    std::vector<int32> m_nextEdges;     // node count squared
+    std::unordered_map<uint32 /*cell key*/, std::vector<PathPoint>> m_pointGrid;
+
+    static BattleBotGraph s_graphWS;
+    static BattleBotGraph s_graphAB;
+    static BattleBotGraph s_graphAV;
+    static bool s_graphsBuilt;
+    static std::mutex s_graphMutex;
+
+    // Endpoints this close are the same node
+    static constexpr float NODE_MERGE_DISTANCE = 5.0f;     // INTERACTION_DISTANCE
+
+    // Cell size of the path point lookup, the usual route entry distance
+    static constexpr float POINT_CELL_SIZE = 50.0f;
+};
+
+#endif // MANGOS_BATTLEBOTGRAPH_H
@@ -16,6 +16,7 @@
 
 #include "BattleBotAI.h"
 #include "BattleBotWaypoints.h"
+#include "BattleBotGraph.h"
 #include "WorldPacket.h"
 #include "Opcodes.h"
 #include "Player.h"
@@ -1765,9 +1766,7 @@ void BattleBotAI::MoveToNextPoint()
     if (!m_currentPath)
         return;
 
-    uint32 const lastPointInPath = m_movingInReverse ? 0 : ((*m_currentPath).size() - 1);
-
-    if ((m_currentPoint == lastPointInPath) ||
+    if ((m_currentPoint == m_lastPoint) ||
         (me->IsInCombat() && !ShouldIgnoreCombat()) || !me->IsAlive())
     {
         // Path is over.
@@ -1839,6 +1838,7 @@ bool BattleBotAI::StartNewPathFromBeginning()
     m_currentPath = chosenPath->pPath;
     m_movingInReverse = chosenPath->reverse;
     m_currentPoint = m_movingInReverse ? m_currentPath->size() - 1 : 0;
+    m_lastPoint = m_movingInReverse ? 0 : m_currentPath->size() - 1;
     MoveToNextPoint();
     return true;
 }
@@ -1892,88 +1892,31 @@ void BattleBotAI::StartNewPathFromAnywhere()
     m_currentPath = pClosestPath;
     m_movingInReverse = false;
     m_currentPoint = closestPoint-1;
+    m_lastPoint = m_currentPath->size() - 1;
     MoveToNextPoint();
 }
 
 bool BattleBotAI::StartNewPathToPosition(Position const& targetPosition, std::vector<BattleBotPath*> const& vPaths)
 {
-    BattleBotPath* pClosestPath = nullptr;
-    uint32 closestPoint = 0;
-    float closestDistanceToTarget = FLT_MAX;
-    bool reverse = false;
-
-    for (const auto& pPath : vPaths)
-    {
-        {
-            BattleBotWaypoint& lastPoint = ((*pPath)[pPath->size() - 1]);
-            float const distanceFromPathEndToTarget = GetDistance3D(lastPoint, targetPosition);
-            if (closestDistanceToTarget > distanceFromPathEndToTarget)
-            {
-                float closestDistanceFromMeToPoint = FLT_MAX;
-
-                for (uint32 i = 0; i < pPath->size(); i++)
-                {
-                    BattleBotWaypoint& waypoint = ((*pPath)[i]);
-                    float const distanceFromMeToPoint = me->GetDistance(waypoint.x, waypoint.y, waypoint.z);
-                    if (distanceFromMeToPoint < 50.0f && closestDistanceFromMeToPoint > distanceFromMeToPoint)
-                    {
-                        reverse = false;
-                        pClosestPath = pPath;
-                        closestPoint = i;
-                        closestDistanceToTarget = distanceFromPathEndToTarget;
-                        closestDistanceFromMeToPoint = distanceFromMeToPoint;
-                    }
-                }
-            }
-        }
-        
-        if (std::find(vPaths_NoReverseAllowed.begin(), vPaths_NoReverseAllowed.end(), pPath) != vPaths_NoReverseAllowed.end())
-            continue;
-
-        {
-            BattleBotWaypoint& firstPoint = ((*pPath)[0]);
-            float const distanceFromPathBeginToTarget = GetDistance3D(firstPoint, targetPosition);
-            if (closestDistanceToTarget > distanceFromPathBeginToTarget)
-            {
-                float closestDistanceFromMeToPoint = FLT_MAX;
-
-                for (uint32 i = 0; i < pPath->size(); i++)
-                {
-                    BattleBotWaypoint& waypoint = ((*pPath)[i]);
-                    float const distanceFromMeToPoint = me->GetDistance(waypoint.x, waypoint.y, waypoint.z);
-                    if (distanceFromMeToPoint < 50.0f && closestDistanceFromMeToPoint > distanceFromMeToPoint)
-                    {
-                        reverse = true;
-                        pClosestPath = pPath;
-                        closestPoint = i;
-                        closestDistanceToTarget = distanceFromPathBeginToTarget;
-                        closestDistanceFromMeToPoint = distanceFromMeToPoint;
-                    }
-                }
-            }
-        }
-    }
+    BattleBotGraph const* pGraph = BattleBotGraph::ForPaths(vPaths);
+    if (!pGraph || !pGraph->GetNodeCount())
+        return false;
 
-    if (!pClosestPath)
+    // Don't start a path if we are already there.
+    uint32 const goalNode = pGraph->FindNearestNode(targetPosition.x, targetPosition.y, targetPosition.z);
+    BattleBotGraphNode const& goal = pGraph->GetNode(goalNode);
+    if (me->GetDistance(goal.x, goal.y, goal.z) < INTERACTION_DISTANCE)
         return false;
 
-    // Prevent picking last point of path.
-    // It means we are already there.
-    if (reverse)
-    {
-        if (closestPoint == 0)
-            return false;
-            
-    }
-    else
-    {
-        if (closestPoint == pClosestPath->size() - 1)
-            return false;
-    }
+    // Walk to the next junction on the shortest route, then pick again from there.
+    BattleBotRoute route;
+    if (!pGraph->FindRoute(me->GetPositionX(), me->GetPositionY(), me->GetPositionZ(), 50.0f, goalNode, route))
+        return false;
 
-    m_currentPath = pClosestPath;
-    m_movingInReverse = reverse;
-    m_currentPoint = m_movingInReverse ? closestPoint + 1 : closestPoint - 1;
+    m_currentPath = route.pPath;
+    m_movingInReverse = route.endPoint < route.startPoint;
+    m_currentPoint = m_movingInReverse ? route.startPoint + 1 : route.startPoint - 1;
+    m_lastPoint = route.endPoint;
     MoveToNextPoint();
     return true;
 }
@@ -2185,5 +2128,6 @@ void BattleBotAI::ClearPath()
 {
     m_currentPath = nullptr;
     m_currentPoint = 0;
+    m_lastPoint = 0;
     m_movingInReverse = false;
 }
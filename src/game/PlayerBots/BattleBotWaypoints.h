@@ -62,5 +62,6 @@ typedef std::vector<BattleBotWaypoint> BattleBotPath;
 extern std::vector<BattleBotPath*> const vPaths_WS;
 extern std::vector<BattleBotPath*> const vPaths_AB;
 extern std::vector<BattleBotPath*> const vPaths_AV;
+extern std::vector<BattleBotPath*> const vPaths_NoReverseAllowed;
 
 #endif
@@ -0,0 +1,95 @@
+/*
+ * BotEvents.h
+ *
+ * Typed events game code hands directly to a bot AI, instead of building
+ * a server packet for the bot to parse back.
+ *
+ * Posted with WorldSession::PostBotEvent from whichever thread produces
+ * them, queued in a fixed ring buffer owned by the bot AI and handled in
+ * the bot's own update. Posting never allocates. If a bot falls behind
+ * by more than the buffer holds, the newest events are dropped.
+ *
+ * Server protocol packets the bot must answer to move on (world port and
+ * teleport acks) still arrive through OnPacketReceived, since the bot is
+ * not updated until it answers them.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#ifndef MANGOS_BOTEVENTS_H
+#define MANGOS_BOTEVENTS_H
+
+#include "Common.h"
+#include "ObjectGuid.h"
+#include <array>
+#include <atomic>
+#include <mutex>
+
+enum BotEventType : uint8
+{
+    BOT_EVENT_NONE,
+    BOT_EVENT_SPELLS_CHANGED,       // spell learned, removed or replaced by another rank
+    BOT_EVENT_DUEL_REQUESTED,       // guid: duel arbiter
+    BOT_EVENT_TRADE_STATUS,         // value: TradeStatus, guid: trader when a trade is proposed
+    BOT_EVENT_RESURRECT_REQUEST,    // guid: resurrector
+    BOT_EVENT_LOOT_ROLL_STARTED,    // guid: looted object, value: loot slot
+};
+
+struct BotEvent
+{
+    BotEvent() = default;
+    explicit BotEvent(BotEventType type_, ObjectGuid guid_ = ObjectGuid(), uint32 value_ = 0) :
+        type(type_), guid(guid_), value(value_) {}
+
+    BotEventType type = BOT_EVENT_NONE;
+    ObjectGuid guid;
+    uint32 value = 0;
+};
+
+class BotEventQueue
+{
+public:
+    // Any thread
+    void Post(BotEvent const& event)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        uint32 const count = m_count.load(std::memory_order_relaxed);
+        if (count == CAPACITY)
+            return;
+
+        m_events[(m_head + count) % CAPACITY] = event;
+        m_count.store(count + 1, std::memory_order_release);
+    }
+
+    // Owner's update thread, handlers may post new events
+    template<typename Handler>
+    void Drain(Handler const& handler)
+    {
+        if (!m_count.load(std::memory_order_acquire))
+            return;
+
+        std::array<BotEvent, CAPACITY> events;
+        uint32 count;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            count = m_count.load(std::memory_order_relaxed);
+            for (uint32 i = 0; i < count; ++i)
+                events[i] = m_events[(m_head + i) % CAPACITY];
+            m_head = (m_head + count) % CAPACITY;
+            m_count.store(0, std::memory_order_relaxed);
+        }
+
+        for (uint32 i = 0; i < count; ++i)
+            handler(events[i]);
+    }
+
+private:
+    static constexpr uint32 CAPACITY = 32;
+
+    std::array<BotEvent, CAPACITY> m_events;
+    uint32 m_head = 0;
+    std::atomic<uint32> m_count{ 0 };
+    std::mutex m_mutex;
+};
+
+#endif // MANGOS_BOTEVENTS_H
@@ -0,0 +1,111 @@
+/*
+ * BotLODScheduler.cpp
+ *
+ * Level-of-detail scheduling for RandomBots.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#include "BotLODScheduler.h"
+#include "Player.h"
+#include "Map.h"
+#include "Config/Config.h"
+#include <algorithm>
+
+// ============================================================================
+// Static member initialization
+// ============================================================================
+
+bool BotLODScheduler::s_enabled = false;
+float BotLODScheduler::s_nearDistance = 200.0f;
+float BotLODScheduler::s_farDistance = 1000.0f;
+uint32 BotLODScheduler::s_reducedIntervalMs = 3000;
+uint32 BotLODScheduler::s_virtualIntervalMs = 10000;
+uint32 BotLODScheduler::s_evaluateIntervalMs = 2000;
+uint32 BotLODScheduler::s_virtualKillIntervalMs = 45000;
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+void BotLODScheduler::LoadConfig()
+{
+    s_enabled = sConfig.GetBoolDefault("RandomBot.LOD.Enable", false);
+    s_nearDistance = sConfig.GetFloatDefault("RandomBot.LOD.NearDistance", 200.0f);
+    s_farDistance = sConfig.GetFloatDefault("RandomBot.LOD.FarDistance", 1000.0f);
+    s_reducedIntervalMs = sConfig.GetIntDefault("RandomBot.LOD.ReducedIntervalMs", 3000);
+    s_virtualIntervalMs = sConfig.GetIntDefault("RandomBot.LOD.VirtualIntervalMs", 10000);
+    s_virtualKillIntervalMs = sConfig.GetIntDefault("RandomBot.LOD.VirtualKillIntervalMs", 45000);
+
+    // Far ring can never be inside the near ring, and slower tiers never tick faster
+    s_farDistance = std::max(s_farDistance, s_nearDistance);
+    s_reducedIntervalMs = std::max<uint32>(s_reducedIntervalMs, RB_UPDATE_INTERVAL);
+    s_virtualIntervalMs = std::max(s_virtualIntervalMs, s_reducedIntervalMs);
+}
+
+// ============================================================================
+// Tier Selection
+// ============================================================================
+
+BotLODTier BotLODScheduler::Evaluate(Player* pBot)
+{
+    if (!s_enabled || !pBot)
+        return BotLODTier::FULL;
+
+    // Never degrade a fight in progress
+    if (pBot->IsInCombat() || pBot->GetVictim())
+        return BotLODTier::FULL;
+
+    Map* map = pBot->GetMap();
+    if (!map)
+        return BotLODTier::FULL;
+
+    // Ghosts still need to walk to their corpse, so they never go virtual
+    BotLODTier floor = pBot->IsAlive() ? BotLODTier::VIRTUAL : BotLODTier::REDUCED;
+
+    if (!map->HaveRealPlayers())
+        return floor;
+
+    float nearSq = s_nearDistance * s_nearDistance;
+    float farSq = s_farDistance * s_farDistance;
+    bool anyInRange = false;
+
+    for (auto const& itr : map->GetPlayers())
+    {
+        Player* pPlayer = itr.getSource();
+        if (!pPlayer || pPlayer->IsBot())
+            continue;
+
+        float dx = pPlayer->GetPositionX() - pBot->GetPositionX();
+        float dy = pPlayer->GetPositionY() - pBot->GetPositionY();
+        float distSq = dx * dx + dy * dy;
+
+        if (distSq <= nearSq)
+            return BotLODTier::FULL;
+
+        if (distSq <= farSq)
+            anyInRange = true;
+    }
+
+    return anyInRange ? BotLODTier::REDUCED : floor;
+}
+
+uint32 BotLODScheduler::GetUpdateInterval(BotLODTier tier)
+{
+    switch (tier)
+    {
+        case BotLODTier::REDUCED: return s_reducedIntervalMs;
+        case BotLODTier::VIRTUAL: return s_virtualIntervalMs;
+        default:                  return RB_UPDATE_INTERVAL;
+    }
+}
+
+char const* BotLODScheduler::GetTierName(BotLODTier tier)
+{
+    switch (tier)
+    {
+        case BotLODTier::REDUCED: return "Reduced";
+        case BotLODTier::VIRTUAL: return "Virtual";
+        default:                  return "Full";
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * BotLODScheduler.h
+ *
+ * Level-of-detail scheduling for RandomBots. Picks how much simulation a
+ * bot gets based on how close the nearest real (non-bot) player is:
+ *
+ *   FULL    - a real player is nearby, full-rate AI ticks
+ *   REDUCED - a real player is on the map but far away, slower strategy ticks
+ *   VIRTUAL - nobody can observe the bot, coarse "virtual progression"
+ *             (XP, loot, travel, training) with no grid scans, pathfinding
+ *             or combat simulation
+ *
+ * Tiers are re-evaluated periodically, so bots step back up to FULL as
+ * players approach.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#ifndef MANGOS_BOTLODSCHEDULER_H
+#define MANGOS_BOTLODSCHEDULER_H
+
+#include "Common.h"
+
+class Player;
+
+// AI tick interval (ms) of RandomBots at full detail
+#define RB_UPDATE_INTERVAL 1000
+
+enum class BotLODTier : uint8
+{
+    FULL,
+    REDUCED,
+    VIRTUAL
+};
+
+class BotLODScheduler
+{
+public:
+    // Read RandomBot.LOD.* settings (called from PlayerBotMgr::LoadConfig)
+    static void LoadConfig();
+
+    static bool IsEnabled() { return s_enabled; }
+
+    // Pick the tier for a bot from its surroundings.
+    // Always FULL when LOD is disabled or the bot is in combat.
+    static BotLODTier Evaluate(Player* pBot);
+
+    // AI tick interval (ms) for a tier
+    static uint32 GetUpdateInterval(BotLODTier tier);
+
+    // How often a bot re-evaluates its tier (ms)
+    static uint32 GetEvaluateInterval() { return s_evaluateIntervalMs; }
+
+    // Simulated time between virtual kills (ms)
+    static uint32 GetVirtualKillInterval() { return s_virtualKillIntervalMs; }
+
+    static char const* GetTierName(BotLODTier tier);
+
+private:
+    static bool s_enabled;
+    static float s_nearDistance;
+    static float s_farDistance;
+    static uint32 s_reducedIntervalMs;
+    static uint32 s_virtualIntervalMs;
+    static uint32 s_evaluateIntervalMs;
+    static uint32 s_virtualKillIntervalMs;
+};
+
+#endif // MANGOS_BOTLODSCHEDULER_H
@@ -0,0 +1,319 @@
+/*
+ * BotLoginScheduler.cpp
+ *
+ * Staged, rate-limited login of database bots.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#include "BotLoginScheduler.h"
+#include "PlayerBotMgr.h"
+#include "World.h"
+#include "WorldSession.h"
+#include "MapManager.h"
+#include "Map.h"
+#include "Log.h"
+#include "Timer.h"
+#include "Config/Config.h"
+#include "Database/DatabaseEnv.h"
+#include "Database/DatabaseImpl.h"
+#include <algorithm>
+#include <sstream>
+
+// Map id of bots whose character row was not found
+static constexpr uint32 UNKNOWN_MAP = 0xFFFFFFFF;
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+void BotLoginScheduler::LoadConfig()
+{
+    m_enabled = sConfig.GetBoolDefault("RandomBot.Login.Scheduler", true);
+    m_ratePerMap = std::max(sConfig.GetFloatDefault("RandomBot.Login.RatePerMap", 10.0f), 0.1f);
+    m_maxPrefetch = std::max(sConfig.GetIntDefault("RandomBot.Login.MaxPrefetch", 100), 1);
+}
+
+// ============================================================================
+// Queue
+// ============================================================================
+
+void BotLoginScheduler::Enqueue(std::shared_ptr<PlayerBotEntry> const& entry)
+{
+    if (IsQueued(entry->playerGUID))
+        return;
+
+    if (!m_rampActive)
+    {
+        m_rampActive = true;
+        m_rampStartTime = WorldTimer::getMSTime();
+        m_rampAdmitted = 0;
+        m_rampPeakTick = 0;
+    }
+
+    PendingLogin& pending = m_pending[entry->playerGUID];
+    pending.entry = entry;
+    pending.sequence = m_nextSequence++;
+}
+
+void BotLoginScheduler::Clear()
+{
+    m_pending.clear();
+    m_mapBudget.clear();
+    m_locateBatches.clear();
+    m_inPrefetch = 0;
+    m_rampActive = false;
+}
+
+void BotLoginScheduler::Update(uint32 diff, std::vector<PlayerBotEntry*>& admitted, std::vector<PlayerBotEntry*>& failed)
+{
+    if (!m_rampActive)
+        return;
+
+    m_rampPeakTick = std::max(m_rampPeakTick, diff);
+
+    // Bots removed while queued (DeleteBot, DeleteAll)
+    for (auto itr = m_pending.begin(); itr != m_pending.end();)
+    {
+        if (itr->second.entry->state != PB_STATE_LOADING)
+        {
+            if (itr->second.stage == Stage::PREFETCHING)
+                --m_inPrefetch;
+            itr = m_pending.erase(itr);
+        }
+        else
+            ++itr;
+    }
+
+    RequestLocations();
+    CheckPrefetches(failed);
+    StartPrefetches(failed);
+    AdmitReady(diff, admitted);
+
+    if (m_pending.empty())
+    {
+        m_rampActive = false;
+        m_mapBudget.clear();
+        sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[BotLoginScheduler] %u bots online in %u ms (peak world tick %u ms)",
+            m_rampAdmitted, WorldTimer::getMSTimeDiffToNow(m_rampStartTime), m_rampPeakTick);
+    }
+}
+
+// ============================================================================
+// Stages
+// ============================================================================
+
+void BotLoginScheduler::RequestLocations()
+{
+    std::ostringstream query;
+    std::vector<uint64> batch;
+
+    auto sendBatch = [&]()
+    {
+        query << ")";
+        uint32 batchId = ++m_nextLocateBatch;
+        m_locateBatches[batchId].swap(batch);
+        if (!CharacterDatabase.AsyncQuery(this, &BotLoginScheduler::HandleLocations, batchId, query.str().c_str()))
+        {
+            // Not queued, asked again on the next update
+            std::vector<uint64> const& failed = m_locateBatches[batchId];
+            sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "[BotLoginScheduler] Could not queue the location query of %u bots", uint32(failed.size()));
+            for (uint64 guid : failed)
+            {
+                auto pendingItr = m_pending.find(guid);
+                if (pendingItr != m_pending.end())
+                    pendingItr->second.locationRequested = false;
+            }
+            m_locateBatches.erase(batchId);
+        }
+        query.str("");
+    };
+
+    for (auto& itr : m_pending)
+    {
+        PendingLogin& pending = itr.second;
+        if (pending.stage != Stage::LOCATING || pending.locationRequested)
+            continue;
+
+        query << (batch.empty() ? "SELECT `guid`, `map`, `position_x`, `position_y` FROM `characters` WHERE `guid` IN (" : ",") << itr.first;
+        pending.locationRequested = true;
+        batch.push_back(itr.first);
+
+        if (batch.size() == LOCATE_BATCH_SIZE)
+            sendBatch();
+    }
+
+    if (!batch.empty())
+        sendBatch();
+}
+
+void BotLoginScheduler::HandleLocations(std::unique_ptr<QueryResult> result, uint32 batchId)
+{
+    // Queue cleared while the query ran
+    auto batchItr = m_locateBatches.find(batchId);
+    if (batchItr == m_locateBatches.end())
+        return;
+
+    if (result)
+    {
+        do
+        {
+            Field* fields = result->Fetch();
+
+            // Bot may have been removed while the query ran
+            auto itr = m_pending.find(fields[0].GetUInt32());
+            if (itr == m_pending.end() || itr->second.stage != Stage::LOCATING)
+                continue;
+
+            itr->second.mapId = fields[1].GetUInt32();
+            itr->second.x = fields[2].GetFloat();
+            itr->second.y = fields[3].GetFloat();
+            itr->second.stage = Stage::LOCATED;
+        }
+        while (result->NextRow());
+    }
+
+    // Rows of this batch that were not returned: no position, admit in their own bucket
+    for (uint64 guid : batchItr->second)
+    {
+        auto itr = m_pending.find(guid);
+        if (itr != m_pending.end() && itr->second.stage == Stage::LOCATING && itr->second.locationRequested)
+        {
+            itr->second.mapId = UNKNOWN_MAP;
+            itr->second.stage = Stage::LOCATED;
+        }
+    }
+
+    m_locateBatches.erase(batchItr);
+}
+
+void BotLoginScheduler::StartPrefetches(std::vector<PlayerBotEntry*>& failed)
+{
+    if (m_inPrefetch >= m_maxPrefetch)
+        return;
+
+    std::vector<PendingLogin*> candidates;
+    for (auto& itr : m_pending)
+    {
+        if (itr.second.stage == Stage::LOCATED)
+        {
+            itr.second.gridLoaded = IsGridLoaded(itr.second);
+            candidates.push_back(&itr.second);
+        }
+    }
+
+    // Bots landing in loaded grids first, then queue order
+    std::sort(candidates.begin(), candidates.end(), [](PendingLogin const* a, PendingLogin const* b)
+    {
+        if (a->gridLoaded != b->gridLoaded)
+            return a->gridLoaded;
+        return a->sequence < b->sequence;
+    });
+
+    for (PendingLogin* pending : candidates)
+    {
+        if (m_inPrefetch >= m_maxPrefetch)
+            break;
+
+        PlayerBotEntry* entry = pending->entry.get();
+        WorldSession* sess = sWorld.FindSession(entry->accountId);
+        if (!sess)
+            continue;   // World has not added the session yet
+
+        sess->SetDeferredLogin(true);
+        if (!entry->ai->OnSessionLoaded(entry, sess))
+        {
+            sess->SetDeferredLogin(false);
+            failed.push_back(entry);
+            m_pending.erase(entry->playerGUID);
+            continue;
+        }
+
+        pending->stage = Stage::PREFETCHING;
+        ++m_inPrefetch;
+    }
+}
+
+void BotLoginScheduler::CheckPrefetches(std::vector<PlayerBotEntry*>& failed)
+{
+    for (auto itr = m_pending.begin(); itr != m_pending.end();)
+    {
+        PendingLogin& pending = itr->second;
+        if (pending.stage != Stage::PREFETCHING)
+        {
+            ++itr;
+            continue;
+        }
+
+        WorldSession* sess = sWorld.FindSession(pending.entry->accountId);
+        if (sess && sess->HasDeferredLoginData())
+        {
+            pending.stage = Stage::READY;
+            --m_inPrefetch;
+        }
+        else if (!sess || !sess->PlayerLoading())
+        {
+            // Query holder could not be set up
+            failed.push_back(pending.entry.get());
+            --m_inPrefetch;
+            itr = m_pending.erase(itr);
+            continue;
+        }
+
+        ++itr;
+    }
+}
+
+void BotLoginScheduler::AdmitReady(uint32 diff, std::vector<PlayerBotEntry*>& admitted)
+{
+    std::vector<PendingLogin*> ready;
+    for (auto& itr : m_pending)
+    {
+        if (itr.second.stage == Stage::READY)
+        {
+            itr.second.gridLoaded = IsGridLoaded(itr.second);
+            ready.push_back(&itr.second);
+        }
+    }
+
+    // Refill map budgets, at most one second worth of logins is kept
+    for (PendingLogin const* pending : ready)
+        m_mapBudget.emplace(pending->mapId, 1.0f);
+    for (auto& budget : m_mapBudget)
+        budget.second = std::min(budget.second + m_ratePerMap * diff / IN_MILLISECONDS, std::max(m_ratePerMap, 1.0f));
+
+    std::sort(ready.begin(), ready.end(), [](PendingLogin const* a, PendingLogin const* b)
+    {
+        if (a->gridLoaded != b->gridLoaded)
+            return a->gridLoaded;
+        return a->sequence < b->sequence;
+    });
+
+    for (PendingLogin* pending : ready)
+    {
+        float& budget = m_mapBudget[pending->mapId];
+        if (budget < 1.0f)
+            continue;
+
+        PlayerBotEntry* entry = pending->entry.get();
+        WorldSession* sess = sWorld.FindSession(entry->accountId);
+        if (!sess)
+            continue;
+
+        budget -= 1.0f;
+        sess->CompleteDeferredLogin();
+        admitted.push_back(entry);
+        ++m_rampAdmitted;
+        m_pending.erase(entry->playerGUID);
+    }
+}
+
+bool BotLoginScheduler::IsGridLoaded(PendingLogin const& pending) const
+{
+    if (pending.mapId == UNKNOWN_MAP)
+        return false;
+
+    uint32 const instanceId = sMapMgr.GetContinentInstanceId(pending.mapId, pending.x, pending.y);
+    Map const* map = sMapMgr.FindMap(pending.mapId, instanceId);
+    return map && map->IsLoaded(pending.x, pending.y);
+}
@@ -0,0 +1,105 @@
+/*
+ * BotLoginScheduler.h
+ *
+ * Staged, rate-limited login of database bots. Instead of every new bot
+ * session loading its character and entering the world at once, bots go
+ * through three stages:
+ *
+ *   LOCATING    - map and position of queued bots are read in one batched
+ *                 query, so admission can be planned per map
+ *   PREFETCHING - the character query holder is loaded ahead of admission,
+ *                 a bounded number at a time
+ *   READY       - the holder is loaded, the bot waits for its map's budget
+ *
+ * READY bots enter the world at RandomBot.Login.RatePerMap per second and
+ * per map, bots standing in already loaded grids first. The time until all
+ * queued bots are online and the longest world tick during the ramp are
+ * logged once the queue drains.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#ifndef MANGOS_BOTLOGINSCHEDULER_H
+#define MANGOS_BOTLOGINSCHEDULER_H
+
+#include "Common.h"
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+struct PlayerBotEntry;
+class QueryResult;
+
+class BotLoginScheduler
+{
+public:
+    // Read RandomBot.Login.* settings (called from PlayerBotMgr::LoadConfig)
+    void LoadConfig();
+
+    bool IsEnabled() const { return m_enabled; }
+
+    // Take over the login of a bot whose session was just added to the world
+    void Enqueue(std::shared_ptr<PlayerBotEntry> const& entry);
+    bool IsQueued(uint64 playerGuid) const { return m_pending.find(playerGuid) != m_pending.end(); }
+
+    // Every world tick. Bots that entered the world are appended to
+    // admitted, bots whose login could not be started to failed.
+    void Update(uint32 diff, std::vector<PlayerBotEntry*>& admitted, std::vector<PlayerBotEntry*>& failed);
+
+    // Forget all queued bots (their sessions are logged out by the caller)
+    void Clear();
+
+    uint32 GetQueuedCount() const { return uint32(m_pending.size()); }
+
+private:
+    enum class Stage : uint8
+    {
+        LOCATING,
+        LOCATED,
+        PREFETCHING,
+        READY
+    };
+
+    struct PendingLogin
+    {
+        std::shared_ptr<PlayerBotEntry> entry;
+        Stage stage = Stage::LOCATING;
+        bool locationRequested = false;
+        bool gridLoaded = false;
+        uint32 mapId = 0;
+        float x = 0.0f;
+        float y = 0.0f;
+        uint32 sequence = 0;        // queue order
+    };
+
+    void RequestLocations();
+    void HandleLocations(std::unique_ptr<QueryResult> result, uint32 batchId);
+    void StartPrefetches(std::vector<PlayerBotEntry*>& failed);
+    void CheckPrefetches(std::vector<PlayerBotEntry*>& failed);
+    void AdmitReady(uint32 diff, std::vector<PlayerBotEntry*>& admitted);
+    bool IsGridLoaded(PendingLogin const& pending) const;
+
+    std::map<uint64 /*pl guid*/, PendingLogin> m_pending;
+    std::unordered_map<uint32 /*map*/, float> m_mapBudget;
+    std::unordered_map<uint32 /*batch*/, std::vector<uint64>> m_locateBatches;    // guids of each location query in flight
+    uint32 m_nextLocateBatch = 0;
+    uint32 m_nextSequence = 0;
+    uint32 m_inPrefetch = 0;
+
+    // Current ramp
+    bool m_rampActive = false;
+    uint32 m_rampStartTime = 0;
+    uint32 m_rampAdmitted = 0;
+    uint32 m_rampPeakTick = 0;
+
+    // Config
+    bool m_enabled = true;
+    float m_ratePerMap = 10.0f;
+    uint32 m_maxPrefetch = 100;
+
+    // Guids per batched location query
+    static constexpr uint32 LOCATE_BATCH_SIZE = 500;
+};
+
+#endif // MANGOS_BOTLOGINSCHEDULER_H
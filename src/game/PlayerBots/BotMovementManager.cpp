@@ -11,10 +11,14 @@
 #include "World.h"
 #include "MotionMaster.h"
 #include "PathFinder.h"
+#include "PathRequestService.h"
+#include "PathCache.h"
 #include "SpellAuraDefines.h"
 #include "ObjectAccessor.h"
 #include "Log.h"
+#include "IVMapManager.h"
 
+#include <algorithm>
 #include <cmath>
 
 // Note: frand() is already defined in Util.h
@@ -37,6 +41,7 @@ void BotMovementManager::SetBot(Player* bot)
     m_bot = bot;
     m_botGuid = bot ? bot->GetObjectGuid() : ObjectGuid();
     m_state.Clear();  // Clear stale movement state
+    m_pending.Clear();
 }
 
 // ============================================================================
@@ -71,21 +76,38 @@ MoveResult BotMovementManager::MoveTo(float x, float y, float z, MovementPriorit
     if (bestZ <= INVALID_HEIGHT)
         return MoveResult::FAILED_INVALID_POS;
 
-    // Step 6: Path Validation
-    if (!ValidatePath(x, y, bestZ))
-        return MoveResult::FAILED_NO_PATH;
+    // Step 6: Path Validation (asynchronous, finished in UpdatePendingMove)
+    if (m_pending.ticket)
+    {
+        // Same destination already requested: keep waiting for it
+        float dx = x - m_pending.x;
+        float dy = y - m_pending.y;
+        if (m_pending.mapId == m_bot->GetMapId() && dx * dx + dy * dy < 0.25f)
+        {
+            m_pending.priority = std::max(m_pending.priority, priority);
+            m_pending.pointId = pointId;
+            return MoveResult::PENDING_PATH;
+        }
 
-    // Step 7: Issue Movement (pointId passed to MovementInform callback)
-    m_bot->GetMotionMaster()->MovePoint(pointId, x, y, bestZ,
-        MOVE_PATHFINDING | MOVE_RUN_MODE | MOVE_EXCLUDE_STEEP_SLOPES);
+        if (priority < m_pending.priority)
+            return MoveResult::FAILED_PRIORITY;
+
+        CancelPendingMove();
+    }
 
-    // Step 8: Record State
-    float distance = m_bot->GetDistance(x, y, bestZ);
-    uint32 duration = CalculateMoveDelay(distance);
-    RecordMovement(x, y, bestZ, priority, duration);
+    Vector3 start(m_bot->GetPositionX(), m_bot->GetPositionY(), m_bot->GetPositionZ());
+    m_pending.ticket = m_bot->GetMap()->GetPathRequests().Submit(m_bot, start, Vector3(x, y, bestZ));
+    m_pending.mapId = m_bot->GetMapId();
+    m_pending.x = x;
+    m_pending.y = y;
+    m_pending.z = bestZ;
+    m_pending.priority = priority;
+    m_pending.pointId = pointId;
 
     m_lastMoveCommandTime = now;
-    return MoveResult::SUCCESS;
+
+    // Cached paths are ready immediately
+    return UpdatePendingMove();
 }
 
 MoveResult BotMovementManager::MoveNear(float x, float y, float z, float maxDist, MovementPriority priority)
@@ -122,11 +144,7 @@ MoveResult BotMovementManager::MoveNear(float x, float y, float z, float maxDist
         if (!m_bot->IsWithinLOS(tryX, tryY, tryZ + 1.5f))
             continue;
 
-        // Validate path exists
-        if (!ValidatePath(tryX, tryY, tryZ))
-            continue;
-
-        // Found valid position - move there
+        // Found valid position - move there (MoveTo validates the path)
         return MoveTo(tryX, tryY, tryZ, priority);
     }
 
@@ -182,6 +200,7 @@ MoveResult BotMovementManager::Chase(Unit* target, float distance, MovementPrior
         return MoveResult::FAILED_COOLDOWN;
 
     // Issue chase - let engine handle pathfinding
+    CancelPendingMove();
     m_bot->GetMotionMaster()->MoveChase(target, distance);
 
     // Record state
@@ -267,6 +286,7 @@ MoveResult BotMovementManager::MoveAway(Unit* threat, float distance, MovementPr
             continue;
 
         // Found valid flee point
+        CancelPendingMove();
         m_bot->GetMotionMaster()->MovePoint(0, tryX, tryY, tryZ,
             MOVE_PATHFINDING | MOVE_RUN_MODE | MOVE_EXCLUDE_STEEP_SLOPES);
 
@@ -287,6 +307,7 @@ void BotMovementManager::StopMovement(bool force)
 
     if (force || m_state.priority < MovementPriority::PRIORITY_FORCED)
     {
+        CancelPendingMove();
         m_bot->StopMoving();
         m_bot->GetMotionMaster()->Clear();
         m_state.Clear();
@@ -303,6 +324,9 @@ bool BotMovementManager::Update(uint32 diff)
     if (!IsValid())
         return false;
 
+    if (m_pending.ticket)
+        UpdatePendingMove();
+
     if (!IsMoving())
     {
         m_state.stuckCount = 0;
@@ -529,10 +553,26 @@ float BotMovementManager::SearchBestZ(float x, float y, float hintZ) const
 
 bool BotMovementManager::ValidatePath(float x, float y, float z) const
 {
-    PathFinder path(m_bot);
-    path.calculate(x, y, z);
+    PathCache& cache = m_bot->GetMap()->GetPathCache();
+    Vector3 start(m_bot->GetPositionX(), m_bot->GetPositionY(), m_bot->GetPositionZ());
+    Vector3 dest(x, y, z);
+
+    // Transport paths are in passenger coordinates, never cache those
+    PathRequestResult result;
+    if (m_bot->GetTransport() || !cache.Find(start, dest, result))
+    {
+        PathFinder path(m_bot);
+        path.calculate(x, y, z);
+
+        result.type = path.getPathType();
+        result.path = path.getPath();
+        result.actualEnd = path.getActualEndPosition();
+        result.length = path.Length();
+        if (!m_bot->GetTransport())
+            cache.Store(start, dest, result);
+    }
 
-    PathType pathType = path.getPathType();
+    PathType pathType = result.type;
 
     // Accept normal complete paths
     if (pathType == PATHFIND_NORMAL)
@@ -559,6 +599,13 @@ std::vector<Vector3> BotMovementManager::SmoothPath(std::vector<Vector3> const&
     smoothed.reserve(path.size());
     smoothed.push_back(path[0]);  // Always keep start
 
+    // Skips from the current anchor, traced in one batch. Only anchors the
+    // greedy walk actually stops at are traced.
+    std::vector<VMAP::LineOfSightSegment> segments;
+    std::vector<size_t> targets;
+    segments.reserve(PATH_SMOOTH_LOOKAHEAD - 1);
+    targets.reserve(PATH_SMOOTH_LOOKAHEAD - 1);
+
     size_t current = 0;
 
     while (current < path.size() - 1)
@@ -566,13 +613,30 @@ std::vector<Vector3> BotMovementManager::SmoothPath(std::vector<Vector3> const&
         // Look ahead to find furthest reachable waypoint
         size_t furthest = current + 1;
 
-        for (size_t lookahead = current + 2;
-             lookahead < path.size() && lookahead <= current + PATH_SMOOTH_LOOKAHEAD;
-             ++lookahead)
+        segments.clear();
+        targets.clear();
+        for (size_t lookahead = std::min(current + PATH_SMOOTH_LOOKAHEAD, path.size() - 1);
+             lookahead >= current + 2;
+             --lookahead)
+        {
+            if (!IsWorthSkipping(path[current], path[lookahead]))
+                continue;
+
+            targets.push_back(lookahead);
+            segments.push_back({ path[current].x, path[current].y, path[current].z + 1.5f,  // Eye height
+                                 path[lookahead].x, path[lookahead].y, path[lookahead].z + 1.5f, false });
+        }
+
+        if (!segments.empty())
+            m_bot->GetMap()->areInLineOfSight(segments.data(), uint32(segments.size()));
+
+        // Furthest first
+        for (size_t i = 0; i < segments.size(); ++i)
         {
-            if (CanSkipToWaypoint(path[current], path[lookahead]))
+            if (segments[i].inLineOfSight && IsWalkableStraightLine(path[current], path[targets[i]]))
             {
-                furthest = lookahead;
+                furthest = targets[i];
+                break;
             }
         }
 
@@ -584,24 +648,18 @@ std::vector<Vector3> BotMovementManager::SmoothPath(std::vector<Vector3> const&
     return smoothed;
 }
 
-bool BotMovementManager::CanSkipToWaypoint(Vector3 const& from, Vector3 const& to) const
+bool BotMovementManager::IsWorthSkipping(Vector3 const& from, Vector3 const& to) const
 {
     // Distance check - don't skip very short segments
     float dx = to.x - from.x;
     float dy = to.y - from.y;
     float dist = sqrt(dx * dx + dy * dy);
 
-    if (dist < PATH_SMOOTH_MIN_SKIP_DIST)
-        return false;
-
-    // Line of sight check (no phase mask in vanilla WoW)
-    if (!m_bot->GetMap()->isInLineOfSight(
-        from.x, from.y, from.z + 1.5f,  // Eye height
-        to.x, to.y, to.z + 1.5f))
-    {
-        return false;
-    }
+    return dist >= PATH_SMOOTH_MIN_SKIP_DIST;
+}
 
+bool BotMovementManager::IsWalkableStraightLine(Vector3 const& from, Vector3 const& to) const
+{
     // Terrain walkability check - ensure no steep slopes or water between points
     // Sample a few points along the line
     const int samples = 3;
@@ -665,6 +723,8 @@ bool BotMovementManager::TryMicroRecovery()
 
 void BotMovementManager::EmergencyTeleport()
 {
+    CancelPendingMove();
+
     // Teleport to bind location (hearthstone location)
     // Use TeleportToHomebind with no hearthstone cooldown
     m_bot->TeleportToHomebind(0, false);
@@ -736,3 +796,62 @@ void BotMovementManager::RecordMovement(float x, float y, float z, MovementPrior
     m_state.lastProgressTime = m_state.moveStartTime;
     m_state.stuckCount = 0;
 }
+
+// ============================================================================
+// Asynchronous Path Validation
+// ============================================================================
+
+MoveResult BotMovementManager::UpdatePendingMove()
+{
+    // Teleported since the request: the old map owns the ticket
+    if (m_pending.mapId != m_bot->GetMapId())
+    {
+        m_pending.Clear();
+        return MoveResult::FAILED_INVALID_POS;
+    }
+
+    PathRequestResult result;
+    PathRequestStatus status = m_bot->GetMap()->GetPathRequests().Poll(m_pending.ticket, result);
+    if (status == PathRequestStatus::PENDING)
+        return MoveResult::PENDING_PATH;
+
+    PendingMove move = m_pending;
+    m_pending.Clear();
+
+    if (status != PathRequestStatus::READY)
+        return MoveResult::FAILED_NO_PATH;
+
+    // Accept normal complete paths and incomplete but usable ones (long distance)
+    if (result.type != PATHFIND_NORMAL && result.type != PATHFIND_INCOMPLETE)
+    {
+        sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
+            "[BotMovement] %s no path to (%.1f, %.1f, %.1f)",
+            m_bot->GetName(), move.x, move.y, move.z);
+        return MoveResult::FAILED_NO_PATH;
+    }
+
+    // Things may have changed while the path was computed
+    if (IsCC())
+        return MoveResult::FAILED_CC;
+    if (IsMoving() && m_state.priority > move.priority)
+        return MoveResult::FAILED_PRIORITY;
+
+    m_bot->GetMotionMaster()->MovePoint(move.pointId, move.x, move.y, move.z,
+        MOVE_PATHFINDING | MOVE_RUN_MODE | MOVE_EXCLUDE_STEEP_SLOPES);
+
+    float distance = m_bot->GetDistance(move.x, move.y, move.z);
+    RecordMovement(move.x, move.y, move.z, move.priority, CalculateMoveDelay(distance));
+    m_lastMoveCommandTime = WorldTimer::getMSTime();
+    return MoveResult::SUCCESS;
+}
+
+void BotMovementManager::CancelPendingMove()
+{
+    if (!m_pending.ticket)
+        return;
+
+    if (m_pending.mapId == m_bot->GetMapId())
+        m_bot->GetMap()->GetPathRequests().Cancel(m_pending.ticket);
+
+    m_pending.Clear();
+}
@@ -53,7 +53,8 @@ enum class MoveResult : uint8
     FAILED_NO_PATH,         // PathFinder couldn't find route
     FAILED_INVALID_TARGET,  // Target null or wrong map
     FAILED_INVALID_POS,     // Destination has no valid terrain
-    FAILED_COOLDOWN         // Too soon after last move command
+    FAILED_COOLDOWN,        // Too soon after last move command
+    PENDING_PATH            // Path requested, movement starts once it is validated
 };
 
 // State tracking structure (inspired by AzerothCore LastMovement)
@@ -96,6 +97,20 @@ struct MovementState
     }
 };
 
+// Point move waiting on an asynchronous path request (see PathRequestService)
+struct PendingMove
+{
+    uint32 ticket = 0;              // PathTicket, 0 = nothing pending
+    uint32 mapId = 0;
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+    MovementPriority priority = MovementPriority::PRIORITY_IDLE;
+    uint32 pointId = 0;
+
+    void Clear() { ticket = 0; }
+};
+
 class BotMovementManager
 {
 public:
@@ -110,6 +125,9 @@ public:
 
     // Move to a specific point (travel, vendor, loot, ghost)
     // pointId is passed to MovementInform callback (use for waypoint tracking)
+    // The path is validated off the map thread: PENDING_PATH means the move
+    // starts on a later Update() once the path comes back. Paths found in
+    // the map's PathCache start moving right away.
     MoveResult MoveTo(float x, float y, float z,
                       MovementPriority priority = MovementPriority::PRIORITY_NORMAL,
                       uint32 pointId = 0);
@@ -130,7 +148,7 @@ public:
     MoveResult ChaseAtAngle(Unit* target, float distance, float angle,
                             MovementPriority priority = MovementPriority::PRIORITY_COMBAT);
 
-    // Move away from a threat (flee)
+    // Move away from a threat (flee). Validated synchronously, fleeing can't wait a tick.
     MoveResult MoveAway(Unit* threat, float distance = 15.0f,
                         MovementPriority priority = MovementPriority::PRIORITY_FORCED);
 
@@ -153,6 +171,9 @@ public:
     // Is bot waiting for a higher priority move to complete?
     bool IsWaitingForMove(MovementPriority priority) const;
 
+    // Is a point move waiting for its path?
+    bool HasPendingMove() const { return m_pending.ticket != 0; }
+
     // Would this move be a duplicate of current movement?
     bool IsDuplicateMove(float x, float y, float z, float tolerance = 0.5f) const;
 
@@ -172,7 +193,7 @@ public:
     // Multi-Z height search (tries 5 heights like AzerothCore)
     float SearchBestZ(float x, float y, float hintZ) const;
 
-    // Validate a path exists to destination
+    // Validate a path exists to destination (synchronous, uses the map's PathCache)
     bool ValidatePath(float x, float y, float z) const;
 
     // === PATH SMOOTHING ===
@@ -180,8 +201,10 @@ public:
     // Smooth a path by skipping unnecessary waypoints (LoS-based)
     std::vector<Vector3> SmoothPath(std::vector<Vector3> const& path) const;
 
-    // Check if we can skip directly to a further waypoint
-    bool CanSkipToWaypoint(Vector3 const& from, Vector3 const& to) const;
+    // Skip candidates: far enough apart, and no steep terrain in between.
+    // Line of sight is checked by SmoothPath for all candidates at once.
+    bool IsWorthSkipping(Vector3 const& from, Vector3 const& to) const;
+    bool IsWalkableStraightLine(Vector3 const& from, Vector3 const& to) const;
 
     // === STUCK RECOVERY ===
 
@@ -198,6 +221,7 @@ private:
     Player* m_bot;
     ObjectGuid m_botGuid;  // Store GUID to validate pointer against use-after-free
     MovementState m_state;
+    PendingMove m_pending;
 
     // Timing
     uint32 m_lastMoveCommandTime = 0;   // Prevent command spam
@@ -245,6 +269,8 @@ private:
     bool IsCC() const;  // Stun/root/freeze/confuse check
     void UpdateStuckDetection(uint32 diff);
     void RecordMovement(float x, float y, float z, MovementPriority priority, uint32 duration);
+    MoveResult UpdatePendingMove();
+    void CancelPendingMove();
 };
 
 #endif // BOT_MOVEMENT_MANAGER_H
@@ -0,0 +1,211 @@
+/*
+ * BotProfiler.cpp
+ *
+ * CPU time spent in the RandomBot AI, per section and per bot.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#include "BotProfiler.h"
+#include "SharedDefines.h"
+#include "Config/Config.h"
+#include <thread>
+
+// ============================================================================
+// Static member initialization
+// ============================================================================
+
+std::atomic<bool> BotProfiler::s_enabled(false);
+std::atomic<uint32> BotProfiler::s_generation(1);
+std::atomic<uint64> BotProfiler::s_totalTicks[MAX_BOT_PROFILE_SECTIONS] = {};
+std::atomic<uint64> BotProfiler::s_maxTicks[MAX_BOT_PROFILE_SECTIONS] = {};
+std::atomic<uint64> BotProfiler::s_calls[MAX_BOT_PROFILE_SECTIONS] = {};
+std::atomic<uint64> BotProfiler::s_histogram[MAX_BOT_PROFILE_SECTIONS][BOT_PROFILE_HISTOGRAM_BUCKETS] = {};
+double BotProfiler::s_usPerTick = 0.0;
+double BotProfiler::s_ticksPerUs = 0.0;
+uint32 BotProfiler::s_logIntervalMs = 60000;
+std::chrono::steady_clock::time_point BotProfiler::s_resetTime = std::chrono::steady_clock::now();
+
+namespace
+{
+    // Reference point for the tick rate, taken at process start
+    uint64 const s_calibrationTicks = BotProfiler::Now();
+    std::chrono::steady_clock::time_point const s_calibrationTime = std::chrono::steady_clock::now();
+
+    // Shortest span the tick rate is measured over
+    constexpr int64 MIN_CALIBRATION_US = 10000;
+}
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+void BotProfiler::LoadConfig()
+{
+    // Before any bot is updated, the ratio is read without locking
+    Calibrate();
+
+    s_logIntervalMs = sConfig.GetIntDefault("RandomBot.Profile.LogIntervalMs", 60000);
+    SetEnabled(sConfig.GetBoolDefault("RandomBot.Profile.Enable", false));
+}
+
+void BotProfiler::Calibrate()
+{
+    if (s_ticksPerUs > 0.0)
+        return;
+
+    int64 elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - s_calibrationTime).count();
+    if (elapsedUs < MIN_CALIBRATION_US)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(MIN_CALIBRATION_US - elapsedUs));
+        elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - s_calibrationTime).count();
+    }
+
+    s_ticksPerUs = std::max(double(Now() - s_calibrationTicks) / elapsedUs, 1e-3);
+    s_usPerTick = 1.0 / s_ticksPerUs;
+}
+
+void BotProfiler::SetEnabled(bool enabled)
+{
+    // Each run starts from empty counters
+    if (enabled && !IsEnabled())
+        Reset();
+
+    s_enabled = enabled;
+}
+
+// ============================================================================
+// Counters
+// ============================================================================
+
+void BotProfiler::Add(BotProfileSection section, uint64 elapsedTicks)
+{
+    s_totalTicks[section].fetch_add(elapsedTicks, std::memory_order_relaxed);
+    s_calls[section].fetch_add(1, std::memory_order_relaxed);
+
+    uint64 us = uint64(elapsedTicks * s_usPerTick);
+    uint32 bucket = 0;
+    while (us && bucket < BOT_PROFILE_HISTOGRAM_BUCKETS - 1)
+    {
+        us >>= 1;
+        ++bucket;
+    }
+    s_histogram[section][bucket].fetch_add(1, std::memory_order_relaxed);
+
+    uint64 max = s_maxTicks[section].load(std::memory_order_relaxed);
+    while (elapsedTicks > max && !s_maxTicks[section].compare_exchange_weak(max, elapsedTicks, std::memory_order_relaxed))
+        ;
+}
+
+void BotProfiler::Reset()
+{
+    for (uint32 i = 0; i < MAX_BOT_PROFILE_SECTIONS; ++i)
+    {
+        s_totalTicks[i] = 0;
+        s_maxTicks[i] = 0;
+        s_calls[i] = 0;
+        for (uint32 bucket = 0; bucket < BOT_PROFILE_HISTOGRAM_BUCKETS; ++bucket)
+            s_histogram[i][bucket] = 0;
+    }
+
+    ++s_generation;
+    s_resetTime = std::chrono::steady_clock::now();
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+BotProfileSection BotProfiler::GetCombatSection(uint8 playerClass)
+{
+    switch (playerClass)
+    {
+        case CLASS_WARRIOR: return BOT_PROFILE_COMBAT_WARRIOR;
+        case CLASS_PALADIN: return BOT_PROFILE_COMBAT_PALADIN;
+        case CLASS_HUNTER:  return BOT_PROFILE_COMBAT_HUNTER;
+        case CLASS_ROGUE:   return BOT_PROFILE_COMBAT_ROGUE;
+        case CLASS_PRIEST:  return BOT_PROFILE_COMBAT_PRIEST;
+        case CLASS_SHAMAN:  return BOT_PROFILE_COMBAT_SHAMAN;
+        case CLASS_MAGE:    return BOT_PROFILE_COMBAT_MAGE;
+        case CLASS_WARLOCK: return BOT_PROFILE_COMBAT_WARLOCK;
+        case CLASS_DRUID:   return BOT_PROFILE_COMBAT_DRUID;
+        default:            return BOT_PROFILE_IN_COMBAT;   // no combat handler for it
+    }
+}
+
+char const* BotProfiler::GetSectionName(BotProfileSection section)
+{
+    switch (section)
+    {
+        case BOT_PROFILE_UPDATE_AI:         return "UpdateAI";
+        case BOT_PROFILE_IN_COMBAT:         return "InCombatAI";
+        case BOT_PROFILE_OUT_OF_COMBAT:     return "OutOfCombatAI";
+        case BOT_PROFILE_GRINDING:          return "GrindingStrategy";
+        case BOT_PROFILE_TRAVELING:         return "TravelingStrategy";
+        case BOT_PROFILE_QUESTING:          return "QuestingActivity";
+        case BOT_PROFILE_VENDORING:         return "VendoringStrategy";
+        case BOT_PROFILE_LOOTING:           return "LootingBehavior";
+        case BOT_PROFILE_TRAINING:          return "TrainingStrategy";
+        case BOT_PROFILE_GHOST_WALKING:     return "GhostWalkingStrategy";
+        case BOT_PROFILE_COMBAT_WARRIOR:    return "WarriorCombat";
+        case BOT_PROFILE_COMBAT_PALADIN:    return "PaladinCombat";
+        case BOT_PROFILE_COMBAT_HUNTER:     return "HunterCombat";
+        case BOT_PROFILE_COMBAT_ROGUE:      return "RogueCombat";
+        case BOT_PROFILE_COMBAT_PRIEST:     return "PriestCombat";
+        case BOT_PROFILE_COMBAT_SHAMAN:     return "ShamanCombat";
+        case BOT_PROFILE_COMBAT_MAGE:       return "MageCombat";
+        case BOT_PROFILE_COMBAT_WARLOCK:    return "WarlockCombat";
+        case BOT_PROFILE_COMBAT_DRUID:      return "DruidCombat";
+        default:                            return "Unknown";
+    }
+}
+
+uint32 BotProfiler::GetPercentileBucket(BotProfileSection section, uint64 calls, double fraction)
+{
+    uint64 const wanted = std::max<uint64>(uint64(calls * fraction), 1);
+    uint64 seen = 0;
+    for (uint32 bucket = 0; bucket < BOT_PROFILE_HISTOGRAM_BUCKETS; ++bucket)
+    {
+        seen += s_histogram[section][bucket].load(std::memory_order_relaxed);
+        if (seen >= wanted)
+            return bucket;
+    }
+    return BOT_PROFILE_HISTOGRAM_BUCKETS - 1;
+}
+
+void BotProfiler::BuildSectionReport(std::vector<std::string>& lines)
+{
+    double const windowSec = std::max(std::chrono::duration<double>(std::chrono::steady_clock::now() - s_resetTime).count(), 0.001);
+
+    auto bucketLabel = [](uint32 bucket)
+    {
+        char label[32];
+        if (bucket == BOT_PROFILE_HISTOGRAM_BUCKETS - 1)
+            snprintf(label, sizeof(label), ">=%uus", 1u << (bucket - 1));
+        else
+            snprintf(label, sizeof(label), "<%uus", 1u << bucket);
+        return std::string(label);
+    };
+
+    char line[256];
+    snprintf(line, sizeof(line), "Bot profile over %.0fs (%s), thread time per section:",
+        windowSec, IsEnabled() ? "running" : "stopped");
+    lines.push_back(line);
+
+    for (uint32 i = 0; i < MAX_BOT_PROFILE_SECTIONS; ++i)
+    {
+        BotProfileSection const section = BotProfileSection(i);
+        uint64 const calls = s_calls[i].load(std::memory_order_relaxed);
+        if (!calls)
+            continue;
+
+        double const totalMs = TicksToUs(s_totalTicks[i].load(std::memory_order_relaxed)) / 1000.0;
+        snprintf(line, sizeof(line), "%-20s " UI64FMTD " calls, %.1f ms (%.2f ms/s), avg %.1fus, p50 %s, p99 %s, max %.0fus",
+            GetSectionName(section), calls, totalMs, totalMs / windowSec,
+            totalMs * 1000.0 / calls,
+            bucketLabel(GetPercentileBucket(section, calls, 0.5)).c_str(),
+            bucketLabel(GetPercentileBucket(section, calls, 0.99)).c_str(),
+            TicksToUs(s_maxTicks[i].load(std::memory_order_relaxed)));
+        lines.push_back(line);
+    }
+}
@@ -0,0 +1,191 @@
+/*
+ * BotProfiler.h
+ *
+ * CPU time spent in the RandomBot AI, per section and per bot. The AI
+ * tick, its combat and out of combat halves, each strategy update and
+ * each class combat rotation open a BotProfileScope; while profiling is
+ * enabled the elapsed time is added to the section's total, call count
+ * and log2 histogram. The AI tick scope also adds to the bot's own
+ * BotProfileCounter, from which the most expensive bots are listed.
+ * Counters are atomic since maps update bots on several threads, so
+ * totals are summed thread time.
+ *
+ * Scopes read the CPU time stamp counter where there is one, and the
+ * steady clock otherwise. Ticks are converted to time with a ratio
+ * measured against the steady clock when the config is loaded.
+ *
+ * Sections are inclusive: a strategy calling into another one (travel from
+ * grinding, looting from grinding) is counted in both.
+ *
+ * Disabled by default; a disabled scope does not read the clock.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#ifndef MANGOS_BOTPROFILER_H
+#define MANGOS_BOTPROFILER_H
+
+#include "Common.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define BOT_PROFILE_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BOT_PROFILE_TSC 1
+#endif
+
+enum BotProfileSection : uint8
+{
+    BOT_PROFILE_UPDATE_AI,          // one AI tick, throttled calls not counted
+    BOT_PROFILE_IN_COMBAT,
+    BOT_PROFILE_OUT_OF_COMBAT,
+
+    BOT_PROFILE_GRINDING,
+    BOT_PROFILE_TRAVELING,
+    BOT_PROFILE_QUESTING,
+    BOT_PROFILE_VENDORING,
+    BOT_PROFILE_LOOTING,
+    BOT_PROFILE_TRAINING,
+    BOT_PROFILE_GHOST_WALKING,
+
+    // Class combat rotations
+    BOT_PROFILE_COMBAT_WARRIOR,
+    BOT_PROFILE_COMBAT_PALADIN,
+    BOT_PROFILE_COMBAT_HUNTER,
+    BOT_PROFILE_COMBAT_ROGUE,
+    BOT_PROFILE_COMBAT_PRIEST,
+    BOT_PROFILE_COMBAT_SHAMAN,
+    BOT_PROFILE_COMBAT_MAGE,
+    BOT_PROFILE_COMBAT_WARLOCK,
+    BOT_PROFILE_COMBAT_DRUID,
+
+    MAX_BOT_PROFILE_SECTIONS
+};
+
+// Bucket 0 is under 1us, bucket n is [2^(n-1), 2^n) us, the last one is open
+#define BOT_PROFILE_HISTOGRAM_BUCKETS 16
+
+class BotProfiler
+{
+public:
+    static void LoadConfig();
+
+    static void SetEnabled(bool enabled);
+    static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+    // Ms between LOG_PERFORMANCE summaries while enabled, 0 for none
+    static uint32 GetLogInterval() { return s_logIntervalMs; }
+
+    static uint64 Now()
+    {
+#ifdef BOT_PROFILE_TSC
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    static void Add(BotProfileSection section, uint64 elapsedTicks);
+    static void Reset();
+
+    // Bumped on each reset, bot counters from an older one read as zero
+    static uint32 GetGeneration() { return s_generation.load(std::memory_order_relaxed); }
+
+    static double TicksToUs(uint64 ticks) { return ticks * s_usPerTick; }
+
+    // Totals since the last reset
+    static uint64 GetTotalTicks(BotProfileSection section) { return s_totalTicks[section].load(std::memory_order_relaxed); }
+    static uint64 GetCalls(BotProfileSection section) { return s_calls[section].load(std::memory_order_relaxed); }
+
+    static BotProfileSection GetCombatSection(uint8 playerClass);
+    static char const* GetSectionName(BotProfileSection section);
+
+    // One line per section called since the last reset
+    static void BuildSectionReport(std::vector<std::string>& lines);
+
+private:
+    static void Calibrate();
+    static uint32 GetPercentileBucket(BotProfileSection section, uint64 calls, double fraction);
+
+    static std::atomic<bool> s_enabled;
+    static std::atomic<uint32> s_generation;
+    static std::atomic<uint64> s_totalTicks[MAX_BOT_PROFILE_SECTIONS];
+    static std::atomic<uint64> s_maxTicks[MAX_BOT_PROFILE_SECTIONS];
+    static std::atomic<uint64> s_calls[MAX_BOT_PROFILE_SECTIONS];
+    static std::atomic<uint64> s_histogram[MAX_BOT_PROFILE_SECTIONS][BOT_PROFILE_HISTOGRAM_BUCKETS];
+    static double s_usPerTick;
+    static double s_ticksPerUs;
+    static uint32 s_logIntervalMs;
+    static std::chrono::steady_clock::time_point s_resetTime;
+};
+
+// Running cost of one bot's AI ticks, written by that bot's update thread only
+class BotProfileCounter
+{
+public:
+    void Add(uint64 elapsedTicks)
+    {
+        uint32 const generation = BotProfiler::GetGeneration();
+        if (m_generation.load(std::memory_order_relaxed) != generation)
+        {
+            m_ticks.store(0, std::memory_order_relaxed);
+            m_updates.store(0, std::memory_order_relaxed);
+            m_generation.store(generation, std::memory_order_relaxed);
+        }
+
+        m_ticks.store(m_ticks.load(std::memory_order_relaxed) + elapsedTicks, std::memory_order_relaxed);
+        m_updates.store(m_updates.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    // Any thread, zero until the bot adds after a reset
+    uint64 GetTicks() const { return IsCurrent() ? m_ticks.load(std::memory_order_relaxed) : 0; }
+    uint32 GetUpdates() const { return IsCurrent() ? m_updates.load(std::memory_order_relaxed) : 0; }
+
+private:
+    bool IsCurrent() const { return m_generation.load(std::memory_order_relaxed) == BotProfiler::GetGeneration(); }
+
+    std::atomic<uint64> m_ticks{ 0 };
+    std::atomic<uint32> m_updates{ 0 };
+    std::atomic<uint32> m_generation{ 0 };
+};
+
+// Times the enclosing block into a BotProfiler section, and a bot's counter if given
+class BotProfileScope
+{
+public:
+    explicit BotProfileScope(BotProfileSection section, BotProfileCounter* pCounter = nullptr) :
+        m_section(section), m_active(BotProfiler::IsEnabled()), m_pCounter(pCounter)
+    {
+        if (m_active)
+            m_start = BotProfiler::Now();
+    }
+
+    ~BotProfileScope()
+    {
+        if (!m_active)
+            return;
+
+        // Threads moved between cores may see a slightly earlier stamp
+        uint64 const now = BotProfiler::Now();
+        uint64 const elapsed = now > m_start ? now - m_start : 0;
+        BotProfiler::Add(m_section, elapsed);
+        if (m_pCounter)
+            m_pCounter->Add(elapsed);
+    }
+
+    BotProfileScope(BotProfileScope const&) = delete;
+    BotProfileScope& operator=(BotProfileScope const&) = delete;
+
+private:
+    BotProfileSection m_section;
+    bool m_active;
+    BotProfileCounter* m_pCounter;
+    uint64 m_start = 0;
+};
+
+#endif // MANGOS_BOTPROFILER_H
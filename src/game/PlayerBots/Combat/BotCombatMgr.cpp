@@ -63,6 +63,8 @@ void BotCombatMgr::Initialize(Player* pBot, CombatBotBaseAI* pAI)
             m_handler = std::make_unique<DruidCombat>(pAI);
             break;
     }
+
+    m_profileSection = BotProfiler::GetCombatSection(pBot->GetClass());
 }
 
 bool BotCombatMgr::Engage(Player* pBot, Unit* pTarget)
@@ -83,7 +85,10 @@ void BotCombatMgr::UpdateCombat(Player* pBot, Unit* pVictim)
     }
 
     if (m_handler)
+    {
+        BotProfileScope profile(m_profileSection);
         m_handler->UpdateCombat(pBot, pVictim);
+    }
 }
 
 void BotCombatMgr::UpdateOutOfCombat(Player* pBot)
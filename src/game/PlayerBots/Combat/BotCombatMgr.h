@@ -10,6 +10,7 @@
 #define MANGOS_BOTCOMBATMGR_H
 
 #include "Common.h"
+#include "BotProfiler.h"
 #include <memory>
 
 class Player;
@@ -46,6 +47,7 @@ public:
 private:
     std::unique_ptr<IClassCombat> m_handler;
     BotMovementManager* m_pMovementMgr = nullptr;
+    BotProfileSection m_profileSection = BOT_PROFILE_IN_COMBAT;
 };
 
 #endif // MANGOS_BOTCOMBATMGR_H
@@ -10,6 +10,10 @@
 #include "SpellAuras.h"
 #include "Chat.h"
 #include "CharacterDatabaseCache.h"
+#include "Utilities/BotSpellTable.h"
+#include "Utilities/BotGearIndex.h"
+#include "Utilities/BotGroupStateCache.h"
+#include "IVMapManager.h"
 #include <random>
 
 enum CombatBotSpells
@@ -131,95 +135,16 @@ void CombatBotBaseAI::ResetSpellData()
     m_spellListTaunt.clear();
 }
 
-void CombatBotBaseAI::PopulateSpellData()
+// Sorts spells into the slots by name, keeping the highest rank.
+// Spells must be active, not passive and displayed.
+void CombatBotBaseAI::ClassifySpells(uint8 classId, std::vector<uint32> const& spellIds, CombatBotSpellSet& set)
 {
-    // Paladin Seals
-    SpellEntry const* pSealOfRighteousness = nullptr;
-    SpellEntry const* pSealOfCommand = nullptr;
-    SpellEntry const* pSealOfFury = nullptr;
-
-    // Paladin Blessings
-    SpellEntry const* pBlessingOfLight = nullptr;
-    SpellEntry const* pBlessingOfMight = nullptr;
-    SpellEntry const* pBlessingOfWisdom = nullptr;
-    SpellEntry const* pBlessingOfKings = nullptr;
-    SpellEntry const* pBlessingOfSanctuary = nullptr;
-
-    // Paladin Auras
-    SpellEntry const* pDevotionAura = nullptr;
-    SpellEntry const* pConcentrationAura = nullptr;
-    SpellEntry const* pRetributionAura = nullptr;
-    SpellEntry const* pSanctityAura = nullptr;
-    SpellEntry const* pShadowResistanceAura = nullptr;
-    SpellEntry const* pFrostResistanceAura = nullptr;
-    SpellEntry const* pFireResistanceAura = nullptr;
-
-    // Air Totems
-    SpellEntry const* pGraceOfAirTotem = nullptr;
-    SpellEntry const* pNatureResistanceTotem = nullptr;
-    SpellEntry const* pWindfuryTotem = nullptr;
-    SpellEntry const* pWindwallTotem = nullptr;
-    SpellEntry const* pTranquilAirTotem = nullptr;
-
-    // Earth Totems
-    SpellEntry const* pEarthbindTotem = nullptr;
-    SpellEntry const* pStoneclawtotem = nullptr;
-    SpellEntry const* pStoneskinTotem = nullptr;
-    SpellEntry const* pStrengthOfEarthTotem = nullptr;
-    SpellEntry const* pTremorTotem = nullptr;
-
-    // Fire Totems
-    SpellEntry const* pFireNovaTotem = nullptr;
-    SpellEntry const* pMagmaTotem = nullptr;
-    SpellEntry const* pSearingTotem = nullptr;
-    SpellEntry const* pFlametongueTotem = nullptr;
-    SpellEntry const* pFrostResistanceTotem = nullptr;
-
-    // Water Totems
-    SpellEntry const* pFireResistanceTotem = nullptr;
-    SpellEntry const* pDiseaseCleansingTotem = nullptr;
-    SpellEntry const* pHealingStreamTotem = nullptr;
-    SpellEntry const* pManaSpringTotem = nullptr;
-    SpellEntry const* pPoisonCleansingTotem = nullptr;
-
-    // Shaman Weapon Buffs
-    SpellEntry const* pFrostbrandWeapon = nullptr;
-    SpellEntry const* pRockbiterWeapon = nullptr;
-    SpellEntry const* pWindfuryWeapon = nullptr;
-
-    // Mage Polymorph
-    SpellEntry const* pPolymorphSheep = nullptr;
-    SpellEntry const* pPolymorphCow = nullptr;
-    SpellEntry const* pPolymorphPig = nullptr;
-    SpellEntry const* pPolymorphTurtle = nullptr;
-
-    // Mage Frost Armor (to replace ice armor at low level)
-    SpellEntry const* pFrostArmor = nullptr;
-
-    bool hasDeadlyPoison = false;
-    bool hasInstantPoison = false;
-    bool hasCripplingPoison = false;
-    bool hasWoundPoison = false;
-    bool HasMindNumbingPoison = false;
-
-    for (const auto& spell : me->GetSpellMap())
+    for (uint32 spellId : spellIds)
     {
-        if (spell.second.disabled)
-            continue;
-
-        if (spell.second.state == PLAYERSPELL_REMOVED)
-            continue;
-
-        SpellEntry const* pSpellEntry = sSpellMgr.GetSpellEntry(spell.first);
+        SpellEntry const* pSpellEntry = sSpellMgr.GetSpellEntry(spellId);
         if (!pSpellEntry)
             continue;
 
-        if (pSpellEntry->HasAttribute(SPELL_ATTR_PASSIVE))
-            continue;
-
-        if (pSpellEntry->HasAttribute(SPELL_ATTR_DO_NOT_DISPLAY))
-            continue;
-
         auto IsHigherRankSpell = [pSpellEntry](SpellEntry const* pOldSpell)
         {
             if (!pOldSpell)
@@ -232,169 +157,169 @@ void CombatBotBaseAI::PopulateSpellData()
             return pSpellEntry->Id > pOldSpell->Id;
         };
 
-        switch (me->GetClass())
+        switch (classId)
         {
             case CLASS_PALADIN:
             {
                 if (pSpellEntry->SpellName[0].find("Seal of Righteousness") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pSealOfRighteousness))
-                        pSealOfRighteousness = pSpellEntry;
+                    if (IsHigherRankSpell(set.pSealOfRighteousness))
+                        set.pSealOfRighteousness = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Seal of Command") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pSealOfCommand))
-                        pSealOfCommand = pSpellEntry;
+                    if (IsHigherRankSpell(set.pSealOfCommand))
+                        set.pSealOfCommand = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Judgement") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pJudgement))
-                        m_spells.paladin.pJudgement = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pJudgement))
+                        set.spells.paladin.pJudgement = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Hammer of Justice") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pHammerOfJustice))
-                        m_spells.paladin.pHammerOfJustice = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pHammerOfJustice))
+                        set.spells.paladin.pHammerOfJustice = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Blessing of Sacrifice") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pBlessingOfSacrifice))
-                        m_spells.paladin.pBlessingOfSacrifice = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pBlessingOfSacrifice))
+                        set.spells.paladin.pBlessingOfSacrifice = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Blessing of Freedom") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pBlessingOfFreedom))
-                        m_spells.paladin.pBlessingOfFreedom = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pBlessingOfFreedom))
+                        set.spells.paladin.pBlessingOfFreedom = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Blessing of Protection") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pBlessingOfProtection))
-                        m_spells.paladin.pBlessingOfProtection = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pBlessingOfProtection))
+                        set.spells.paladin.pBlessingOfProtection = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Blessing of Sanctuary") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pBlessingOfSanctuary))
-                        pBlessingOfSanctuary = pSpellEntry;
+                    if (IsHigherRankSpell(set.pBlessingOfSanctuary))
+                        set.pBlessingOfSanctuary = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Blessing of Kings") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pBlessingOfKings))
-                        pBlessingOfKings = pSpellEntry;
+                    if (IsHigherRankSpell(set.pBlessingOfKings))
+                        set.pBlessingOfKings = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Blessing of Wisdom") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pBlessingOfWisdom))
-                        pBlessingOfWisdom = pSpellEntry;
+                    if (IsHigherRankSpell(set.pBlessingOfWisdom))
+                        set.pBlessingOfWisdom = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Blessing of Might") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pBlessingOfMight))
-                        pBlessingOfMight = pSpellEntry;
+                    if (IsHigherRankSpell(set.pBlessingOfMight))
+                        set.pBlessingOfMight = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Blessing of Light") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pBlessingOfLight))
-                        pBlessingOfLight = pSpellEntry;
+                    if (IsHigherRankSpell(set.pBlessingOfLight))
+                        set.pBlessingOfLight = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Devotion Aura") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pDevotionAura))
-                        pDevotionAura = pSpellEntry;
+                    if (IsHigherRankSpell(set.pDevotionAura))
+                        set.pDevotionAura = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Retribution Aura") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pRetributionAura))
-                        pRetributionAura = pSpellEntry;
+                    if (IsHigherRankSpell(set.pRetributionAura))
+                        set.pRetributionAura = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Concentration Aura") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pConcentrationAura))
-                        pConcentrationAura = pSpellEntry;
+                    if (IsHigherRankSpell(set.pConcentrationAura))
+                        set.pConcentrationAura = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Sanctity Aura") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pSanctityAura))
-                        pSanctityAura = pSpellEntry;
+                    if (IsHigherRankSpell(set.pSanctityAura))
+                        set.pSanctityAura = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Shadow Resistance Aura") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pShadowResistanceAura))
-                        pShadowResistanceAura = pSpellEntry;
+                    if (IsHigherRankSpell(set.pShadowResistanceAura))
+                        set.pShadowResistanceAura = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Frost Resistance Aura") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pFrostResistanceAura))
-                        pFrostResistanceAura = pSpellEntry;
+                    if (IsHigherRankSpell(set.pFrostResistanceAura))
+                        set.pFrostResistanceAura = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Fire Resistance Aura") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pFireResistanceAura))
-                        pFireResistanceAura = pSpellEntry;
+                    if (IsHigherRankSpell(set.pFireResistanceAura))
+                        set.pFireResistanceAura = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Exorcism") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pExorcism))
-                        m_spells.paladin.pExorcism = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pExorcism))
+                        set.spells.paladin.pExorcism = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Consecration") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pConsecration))
-                        m_spells.paladin.pConsecration = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pConsecration))
+                        set.spells.paladin.pConsecration = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Hammer of Wrath") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pHammerOfWrath))
-                        m_spells.paladin.pHammerOfWrath = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pHammerOfWrath))
+                        set.spells.paladin.pHammerOfWrath = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Cleanse") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pCleanse))
-                        m_spells.paladin.pCleanse = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pCleanse))
+                        set.spells.paladin.pCleanse = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Divine Shield") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pDivineShield))
-                        m_spells.paladin.pDivineShield = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pDivineShield))
+                        set.spells.paladin.pDivineShield = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Lay on Hands") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pLayOnHands))
-                        m_spells.paladin.pLayOnHands = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pLayOnHands))
+                        set.spells.paladin.pLayOnHands = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Righteous Fury") != std::string::npos) // post 1.9
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pRighteousFury))
-                        m_spells.paladin.pRighteousFury = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pRighteousFury))
+                        set.spells.paladin.pRighteousFury = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Seal of Fury") != std::string::npos) // pre 1.9
                 {
-                    if (IsHigherRankSpell(pSealOfFury))
-                        pSealOfFury = pSpellEntry;
+                    if (IsHigherRankSpell(set.pSealOfFury))
+                        set.pSealOfFury = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Holy Shock") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pHolyShock))
-                        m_spells.paladin.pHolyShock = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pHolyShock))
+                        set.spells.paladin.pHolyShock = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Divine Favor") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pDivineFavor))
-                        m_spells.paladin.pDivineFavor = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pDivineFavor))
+                        set.spells.paladin.pDivineFavor = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Holy Wrath") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pHolyWrath))
-                        m_spells.paladin.pHolyWrath = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pHolyWrath))
+                        set.spells.paladin.pHolyWrath = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Turn Evil") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pTurnEvil))
-                        m_spells.paladin.pTurnEvil = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pTurnEvil))
+                        set.spells.paladin.pTurnEvil = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Holy Shield") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.paladin.pHolyShield))
-                        m_spells.paladin.pHolyShield = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.paladin.pHolyShield))
+                        set.spells.paladin.pHolyShield = pSpellEntry;
                 }
                 break;
             }
@@ -402,173 +327,173 @@ void CombatBotBaseAI::PopulateSpellData()
             {
                 if (pSpellEntry->SpellName[0].find("Lightning Bolt") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.shaman.pLightningBolt))
-                        m_spells.shaman.pLightningBolt = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.shaman.pLightningBolt))
+                        set.spells.shaman.pLightningBolt = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Chain Lightning") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.shaman.pChainLightning))
-                        m_spells.shaman.pChainLightning = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.shaman.pChainLightning))
+                        set.spells.shaman.pChainLightning = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Earth Shock") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.shaman.pEarthShock))
-                        m_spells.shaman.pEarthShock = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.shaman.pEarthShock))
+                        set.spells.shaman.pEarthShock = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Flame Shock") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.shaman.pFlameShock))
-                        m_spells.shaman.pFlameShock = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.shaman.pFlameShock))
+                        set.spells.shaman.pFlameShock = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Frost Shock") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.shaman.pFrostShock))
-                        m_spells.shaman.pFrostShock = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.shaman.pFrostShock))
+                        set.spells.shaman.pFrostShock = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Purge") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.shaman.pPurge))
-                        m_spells.shaman.pPurge = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.shaman.pPurge))
+                        set.spells.shaman.pPurge = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Stormstrike") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.shaman.pStormstrike))
-                        m_spells.shaman.pStormstrike = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.shaman.pStormstrike))
+                        set.spells.shaman.pStormstrike = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Elemental Mastery") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.shaman.pElementalMastery))
-                        m_spells.shaman.pElementalMastery = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.shaman.pElementalMastery))
+                        set.spells.shaman.pElementalMastery = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Lightning Shield") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.shaman.pLightningShield))
-                        m_spells.shaman.pLightningShield = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.shaman.pLightningShield))
+                        set.spells.shaman.pLightningShield = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Ghost Wolf") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.shaman.pGhostWolf))
-                        m_spells.shaman.pGhostWolf = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.shaman.pGhostWolf))
+                        set.spells.shaman.pGhostWolf = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Frostbrand Weapon") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pFrostbrandWeapon))
-                        pFrostbrandWeapon = pSpellEntry;
+                    if (IsHigherRankSpell(set.pFrostbrandWeapon))
+                        set.pFrostbrandWeapon = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Rockbiter Weapon") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pRockbiterWeapon))
-                        pRockbiterWeapon = pSpellEntry;
+                    if (IsHigherRankSpell(set.pRockbiterWeapon))
+                        set.pRockbiterWeapon = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Windfury Weapon") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pWindfuryWeapon))
-                        pWindfuryWeapon = pSpellEntry;
+                    if (IsHigherRankSpell(set.pWindfuryWeapon))
+                        set.pWindfuryWeapon = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Grace of Air Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pGraceOfAirTotem))
-                        pGraceOfAirTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pGraceOfAirTotem))
+                        set.pGraceOfAirTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Nature Resistance Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pNatureResistanceTotem))
-                        pNatureResistanceTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pNatureResistanceTotem))
+                        set.pNatureResistanceTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Windfury Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pWindfuryTotem))
-                        pWindfuryTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pWindfuryTotem))
+                        set.pWindfuryTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Windwall Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pWindwallTotem))
-                        pWindwallTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pWindwallTotem))
+                        set.pWindwallTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Tranquil Air Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pTranquilAirTotem))
-                        pTranquilAirTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pTranquilAirTotem))
+                        set.pTranquilAirTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Earthbind Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pEarthbindTotem))
-                        pEarthbindTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pEarthbindTotem))
+                        set.pEarthbindTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Stoneclaw Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pStoneclawtotem))
-                        pStoneclawtotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pStoneclawtotem))
+                        set.pStoneclawtotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Stoneskin Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pStoneskinTotem))
-                        pStoneskinTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pStoneskinTotem))
+                        set.pStoneskinTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Strength of Earth Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pStrengthOfEarthTotem))
-                        pStrengthOfEarthTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pStrengthOfEarthTotem))
+                        set.pStrengthOfEarthTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Tremor Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pTremorTotem))
-                        pTremorTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pTremorTotem))
+                        set.pTremorTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Fire Nova Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pFireNovaTotem))
-                        pFireNovaTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pFireNovaTotem))
+                        set.pFireNovaTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Magma Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pMagmaTotem))
-                        pMagmaTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pMagmaTotem))
+                        set.pMagmaTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Searing Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pSearingTotem))
-                        pSearingTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pSearingTotem))
+                        set.pSearingTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Flametongue Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pFlametongueTotem))
-                        pFlametongueTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pFlametongueTotem))
+                        set.pFlametongueTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Frost Resistance Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pFrostResistanceTotem))
-                        pFrostResistanceTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pFrostResistanceTotem))
+                        set.pFrostResistanceTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Fire Resistance Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pFireResistanceTotem))
-                        pFireResistanceTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pFireResistanceTotem))
+                        set.pFireResistanceTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Disease Resistance Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pDiseaseCleansingTotem))
-                        pDiseaseCleansingTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pDiseaseCleansingTotem))
+                        set.pDiseaseCleansingTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Healing Stream Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pHealingStreamTotem))
-                        pHealingStreamTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pHealingStreamTotem))
+                        set.pHealingStreamTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Mana Spring Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pManaSpringTotem))
-                        pManaSpringTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pManaSpringTotem))
+                        set.pManaSpringTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Poison Cleansing Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pPoisonCleansingTotem))
-                        pPoisonCleansingTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.pPoisonCleansingTotem))
+                        set.pPoisonCleansingTotem = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Mana Tide Totem") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.shaman.pManaTideTotem))
-                        m_spells.shaman.pManaTideTotem = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.shaman.pManaTideTotem))
+                        set.spells.shaman.pManaTideTotem = pSpellEntry;
                 }
                 break;
             }
@@ -576,83 +501,83 @@ void CombatBotBaseAI::PopulateSpellData()
             {
                 if (pSpellEntry->SpellName[0].find("Aspect of the Cheetah") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.hunter.pAspectOfTheCheetah))
-                        m_spells.hunter.pAspectOfTheCheetah = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.hunter.pAspectOfTheCheetah))
+                        set.spells.hunter.pAspectOfTheCheetah = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Aspect of the Hawk") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.hunter.pAspectOfTheHawk))
-                        m_spells.hunter.pAspectOfTheHawk = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.hunter.pAspectOfTheHawk))
+                        set.spells.hunter.pAspectOfTheHawk = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Aspect of the Monkey") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.hunter.pAspectOfTheMonkey))
-                        m_spells.hunter.pAspectOfTheMonkey = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.hunter.pAspectOfTheMonkey))
+                        set.spells.hunter.pAspectOfTheMonkey = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Serpent Sting") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.hunter.pSerpentSting))
-                        m_spells.hunter.pSerpentSting = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.hunter.pSerpentSting))
+                        set.spells.hunter.pSerpentSting = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Arcane Shot") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.hunter.pArcaneShot))
-                        m_spells.hunter.pArcaneShot = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.hunter.pArcaneShot))
+                        set.spells.hunter.pArcaneShot = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Aimed Shot") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.hunter.pAimedShot))
-                        m_spells.hunter.pAimedShot = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.hunter.pAimedShot))
+                        set.spells.hunter.pAimedShot = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Multi-Shot") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.hunter.pMultiShot))
-                        m_spells.hunter.pMultiShot = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.hunter.pMultiShot))
+                        set.spells.hunter.pMultiShot = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Concussive Shot") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.hunter.pConcussiveShot))
-                        m_spells.hunter.pConcussiveShot = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.hunter.pConcussiveShot))
+                        set.spells.hunter.pConcussiveShot = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Wing Clip") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.hunter.pWingClip))
-                        m_spells.hunter.pWingClip = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.hunter.pWingClip))
+                        set.spells.hunter.pWingClip = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Hunter's Mark") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.hunter.pHuntersMark))
-                        m_spells.hunter.pHuntersMark = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.hunter.pHuntersMark))
+                        set.spells.hunter.pHuntersMark = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Mongoose Bite") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.hunter.pMongooseBite))
-                        m_spells.hunter.pMongooseBite = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.hunter.pMongooseBite))
+                        set.spells.hunter.pMongooseBite = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Raptor Strike") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.hunter.pRaptorStrike))
-                        m_spells.hunter.pRaptorStrike = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.hunter.pRaptorStrike))
+                        set.spells.hunter.pRaptorStrike = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Disengage") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.hunter.pDisengage))
-                        m_spells.hunter.pDisengage = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.hunter.pDisengage))
+                        set.spells.hunter.pDisengage = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Feign Death") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.hunter.pFeignDeath))
-                        m_spells.hunter.pFeignDeath = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.hunter.pFeignDeath))
+                        set.spells.hunter.pFeignDeath = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Scare Beast") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.hunter.pScareBeast))
-                        m_spells.hunter.pScareBeast = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.hunter.pScareBeast))
+                        set.spells.hunter.pScareBeast = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Volley") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.hunter.pVolley))
-                        m_spells.hunter.pVolley = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.hunter.pVolley))
+                        set.spells.hunter.pVolley = pSpellEntry;
                 }
                 break;
             }
@@ -660,143 +585,143 @@ void CombatBotBaseAI::PopulateSpellData()
             {
                 if (pSpellEntry->SpellName[0].find("Ice Armor") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pIceArmor))
-                        m_spells.mage.pIceArmor = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pIceArmor))
+                        set.spells.mage.pIceArmor = pSpellEntry;
                 }
                 if (pSpellEntry->SpellName[0].find("Frost Armor") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pFrostArmor))
-                        pFrostArmor = pSpellEntry;
+                    if (IsHigherRankSpell(set.pFrostArmor))
+                        set.pFrostArmor = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Ice Barrier") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pIceBarrier))
-                        m_spells.mage.pIceBarrier = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pIceBarrier))
+                        set.spells.mage.pIceBarrier = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Mana Shield") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pManaShield))
-                        m_spells.mage.pManaShield = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pManaShield))
+                        set.spells.mage.pManaShield = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Arcane Intellect") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pArcaneIntellect))
-                        m_spells.mage.pArcaneIntellect = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pArcaneIntellect))
+                        set.spells.mage.pArcaneIntellect = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Arcane Brilliance") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pArcaneBrilliance))
-                        m_spells.mage.pArcaneBrilliance = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pArcaneBrilliance))
+                        set.spells.mage.pArcaneBrilliance = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Frostbolt") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pFrostbolt))
-                        m_spells.mage.pFrostbolt = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pFrostbolt))
+                        set.spells.mage.pFrostbolt = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Fire Blast") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pFireBlast))
-                        m_spells.mage.pFireBlast = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pFireBlast))
+                        set.spells.mage.pFireBlast = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Fireball") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pFireball))
-                        m_spells.mage.pFireball = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pFireball))
+                        set.spells.mage.pFireball = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Arcane Explosion") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pArcaneExplosion))
-                        m_spells.mage.pArcaneExplosion = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pArcaneExplosion))
+                        set.spells.mage.pArcaneExplosion = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Frost Nova") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pFrostNova))
-                        m_spells.mage.pFrostNova = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pFrostNova))
+                        set.spells.mage.pFrostNova = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Cone of Cold") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pConeofCold))
-                        m_spells.mage.pConeofCold = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pConeofCold))
+                        set.spells.mage.pConeofCold = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Blink") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pBlink))
-                        m_spells.mage.pBlink = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pBlink))
+                        set.spells.mage.pBlink = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0] == "Polymorph") // Sheep
                 {
-                    if (IsHigherRankSpell(pPolymorphSheep))
-                        pPolymorphSheep = pSpellEntry;
+                    if (IsHigherRankSpell(set.pPolymorphSheep))
+                        set.pPolymorphSheep = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Polymorph: Cow") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pPolymorphCow))
-                        pPolymorphCow = pSpellEntry;
+                    if (IsHigherRankSpell(set.pPolymorphCow))
+                        set.pPolymorphCow = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Polymorph: Pig") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pPolymorphPig))
-                        pPolymorphPig = pSpellEntry;
+                    if (IsHigherRankSpell(set.pPolymorphPig))
+                        set.pPolymorphPig = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Polymorph: Turtle") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(pPolymorphTurtle))
-                        pPolymorphTurtle = pSpellEntry;
+                    if (IsHigherRankSpell(set.pPolymorphTurtle))
+                        set.pPolymorphTurtle = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Counterspell") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pCounterspell))
-                        m_spells.mage.pCounterspell = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pCounterspell))
+                        set.spells.mage.pCounterspell = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Presence of Mind") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pPresenceOfMind))
-                        m_spells.mage.pPresenceOfMind = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pPresenceOfMind))
+                        set.spells.mage.pPresenceOfMind = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Arcane Power") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pArcanePower))
-                        m_spells.mage.pArcanePower = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pArcanePower))
+                        set.spells.mage.pArcanePower = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Remove Lesser Curse") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pRemoveLesserCurse))
-                        m_spells.mage.pRemoveLesserCurse = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pRemoveLesserCurse))
+                        set.spells.mage.pRemoveLesserCurse = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Scorch") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pScorch))
-                        m_spells.mage.pScorch = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pScorch))
+                        set.spells.mage.pScorch = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Pyroblast") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pPyroblast))
-                        m_spells.mage.pPyroblast = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pPyroblast))
+                        set.spells.mage.pPyroblast = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Evocation") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pEvocation))
-                        m_spells.mage.pEvocation = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pEvocation))
+                        set.spells.mage.pEvocation = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Ice Block") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pIceBlock))
-                        m_spells.mage.pIceBlock = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pIceBlock))
+                        set.spells.mage.pIceBlock = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Blizzard") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pBlizzard))
-                        m_spells.mage.pBlizzard = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pBlizzard))
+                        set.spells.mage.pBlizzard = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Blast Wave") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pBlastWave))
-                        m_spells.mage.pBlastWave = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pBlastWave))
+                        set.spells.mage.pBlastWave = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Combustion") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.mage.pCombustion))
-                        m_spells.mage.pCombustion = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.mage.pCombustion))
+                        set.spells.mage.pCombustion = pSpellEntry;
                 }
                 break;
             }
@@ -804,128 +729,128 @@ void CombatBotBaseAI::PopulateSpellData()
             {
                 if (pSpellEntry->SpellName[0].find("Power Word: Fortitude") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pPowerWordFortitude))
-                        m_spells.priest.pPowerWordFortitude = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pPowerWordFortitude))
+                        set.spells.priest.pPowerWordFortitude = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Divine Spirit") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pDivineSpirit))
-                        m_spells.priest.pDivineSpirit = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pDivineSpirit))
+                        set.spells.priest.pDivineSpirit = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Prayer of Spirit") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pPrayerofSpirit))
-                        m_spells.priest.pPrayerofSpirit = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pPrayerofSpirit))
+                        set.spells.priest.pPrayerofSpirit = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Prayer of Fortitude") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pPrayerofFortitude))
-                        m_spells.priest.pPrayerofFortitude = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pPrayerofFortitude))
+                        set.spells.priest.pPrayerofFortitude = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Prayer of Shadow Protection") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pPrayerofShadowProtection))
-                        m_spells.priest.pPrayerofShadowProtection = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pPrayerofShadowProtection))
+                        set.spells.priest.pPrayerofShadowProtection = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Inner Fire") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pInnerFire))
-                        m_spells.priest.pInnerFire = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pInnerFire))
+                        set.spells.priest.pInnerFire = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Shadow Protection") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pShadowProtection))
-                        m_spells.priest.pShadowProtection = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pShadowProtection))
+                        set.spells.priest.pShadowProtection = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Power Word: Shield") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pPowerWordShield))
-                        m_spells.priest.pPowerWordShield = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pPowerWordShield))
+                        set.spells.priest.pPowerWordShield = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Holy Nova") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pHolyNova))
-                        m_spells.priest.pHolyNova = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pHolyNova))
+                        set.spells.priest.pHolyNova = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Holy Fire") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pHolyFire))
-                        m_spells.priest.pHolyFire = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pHolyFire))
+                        set.spells.priest.pHolyFire = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Mind Blast") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pMindBlast))
-                        m_spells.priest.pMindBlast = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pMindBlast))
+                        set.spells.priest.pMindBlast = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Mind Flay") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pMindFlay))
-                        m_spells.priest.pMindFlay = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pMindFlay))
+                        set.spells.priest.pMindFlay = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Shadow Word: Pain") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pShadowWordPain))
-                        m_spells.priest.pShadowWordPain = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pShadowWordPain))
+                        set.spells.priest.pShadowWordPain = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Inner Focus") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pInnerFocus))
-                        m_spells.priest.pInnerFocus = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pInnerFocus))
+                        set.spells.priest.pInnerFocus = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Abolish Disease") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pAbolishDisease))
-                        m_spells.priest.pAbolishDisease = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pAbolishDisease))
+                        set.spells.priest.pAbolishDisease = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Dispel Magic") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pDispelMagic))
-                        m_spells.priest.pDispelMagic = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pDispelMagic))
+                        set.spells.priest.pDispelMagic = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Mana Burn") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pManaBurn))
-                        m_spells.priest.pManaBurn = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pManaBurn))
+                        set.spells.priest.pManaBurn = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Devouring Plague") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pDevouringPlague))
-                        m_spells.priest.pDevouringPlague = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pDevouringPlague))
+                        set.spells.priest.pDevouringPlague = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Psychic Scream") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pPsychicScream))
-                        m_spells.priest.pPsychicScream = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pPsychicScream))
+                        set.spells.priest.pPsychicScream = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Shadowform") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pShadowform))
-                        m_spells.priest.pShadowform = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pShadowform))
+                        set.spells.priest.pShadowform = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Vampiric Embrace") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pVampiricEmbrace))
-                        m_spells.priest.pVampiricEmbrace = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pVampiricEmbrace))
+                        set.spells.priest.pVampiricEmbrace = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Silence") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pSilence))
-                        m_spells.priest.pSilence = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pSilence))
+                        set.spells.priest.pSilence = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Fade") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pFade))
-                        m_spells.priest.pFade = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pFade))
+                        set.spells.priest.pFade = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Shackle Undead") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pShackleUndead))
-                        m_spells.priest.pShackleUndead = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pShackleUndead))
+                        set.spells.priest.pShackleUndead = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Smite") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.priest.pSmite))
-                        m_spells.priest.pSmite = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.priest.pSmite))
+                        set.spells.priest.pSmite = pSpellEntry;
                 }
                 break;
             }
@@ -933,118 +858,118 @@ void CombatBotBaseAI::PopulateSpellData()
             {
                 if (pSpellEntry->SpellName[0].find("Demon Armor") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pDemonArmor))
-                        m_spells.warlock.pDemonArmor = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pDemonArmor))
+                        set.spells.warlock.pDemonArmor = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Death Coil") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pDeathCoil))
-                        m_spells.warlock.pDeathCoil = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pDeathCoil))
+                        set.spells.warlock.pDeathCoil = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Detect Invisibility") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pDetectInvisibility))
-                        m_spells.warlock.pDetectInvisibility = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pDetectInvisibility))
+                        set.spells.warlock.pDetectInvisibility = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Shadow Ward") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pShadowWard))
-                        m_spells.warlock.pShadowWard = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pShadowWard))
+                        set.spells.warlock.pShadowWard = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Shadow Bolt") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pShadowBolt))
-                        m_spells.warlock.pShadowBolt = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pShadowBolt))
+                        set.spells.warlock.pShadowBolt = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Corruption") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pCorruption))
-                        m_spells.warlock.pCorruption = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pCorruption))
+                        set.spells.warlock.pCorruption = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Conflagrate") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pConflagrate))
-                        m_spells.warlock.pConflagrate = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pConflagrate))
+                        set.spells.warlock.pConflagrate = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Shadowburn") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pShadowburn))
-                        m_spells.warlock.pShadowburn = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pShadowburn))
+                        set.spells.warlock.pShadowburn = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Searing Pain") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pSearingPain))
-                        m_spells.warlock.pSearingPain = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pSearingPain))
+                        set.spells.warlock.pSearingPain = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Immolate") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pImmolate))
-                        m_spells.warlock.pImmolate = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pImmolate))
+                        set.spells.warlock.pImmolate = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Rain of Fire") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pRainOfFire))
-                        m_spells.warlock.pRainOfFire = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pRainOfFire))
+                        set.spells.warlock.pRainOfFire = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Demonic Sacrifice") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pDemonicSacrifice))
-                        m_spells.warlock.pDemonicSacrifice = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pDemonicSacrifice))
+                        set.spells.warlock.pDemonicSacrifice = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Drain Life") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pDrainLife))
-                        m_spells.warlock.pDrainLife = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pDrainLife))
+                        set.spells.warlock.pDrainLife = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Siphon Life") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pSiphonLife))
-                        m_spells.warlock.pSiphonLife = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pSiphonLife))
+                        set.spells.warlock.pSiphonLife = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Banish") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pBanish))
-                        m_spells.warlock.pBanish = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pBanish))
+                        set.spells.warlock.pBanish = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Fear") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pFear))
-                        m_spells.warlock.pFear = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pFear))
+                        set.spells.warlock.pFear = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Howl of Terror") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pHowlofTerror))
-                        m_spells.warlock.pHowlofTerror = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pHowlofTerror))
+                        set.spells.warlock.pHowlofTerror = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Curse of Agony") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pCurseofAgony))
-                        m_spells.warlock.pCurseofAgony = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pCurseofAgony))
+                        set.spells.warlock.pCurseofAgony = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Curse of the Elements") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pCurseoftheElements))
-                        m_spells.warlock.pCurseoftheElements = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pCurseoftheElements))
+                        set.spells.warlock.pCurseoftheElements = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Curse of Shadow") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pCurseofShadow))
-                        m_spells.warlock.pCurseofShadow = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pCurseofShadow))
+                        set.spells.warlock.pCurseofShadow = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Curse of Recklessness") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pCurseofRecklessness))
-                        m_spells.warlock.pCurseofRecklessness = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pCurseofRecklessness))
+                        set.spells.warlock.pCurseofRecklessness = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Curse of Tongues") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pCurseofTongues))
-                        m_spells.warlock.pCurseofTongues = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pCurseofTongues))
+                        set.spells.warlock.pCurseofTongues = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Life Tap") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warlock.pLifeTap))
-                        m_spells.warlock.pLifeTap = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warlock.pLifeTap))
+                        set.spells.warlock.pLifeTap = pSpellEntry;
                 }
                 break;
             }
@@ -1052,173 +977,173 @@ void CombatBotBaseAI::PopulateSpellData()
             {
                 if (pSpellEntry->SpellName[0].find("Battle Stance") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pBattleStance))
-                        m_spells.warrior.pBattleStance = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pBattleStance))
+                        set.spells.warrior.pBattleStance = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Berserker Stance") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pBerserkerStance))
-                        m_spells.warrior.pBerserkerStance = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pBerserkerStance))
+                        set.spells.warrior.pBerserkerStance = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Defensive Stance") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pDefensiveStance))
-                        m_spells.warrior.pDefensiveStance = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pDefensiveStance))
+                        set.spells.warrior.pDefensiveStance = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Charge") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pCharge))
-                        m_spells.warrior.pCharge = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pCharge))
+                        set.spells.warrior.pCharge = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Intercept") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pIntercept))
-                        m_spells.warrior.pIntercept = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pIntercept))
+                        set.spells.warrior.pIntercept = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Overpower") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pOverpower))
-                        m_spells.warrior.pOverpower = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pOverpower))
+                        set.spells.warrior.pOverpower = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Heroic Strike") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pHeroicStrike))
-                        m_spells.warrior.pHeroicStrike = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pHeroicStrike))
+                        set.spells.warrior.pHeroicStrike = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Cleave") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pCleave))
-                        m_spells.warrior.pCleave = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pCleave))
+                        set.spells.warrior.pCleave = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Execute") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pExecute))
-                        m_spells.warrior.pExecute = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pExecute))
+                        set.spells.warrior.pExecute = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Mortal Strike") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pMortalStrike))
-                        m_spells.warrior.pMortalStrike = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pMortalStrike))
+                        set.spells.warrior.pMortalStrike = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Bloodthirst") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pBloodthirst))
-                        m_spells.warrior.pBloodthirst = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pBloodthirst))
+                        set.spells.warrior.pBloodthirst = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Bloodrage") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pBloodrage))
-                        m_spells.warrior.pBloodrage = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pBloodrage))
+                        set.spells.warrior.pBloodrage = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Berserker Rage") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pBerserkerRage))
-                        m_spells.warrior.pBerserkerRage = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pBerserkerRage))
+                        set.spells.warrior.pBerserkerRage = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Recklessness") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pRecklessness))
-                        m_spells.warrior.pRecklessness = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pRecklessness))
+                        set.spells.warrior.pRecklessness = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Retaliation") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pRetaliation))
-                        m_spells.warrior.pRetaliation = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pRetaliation))
+                        set.spells.warrior.pRetaliation = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Death Wish") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pDeathWish))
-                        m_spells.warrior.pDeathWish = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pDeathWish))
+                        set.spells.warrior.pDeathWish = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Intimidating Shout") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pIntimidatingShout))
-                        m_spells.warrior.pIntimidatingShout = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pIntimidatingShout))
+                        set.spells.warrior.pIntimidatingShout = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Pummel") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pPummel))
-                        m_spells.warrior.pPummel = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pPummel))
+                        set.spells.warrior.pPummel = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Rend") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pRend))
-                        m_spells.warrior.pRend = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pRend))
+                        set.spells.warrior.pRend = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Disarm") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pDisarm))
-                        m_spells.warrior.pDisarm = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pDisarm))
+                        set.spells.warrior.pDisarm = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Whirlwind") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pWhirlwind))
-                        m_spells.warrior.pWhirlwind = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pWhirlwind))
+                        set.spells.warrior.pWhirlwind = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Battle Shout") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pBattleShout))
-                        m_spells.warrior.pBattleShout = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pBattleShout))
+                        set.spells.warrior.pBattleShout = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Demoralizing Shout") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pDemoralizingShout))
-                        m_spells.warrior.pDemoralizingShout = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pDemoralizingShout))
+                        set.spells.warrior.pDemoralizingShout = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Hamstring") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pHamstring))
-                        m_spells.warrior.pHamstring = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pHamstring))
+                        set.spells.warrior.pHamstring = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Thunder Clap") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pThunderClap))
-                        m_spells.warrior.pThunderClap = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pThunderClap))
+                        set.spells.warrior.pThunderClap = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Sweeping Strikes") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pSweepingStrikes))
-                        m_spells.warrior.pSweepingStrikes = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pSweepingStrikes))
+                        set.spells.warrior.pSweepingStrikes = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Last Stand") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pLastStand))
-                        m_spells.warrior.pLastStand = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pLastStand))
+                        set.spells.warrior.pLastStand = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Shield Block") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pShieldBlock))
-                        m_spells.warrior.pShieldBlock = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pShieldBlock))
+                        set.spells.warrior.pShieldBlock = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Shield Wall") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pShieldWall))
-                        m_spells.warrior.pShieldWall = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pShieldWall))
+                        set.spells.warrior.pShieldWall = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Shield Bash") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pShieldBash))
-                        m_spells.warrior.pShieldBash = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pShieldBash))
+                        set.spells.warrior.pShieldBash = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Shield Slam") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pShieldSlam))
-                        m_spells.warrior.pShieldSlam = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pShieldSlam))
+                        set.spells.warrior.pShieldSlam = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Sunder Armor") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pSunderArmor))
-                        m_spells.warrior.pSunderArmor = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pSunderArmor))
+                        set.spells.warrior.pSunderArmor = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Concussion Blow") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pConcussionBlow))
-                        m_spells.warrior.pConcussionBlow = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pConcussionBlow))
+                        set.spells.warrior.pConcussionBlow = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Piercing Howl") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.warrior.pPiercingHowl))
-                        m_spells.warrior.pPiercingHowl = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.warrior.pPiercingHowl))
+                        set.spells.warrior.pPiercingHowl = pSpellEntry;
                 }
                 break;
             }
@@ -1226,148 +1151,148 @@ void CombatBotBaseAI::PopulateSpellData()
             {
                 if (pSpellEntry->SpellName[0].find("Slice and Dice") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pSliceAndDice))
-                        m_spells.rogue.pSliceAndDice = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pSliceAndDice))
+                        set.spells.rogue.pSliceAndDice = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Sinister Strike") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pSinisterStrike))
-                        m_spells.rogue.pSinisterStrike = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pSinisterStrike))
+                        set.spells.rogue.pSinisterStrike = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Adrenaline Rush") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pAdrenalineRush))
-                        m_spells.rogue.pAdrenalineRush = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pAdrenalineRush))
+                        set.spells.rogue.pAdrenalineRush = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Eviscerate") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pEviscerate))
-                        m_spells.rogue.pEviscerate = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pEviscerate))
+                        set.spells.rogue.pEviscerate = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Stealth") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pStealth))
-                        m_spells.rogue.pStealth = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pStealth))
+                        set.spells.rogue.pStealth = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Garrote") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pGarrote))
-                        m_spells.rogue.pGarrote = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pGarrote))
+                        set.spells.rogue.pGarrote = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Ambush") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pAmbush))
-                        m_spells.rogue.pAmbush = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pAmbush))
+                        set.spells.rogue.pAmbush = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Cheap Shot") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pCheapShot))
-                        m_spells.rogue.pCheapShot = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pCheapShot))
+                        set.spells.rogue.pCheapShot = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Premeditation") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pPremeditation))
-                        m_spells.rogue.pPremeditation = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pPremeditation))
+                        set.spells.rogue.pPremeditation = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Backstab") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pBackstab))
-                        m_spells.rogue.pBackstab = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pBackstab))
+                        set.spells.rogue.pBackstab = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Hemorrhage") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pHemorrhage))
-                        m_spells.rogue.pHemorrhage = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pHemorrhage))
+                        set.spells.rogue.pHemorrhage = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Ghostly Strike") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pGhostlyStrike))
-                        m_spells.rogue.pGhostlyStrike = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pGhostlyStrike))
+                        set.spells.rogue.pGhostlyStrike = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Gouge") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pGouge))
-                        m_spells.rogue.pGouge = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pGouge))
+                        set.spells.rogue.pGouge = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Rupture") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pRupture))
-                        m_spells.rogue.pRupture = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pRupture))
+                        set.spells.rogue.pRupture = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Expose Armor") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pExposeArmor))
-                        m_spells.rogue.pExposeArmor = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pExposeArmor))
+                        set.spells.rogue.pExposeArmor = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Kidney Shot") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pKidneyShot))
-                        m_spells.rogue.pKidneyShot = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pKidneyShot))
+                        set.spells.rogue.pKidneyShot = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Cold Blood") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pColdBlood))
-                        m_spells.rogue.pColdBlood = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pColdBlood))
+                        set.spells.rogue.pColdBlood = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Blade Flurry") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pBladeFlurry))
-                        m_spells.rogue.pBladeFlurry = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pBladeFlurry))
+                        set.spells.rogue.pBladeFlurry = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Vanish") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pVanish))
-                        m_spells.rogue.pVanish = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pVanish))
+                        set.spells.rogue.pVanish = pSpellEntry;
                 }
                 else if (pSpellEntry->IsFitToFamily<SPELLFAMILY_ROGUE, CF_ROGUE_BLIND>())
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pBlind))
-                        m_spells.rogue.pBlind = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pBlind))
+                        set.spells.rogue.pBlind = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Preparation") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pPreparation))
-                        m_spells.rogue.pPreparation = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pPreparation))
+                        set.spells.rogue.pPreparation = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Evasion") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pEvasion))
-                        m_spells.rogue.pEvasion = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pEvasion))
+                        set.spells.rogue.pEvasion = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Riposte") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pRiposte))
-                        m_spells.rogue.pRiposte = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pRiposte))
+                        set.spells.rogue.pRiposte = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Kick") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pKick))
-                        m_spells.rogue.pKick = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pKick))
+                        set.spells.rogue.pKick = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Sprint") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.rogue.pSprint))
-                        m_spells.rogue.pSprint = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.rogue.pSprint))
+                        set.spells.rogue.pSprint = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Deadly Poison") != std::string::npos)
                 {
-                    hasDeadlyPoison = true;
+                    set.hasDeadlyPoison = true;
                 }
                 else if (pSpellEntry->SpellName[0].find("Instant Poison") != std::string::npos)
                 {
-                    hasInstantPoison = true;
+                    set.hasInstantPoison = true;
                 }
                 else if (pSpellEntry->SpellName[0].find("Crippling Poison") != std::string::npos)
                 {
-                    hasCripplingPoison = true;
+                    set.hasCripplingPoison = true;
                 }
                 else if (pSpellEntry->SpellName[0].find("Wound Poison") != std::string::npos)
                 {
-                    hasWoundPoison = true;
+                    set.hasWoundPoison = true;
                 }
                 else if (pSpellEntry->SpellName[0].find("Mind-numbing Poison") != std::string::npos)
                 {
-                    HasMindNumbingPoison = true;
+                    set.HasMindNumbingPoison = true;
                 }
                 break;
             }
@@ -1375,228 +1300,228 @@ void CombatBotBaseAI::PopulateSpellData()
             {
                 if (pSpellEntry->SpellName[0].find("Bear Form") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pBearForm))
-                        m_spells.druid.pBearForm = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pBearForm))
+                        set.spells.druid.pBearForm = pSpellEntry;
                 }
                 else if (pSpellEntry->Id == (768)) // Cat Form
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pCatForm))
-                        m_spells.druid.pCatForm = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pCatForm))
+                        set.spells.druid.pCatForm = pSpellEntry;
                 }
                 else if (pSpellEntry->Id == (783)) // Travel Form
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pTravelForm))
-                        m_spells.druid.pTravelForm = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pTravelForm))
+                        set.spells.druid.pTravelForm = pSpellEntry;
                 }
                 else if (pSpellEntry->Id == (1066)) // Aquatic Form
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pAquaticForm))
-                        m_spells.druid.pAquaticForm = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pAquaticForm))
+                        set.spells.druid.pAquaticForm = pSpellEntry;
                 }
                 else if (pSpellEntry->Id == (24858)) // Moonkin Form
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pMoonkinForm))
-                        m_spells.druid.pMoonkinForm = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pMoonkinForm))
+                        set.spells.druid.pMoonkinForm = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Wrath") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pWrath))
-                        m_spells.druid.pWrath = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pWrath))
+                        set.spells.druid.pWrath = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Moonfire") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pMoonfire))
-                        m_spells.druid.pMoonfire = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pMoonfire))
+                        set.spells.druid.pMoonfire = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Starfire") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pStarfire))
-                        m_spells.druid.pStarfire = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pStarfire))
+                        set.spells.druid.pStarfire = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Hurricane") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pHurricane))
-                        m_spells.druid.pHurricane = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pHurricane))
+                        set.spells.druid.pHurricane = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Insect Swarm") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pInsectSwarm))
-                        m_spells.druid.pInsectSwarm = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pInsectSwarm))
+                        set.spells.druid.pInsectSwarm = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Barkskin") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pBarkskin))
-                        m_spells.druid.pBarkskin = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pBarkskin))
+                        set.spells.druid.pBarkskin = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Nature's Grasp") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pNaturesGrasp))
-                        m_spells.druid.pNaturesGrasp = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pNaturesGrasp))
+                        set.spells.druid.pNaturesGrasp = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Mark of the Wild") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pMarkoftheWild))
-                        m_spells.druid.pMarkoftheWild = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pMarkoftheWild))
+                        set.spells.druid.pMarkoftheWild = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Gift of the Wild") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pGiftoftheWild))
-                        m_spells.druid.pGiftoftheWild = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pGiftoftheWild))
+                        set.spells.druid.pGiftoftheWild = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Thorns") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pThorns))
-                        m_spells.druid.pThorns = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pThorns))
+                        set.spells.druid.pThorns = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Remove Curse") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pRemoveCurse))
-                        m_spells.druid.pRemoveCurse = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pRemoveCurse))
+                        set.spells.druid.pRemoveCurse = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Cure Poison") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pCurePoison))
-                        m_spells.druid.pCurePoison = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pCurePoison))
+                        set.spells.druid.pCurePoison = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Abolish Poison") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pAbolishPoison))
-                        m_spells.druid.pAbolishPoison = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pAbolishPoison))
+                        set.spells.druid.pAbolishPoison = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Rebirth") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pRebirth))
-                        m_spells.druid.pRebirth = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pRebirth))
+                        set.spells.druid.pRebirth = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Innervate") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pInnervate))
-                        m_spells.druid.pInnervate = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pInnervate))
+                        set.spells.druid.pInnervate = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Nature's Swiftness") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pNaturesSwiftness))
-                        m_spells.druid.pNaturesSwiftness = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pNaturesSwiftness))
+                        set.spells.druid.pNaturesSwiftness = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Entangling Roots") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pEntanglingRoots))
-                        m_spells.druid.pEntanglingRoots = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pEntanglingRoots))
+                        set.spells.druid.pEntanglingRoots = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Hibernate") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pHibernate))
-                        m_spells.druid.pHibernate = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pHibernate))
+                        set.spells.druid.pHibernate = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Pounce") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pPounce))
-                        m_spells.druid.pPounce = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pPounce))
+                        set.spells.druid.pPounce = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Ravage") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pRavage))
-                        m_spells.druid.pRavage = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pRavage))
+                        set.spells.druid.pRavage = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Claw") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pClaw))
-                        m_spells.druid.pClaw = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pClaw))
+                        set.spells.druid.pClaw = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Shred") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pShred))
-                        m_spells.druid.pShred = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pShred))
+                        set.spells.druid.pShred = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Rake") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pRake))
-                        m_spells.druid.pRake = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pRake))
+                        set.spells.druid.pRake = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Rip") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pRip))
-                        m_spells.druid.pRip = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pRip))
+                        set.spells.druid.pRip = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Ferocious Bite") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pFerociousBite))
-                        m_spells.druid.pFerociousBite = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pFerociousBite))
+                        set.spells.druid.pFerociousBite = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Tiger's Fury") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pTigersFury))
-                        m_spells.druid.pTigersFury = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pTigersFury))
+                        set.spells.druid.pTigersFury = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Dash") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pDash))
-                        m_spells.druid.pDash = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pDash))
+                        set.spells.druid.pDash = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Cower") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pCower))
-                        m_spells.druid.pCower = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pCower))
+                        set.spells.druid.pCower = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Faerie Fire (Feral)") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pFaerieFireFeral))
-                        m_spells.druid.pFaerieFireFeral = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pFaerieFireFeral))
+                        set.spells.druid.pFaerieFireFeral = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Faerie Fire") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pFaerieFire))
-                        m_spells.druid.pFaerieFire = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pFaerieFire))
+                        set.spells.druid.pFaerieFire = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Growl") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pGrowl))
-                        m_spells.druid.pGrowl = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pGrowl))
+                        set.spells.druid.pGrowl = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Challenging Roar") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pChallengingRoar))
-                        m_spells.druid.pChallengingRoar = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pChallengingRoar))
+                        set.spells.druid.pChallengingRoar = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Demoralizing Roar") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pDemoralizingRoar))
-                        m_spells.druid.pDemoralizingRoar = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pDemoralizingRoar))
+                        set.spells.druid.pDemoralizingRoar = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Enrage") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pEnrage))
-                        m_spells.druid.pEnrage = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pEnrage))
+                        set.spells.druid.pEnrage = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Frenzied Regeneration") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pFrenziedRegeneration))
-                        m_spells.druid.pFrenziedRegeneration = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pFrenziedRegeneration))
+                        set.spells.druid.pFrenziedRegeneration = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Swipe") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pSwipe))
-                        m_spells.druid.pSwipe = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pSwipe))
+                        set.spells.druid.pSwipe = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Maul") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pMaul))
-                        m_spells.druid.pMaul = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pMaul))
+                        set.spells.druid.pMaul = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Bash") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pBash))
-                        m_spells.druid.pBash = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pBash))
+                        set.spells.druid.pBash = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Feral Charge") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pFeralCharge))
-                        m_spells.druid.pFeralCharge = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pFeralCharge))
+                        set.spells.druid.pFeralCharge = pSpellEntry;
                 }
                 else if (pSpellEntry->SpellName[0].find("Prowl") != std::string::npos)
                 {
-                    if (IsHigherRankSpell(m_spells.druid.pProwl))
-                        m_spells.druid.pProwl = pSpellEntry;
+                    if (IsHigherRankSpell(set.spells.druid.pProwl))
+                        set.spells.druid.pProwl = pSpellEntry;
                 }
                 break;
             }
@@ -1607,24 +1532,24 @@ void CombatBotBaseAI::PopulateSpellData()
             switch (pSpellEntry->Effect[i])
             {
                 case SPELL_EFFECT_HEAL:
-                    m_spellListDirectHeal.insert(pSpellEntry);
+                    set.spellListDirectHeal.insert(pSpellEntry);
                     break;
                 case SPELL_EFFECT_ATTACK_ME:
-                    m_spellListTaunt.push_back(pSpellEntry);
+                    set.spellListTaunt.push_back(pSpellEntry);
                     break;
                 case SPELL_EFFECT_RESURRECT:
                 case SPELL_EFFECT_RESURRECT_NEW:
-                    m_resurrectionSpell = pSpellEntry;
+                    set.pResurrectionSpell = pSpellEntry;
                     break;
                 case SPELL_EFFECT_APPLY_AURA:
                 {
                     switch (pSpellEntry->EffectApplyAuraName[i])
                     {
                         case SPELL_AURA_PERIODIC_HEAL:
-                            m_spellListPeriodicHeal.insert(pSpellEntry);
+                            set.spellListPeriodicHeal.insert(pSpellEntry);
                             break;
                         case SPELL_AURA_MOD_TAUNT:
-                            m_spellListTaunt.push_back(pSpellEntry);
+                            set.spellListTaunt.push_back(pSpellEntry);
                             break;
                     }
                     break;
@@ -1632,52 +1557,65 @@ void CombatBotBaseAI::PopulateSpellData()
             }
         }
     }
+}
+
+void CombatBotBaseAI::PopulateSpellData()
+{
+    // Slot assignment only depends on class and known spells,
+    // it is done once and shared by all bots with the same spells
+    CombatBotSpellSet const& set = BotSpellTable::GetSpellSet(me);
+
+    m_spells = set.spells;
+    m_resurrectionSpell = set.pResurrectionSpell;
+    m_spellListTaunt = set.spellListTaunt;
+    m_spellListPeriodicHeal = set.spellListPeriodicHeal;
+    m_spellListDirectHeal = set.spellListDirectHeal;
 
     switch (me->GetClass())
     {
         case CLASS_PALADIN:
         {
-            if (pSealOfFury && m_role == ROLE_TANK)
-                m_spells.paladin.pSeal = pSealOfFury;
-            else if (pSealOfCommand)
-                m_spells.paladin.pSeal = pSealOfCommand;
+            if (set.pSealOfFury && m_role == ROLE_TANK)
+                m_spells.paladin.pSeal = set.pSealOfFury;
+            else if (set.pSealOfCommand)
+                m_spells.paladin.pSeal = set.pSealOfCommand;
             else
-                m_spells.paladin.pSeal = pSealOfRighteousness;
+                m_spells.paladin.pSeal = set.pSealOfRighteousness;
 
-            if (pBlessingOfSanctuary && m_role == ROLE_TANK)
-                m_spells.paladin.pBlessingBuff = pBlessingOfSanctuary;
+            if (set.pBlessingOfSanctuary && m_role == ROLE_TANK)
+                m_spells.paladin.pBlessingBuff = set.pBlessingOfSanctuary;
             else
             {
                 std::vector<SpellEntry const*> blessings;
-                if (pBlessingOfLight)
-                    blessings.push_back(pBlessingOfLight);
-                if (pBlessingOfMight)
-                    blessings.push_back(pBlessingOfMight);
-                if (pBlessingOfWisdom)
-                    blessings.push_back(pBlessingOfWisdom);
-                if (pBlessingOfKings)
-                    blessings.push_back(pBlessingOfKings);
-                if (pBlessingOfSanctuary)
-                    blessings.push_back(pBlessingOfSanctuary);
+                if (set.pBlessingOfLight)
+                    blessings.push_back(set.pBlessingOfLight);
+                if (set.pBlessingOfMight)
+                    blessings.push_back(set.pBlessingOfMight);
+                if (set.pBlessingOfWisdom)
+                    blessings.push_back(set.pBlessingOfWisdom);
+                if (set.pBlessingOfKings)
+                    blessings.push_back(set.pBlessingOfKings);
+                if (set.pBlessingOfSanctuary)
+                    blessings.push_back(set.pBlessingOfSanctuary);
                 if (!blessings.empty())
                     m_spells.paladin.pBlessingBuff = SelectRandomContainerElement(blessings);
             }
 
             std::vector<SpellEntry const*> auras;
-            if (pDevotionAura)
-                auras.push_back(pDevotionAura);
-            if (pConcentrationAura)
-                auras.push_back(pConcentrationAura);
-            if (pRetributionAura)
-                auras.push_back(pRetributionAura);
-            if (pSanctityAura)
-                auras.push_back(pSanctityAura);
-            if (pShadowResistanceAura)
-                auras.push_back(pShadowResistanceAura);
-            if (pFrostResistanceAura)
-                auras.push_back(pFrostResistanceAura);
-            if (pFireResistanceAura)
-                auras.push_back(pFireResistanceAura);
+            if (set.pDevotionAura)
+                auras.push_back(set.pDevotionAura);
+            if (set.pConcentrationAura)
+                auras.push_back(set.pConcentrationAura);
+            if (set.pRetributionAura)
+                auras.push_back(set.pRetributionAura);
+            if (set.pSanctityAura)
+                auras.push_back(set.pSanctityAura);
+            if (set.pShadowResistanceAura)
+                auras.push_back(set.pShadowResistanceAura);
+            if (set.pFrostResistanceAura)
+                auras.push_back(set.pFrostResistanceAura);
+            if (set.pFireResistanceAura)
+                auras.push_back(set.pFireResistanceAura);
             if (!auras.empty())
                 m_spells.paladin.pAura = SelectRandomContainerElement(auras);
 
@@ -1686,72 +1624,72 @@ void CombatBotBaseAI::PopulateSpellData()
         case CLASS_SHAMAN:
         {
             std::vector<SpellEntry const*> airTotems;
-            if (pGraceOfAirTotem)
-                airTotems.push_back(pGraceOfAirTotem);
-            if (pNatureResistanceTotem)
-                airTotems.push_back(pNatureResistanceTotem);
-            if (pWindfuryTotem)
-                airTotems.push_back(pWindfuryTotem);
-            if (pWindwallTotem)
-                airTotems.push_back(pWindwallTotem);
-            if (pTranquilAirTotem)
-                airTotems.push_back(pTranquilAirTotem);
+            if (set.pGraceOfAirTotem)
+                airTotems.push_back(set.pGraceOfAirTotem);
+            if (set.pNatureResistanceTotem)
+                airTotems.push_back(set.pNatureResistanceTotem);
+            if (set.pWindfuryTotem)
+                airTotems.push_back(set.pWindfuryTotem);
+            if (set.pWindwallTotem)
+                airTotems.push_back(set.pWindwallTotem);
+            if (set.pTranquilAirTotem)
+                airTotems.push_back(set.pTranquilAirTotem);
             if (!airTotems.empty())
                 m_spells.shaman.pAirTotem = SelectRandomContainerElement(airTotems);
 
             std::vector<SpellEntry const*> earthTotems;
-            if (pEarthbindTotem)
-                earthTotems.push_back(pEarthbindTotem);
-            if (pStoneclawtotem)
-                earthTotems.push_back(pStoneclawtotem);
-            if (pStoneskinTotem)
-                earthTotems.push_back(pStoneskinTotem);
-            if (pStrengthOfEarthTotem)
-                earthTotems.push_back(pStrengthOfEarthTotem);
-            if (pTremorTotem)
-                earthTotems.push_back(pTremorTotem);
+            if (set.pEarthbindTotem)
+                earthTotems.push_back(set.pEarthbindTotem);
+            if (set.pStoneclawtotem)
+                earthTotems.push_back(set.pStoneclawtotem);
+            if (set.pStoneskinTotem)
+                earthTotems.push_back(set.pStoneskinTotem);
+            if (set.pStrengthOfEarthTotem)
+                earthTotems.push_back(set.pStrengthOfEarthTotem);
+            if (set.pTremorTotem)
+                earthTotems.push_back(set.pTremorTotem);
             if (!earthTotems.empty())
                 m_spells.shaman.pEarthTotem = SelectRandomContainerElement(earthTotems);
 
             std::vector<SpellEntry const*> fireTotems;
-            if (pFireNovaTotem)
-                fireTotems.push_back(pFireNovaTotem);
-            if (pMagmaTotem)
-                fireTotems.push_back(pMagmaTotem);
-            if (pSearingTotem)
-                fireTotems.push_back(pSearingTotem);
-            if (pFlametongueTotem)
-                fireTotems.push_back(pFlametongueTotem);
-            if (pFrostResistanceTotem)
-                fireTotems.push_back(pFrostResistanceTotem);
+            if (set.pFireNovaTotem)
+                fireTotems.push_back(set.pFireNovaTotem);
+            if (set.pMagmaTotem)
+                fireTotems.push_back(set.pMagmaTotem);
+            if (set.pSearingTotem)
+                fireTotems.push_back(set.pSearingTotem);
+            if (set.pFlametongueTotem)
+                fireTotems.push_back(set.pFlametongueTotem);
+            if (set.pFrostResistanceTotem)
+                fireTotems.push_back(set.pFrostResistanceTotem);
             if (!fireTotems.empty())
                 m_spells.shaman.pFireTotem = SelectRandomContainerElement(fireTotems);
 
             std::vector<SpellEntry const*> waterTotems;
-            if (pFireResistanceTotem)
-                waterTotems.push_back(pFireResistanceTotem);
-            if (pDiseaseCleansingTotem)
-                waterTotems.push_back(pDiseaseCleansingTotem);
-            if (pHealingStreamTotem)
-                waterTotems.push_back(pHealingStreamTotem);
-            if (pManaSpringTotem)
-                waterTotems.push_back(pManaSpringTotem);
-            if (pPoisonCleansingTotem)
-                waterTotems.push_back(pPoisonCleansingTotem);
+            if (set.pFireResistanceTotem)
+                waterTotems.push_back(set.pFireResistanceTotem);
+            if (set.pDiseaseCleansingTotem)
+                waterTotems.push_back(set.pDiseaseCleansingTotem);
+            if (set.pHealingStreamTotem)
+                waterTotems.push_back(set.pHealingStreamTotem);
+            if (set.pManaSpringTotem)
+                waterTotems.push_back(set.pManaSpringTotem);
+            if (set.pPoisonCleansingTotem)
+                waterTotems.push_back(set.pPoisonCleansingTotem);
             if (!waterTotems.empty())
                 m_spells.shaman.pWaterTotem = SelectRandomContainerElement(waterTotems);
 
-            if (pWindfuryWeapon && m_role == ROLE_MELEE_DPS)
-                m_spells.shaman.pWeaponBuff = pWindfuryWeapon;
+            if (set.pWindfuryWeapon && m_role == ROLE_MELEE_DPS)
+                m_spells.shaman.pWeaponBuff = set.pWindfuryWeapon;
             else
             {
                 std::vector<SpellEntry const*> weaponBuffs;
-                if (pWindfuryWeapon)
-                    weaponBuffs.push_back(pWindfuryWeapon);
-                if (pRockbiterWeapon)
-                    weaponBuffs.push_back(pRockbiterWeapon);
-                if (pFrostbrandWeapon)
-                    weaponBuffs.push_back(pFrostbrandWeapon);
+                if (set.pWindfuryWeapon)
+                    weaponBuffs.push_back(set.pWindfuryWeapon);
+                if (set.pRockbiterWeapon)
+                    weaponBuffs.push_back(set.pRockbiterWeapon);
+                if (set.pFrostbrandWeapon)
+                    weaponBuffs.push_back(set.pFrostbrandWeapon);
                 if (!weaponBuffs.empty())
                     m_spells.shaman.pWeaponBuff = SelectRandomContainerElement(weaponBuffs);
             }
@@ -1760,18 +1698,18 @@ void CombatBotBaseAI::PopulateSpellData()
         }
         case CLASS_MAGE:
         {
-            if (!m_spells.mage.pIceArmor && pFrostArmor)
-                m_spells.mage.pIceArmor = pFrostArmor;
+            if (!m_spells.mage.pIceArmor && set.pFrostArmor)
+                m_spells.mage.pIceArmor = set.pFrostArmor;
 
             std::vector<SpellEntry const*> polymorph;
-            if (pPolymorphSheep)
-                polymorph.push_back(pPolymorphSheep);
-            if (pPolymorphCow)
-                polymorph.push_back(pPolymorphCow);
-            if (pPolymorphPig)
-                polymorph.push_back(pPolymorphPig);
-            if (pPolymorphTurtle)
-                polymorph.push_back(pPolymorphTurtle);
+            if (set.pPolymorphSheep)
+                polymorph.push_back(set.pPolymorphSheep);
+            if (set.pPolymorphCow)
+                polymorph.push_back(set.pPolymorphCow);
+            if (set.pPolymorphPig)
+                polymorph.push_back(set.pPolymorphPig);
+            if (set.pPolymorphTurtle)
+                polymorph.push_back(set.pPolymorphTurtle);
             if (!polymorph.empty())
                 m_spells.mage.pPolymorph = SelectRandomContainerElement(polymorph);
 
@@ -1780,35 +1718,17 @@ void CombatBotBaseAI::PopulateSpellData()
         case CLASS_ROGUE:
         {
             // Rogues can only craft an item that applies the poison, they don't know the actual poison enchant.
-            auto GetHighestRankOfPoisonByName = [](std::string name, uint32 level)
-            {
-                SpellEntry const* pHighestRank = nullptr;
-                for (uint32 i = 0; i < sSpellMgr.GetMaxSpellId(); i++)
-                {
-                    if (SpellEntry const* pSpellEntry = sSpellMgr.GetSpellEntry(i))
-                    {
-                        if (pSpellEntry->Effect[0] == SPELL_EFFECT_ENCHANT_ITEM_TEMPORARY &&
-                            pSpellEntry->SpellName[0] == name && pSpellEntry->spellLevel <= level &&
-                           (!pHighestRank || pHighestRank->spellLevel < pSpellEntry->spellLevel))
-                        {
-                            pHighestRank = pSpellEntry;
-                        }
-                    }
-                }
-                return pHighestRank;
-            };
-            
             SpellEntry const* pPoisonSpell = nullptr;
             std::vector<SpellEntry const*> vPoisons;
-            if (hasDeadlyPoison && (pPoisonSpell = GetHighestRankOfPoisonByName("Deadly Poison", me->GetLevel())))
+            if (set.hasDeadlyPoison && (pPoisonSpell = BotSpellTable::GetPoisonEnchant(BOT_POISON_DEADLY, me->GetLevel())))
                 vPoisons.push_back(pPoisonSpell);
-            if (hasInstantPoison && (pPoisonSpell = GetHighestRankOfPoisonByName("Instant Poison", me->GetLevel())))
+            if (set.hasInstantPoison && (pPoisonSpell = BotSpellTable::GetPoisonEnchant(BOT_POISON_INSTANT, me->GetLevel())))
                 vPoisons.push_back(pPoisonSpell);
-            if (hasCripplingPoison && (pPoisonSpell = GetHighestRankOfPoisonByName("Crippling Poison", me->GetLevel())))
+            if (set.hasCripplingPoison && (pPoisonSpell = BotSpellTable::GetPoisonEnchant(BOT_POISON_CRIPPLING, me->GetLevel())))
                 vPoisons.push_back(pPoisonSpell);
-            if (hasWoundPoison && (pPoisonSpell = GetHighestRankOfPoisonByName("Wound Poison", me->GetLevel())))
+            if (set.hasWoundPoison && (pPoisonSpell = BotSpellTable::GetPoisonEnchant(BOT_POISON_WOUND, me->GetLevel())))
                 vPoisons.push_back(pPoisonSpell);
-            if (HasMindNumbingPoison && (pPoisonSpell = GetHighestRankOfPoisonByName("Mind-numbing Poison", me->GetLevel())))
+            if (set.HasMindNumbingPoison && (pPoisonSpell = BotSpellTable::GetPoisonEnchant(BOT_POISON_MIND_NUMBING, me->GetLevel())))
                 vPoisons.push_back(pPoisonSpell);
 
             if (!vPoisons.empty())
@@ -1842,32 +1762,38 @@ void CombatBotBaseAI::AddAllSpellReagents()
     }
 }
 
-bool CombatBotBaseAI::AreOthersOnSameTarget(ObjectGuid guid, bool checkMelee, bool checkSpells) const
+BotGroupStateView* CombatBotBaseAI::GetGroupStateView() const
 {
     Group* pGroup = me->GetGroup();
-    for (GroupReference* itr = pGroup->GetFirstMember(); itr != nullptr; itr = itr->next())
-    {
-        if (Player* pMember = itr->getSource())
-        {
-            // Not self.
-            if (pMember == me)
-                continue;
+    Map* pMap = me->FindMap();
+    if (!pGroup || !pMap)
+        return nullptr;
 
-            // Not the target itself.
-            if (pMember->GetObjectGuid() == guid)
-                continue;
+    return &pMap->GetBotGroupStates().GetView(pGroup, *pMap);
+}
 
-            if (pMember->GetTargetGuid() == guid)
-            {
-                if (checkMelee && pMember->HasUnitState(UNIT_STATE_MELEE_ATTACKING))
-                    return true;
+bool CombatBotBaseAI::AreOthersOnSameTarget(ObjectGuid guid, bool checkMelee, bool checkSpells) const
+{
+    BotGroupStateView const* pView = GetGroupStateView();
+    if (!pView)
+        return false;
 
-                if (checkSpells && pMember->IsNonMeleeSpellCasted())
-                    return true;
-            }
+    uint32 melee = checkMelee ? pView->GetMeleeAttackers(guid) : 0;
+    uint32 casting = checkSpells ? pView->GetSpellCasters(guid) : 0;
+
+    // Not self.
+    if (BotGroupMember const* pSelf = pView->FindMember(me->GetObjectGuid()))
+    {
+        if (pSelf->targetGuid == guid)
+        {
+            if (pSelf->isMeleeAttacking && melee)
+                --melee;
+            if (pSelf->isCasting && casting)
+                --casting;
         }
     }
-    return false;
+
+    return melee || casting;
 }
 
 bool CombatBotBaseAI::FindAndHealInjuredAlly(float selfHealPercent, float groupHealPercent)
@@ -1981,8 +1907,8 @@ bool CombatBotBaseAI::IsValidHealTarget(Unit const* pTarget, float healthPercent
 {
     return (pTarget->GetHealthPercent() < healthPercent) &&
             me->IsValidHelpfulTarget(pTarget) &&
-            me->IsWithinLOSInMap(pTarget) &&
-            me->IsWithinDist(pTarget, 30.0f);
+            me->IsWithinDist(pTarget, 30.0f) &&
+            me->IsWithinLOSInMap(pTarget);
 }
 
 Unit* CombatBotBaseAI::SelectHealTarget(float selfHealPercent, float groupHealPercent) const
@@ -1993,41 +1919,45 @@ Unit* CombatBotBaseAI::SelectHealTarget(float selfHealPercent, float groupHealPe
     if (IsInDuel())
         return nullptr;
 
-    Unit* pTarget = nullptr;
-    float healthPercent = 100.0f;
+    BotGroupStateView const* pView = GetGroupStateView();
+    if (!pView)
+        return nullptr;
 
-    if (Group* pGroup = me->GetGroup())
+    // Most injured first, so the first valid member is the one to heal.
+    Unit* pTakenTarget = nullptr;
+    for (uint8 index : pView->GetByHealth())
     {
-        for (GroupReference* itr = pGroup->GetFirstMember(); itr != nullptr; itr = itr->next())
-        {
-            if (Unit* pMember = itr->getSource())
-            {
-                // We already checked self.
-                if (pMember == me)
-                    continue;
+        BotGroupMember const& member = pView->GetMembers()[index];
 
-                // Avoid all healers picking same target.
-                if (pTarget && !IsTankClass(pMember->GetClass()) && AreOthersOnSameTarget(pMember->GetObjectGuid(), false, true))
-                    continue;
+        // We already checked self.
+        if (member.pPlayer == me)
+            continue;
 
-                // Check if we should heal party member.
-                if ((IsValidHealTarget(pMember, groupHealPercent) &&
-                    healthPercent > pMember->GetHealthPercent()) ||
-                    // Or a pet if there are no injured players.
-                    (!pTarget && (pMember = pMember->GetPet()) &&
-                      IsValidHealTarget(pMember, groupHealPercent)))
-                {
-                    healthPercent = pMember->GetHealthPercent();
-                    pTarget = pMember;
-                }
-            }
+        if (!IsValidHealTarget(member.pPlayer, groupHealPercent))
+            continue;
+
+        // Avoid all healers picking same target.
+        if (!IsTankClass(member.pPlayer->GetClass()) && AreOthersOnSameTarget(member.guid, false, true))
+        {
+            if (!pTakenTarget)
+                pTakenTarget = member.pPlayer;
+            continue;
         }
+
+        return member.pPlayer;
     }
 
-    if (healthPercent == 100.0f)
-        return nullptr;
+    if (pTakenTarget)
+        return pTakenTarget;
 
-    return pTarget;
+    // Or a pet if there are no injured players.
+    for (BotGroupMember const& member : pView->GetMembers())
+    {
+        if (member.pPet && IsValidHealTarget(member.pPet, groupHealPercent))
+            return member.pPet;
+    }
+
+    return nullptr;
 }
 
 Unit* CombatBotBaseAI::SelectPeriodicHealTarget(float selfHealPercent, float groupHealPercent) const
@@ -2039,21 +1969,20 @@ Unit* CombatBotBaseAI::SelectPeriodicHealTarget(float selfHealPercent, float gro
     if (IsInDuel())
         return nullptr;
 
-    if (Group* pGroup = me->GetGroup())
+    if (BotGroupStateView const* pView = GetGroupStateView())
     {
-        for (GroupReference* itr = pGroup->GetFirstMember(); itr != nullptr; itr = itr->next())
+        for (uint8 index : pView->GetByHealth())
         {
-            if (Unit* pMember = itr->getSource())
-            {
-                // We already checked self.
-                if (pMember == me)
-                    continue;
+            Player* pMember = pView->GetMembers()[index].pPlayer;
 
-                // Check if we should heal party member.
-                if (IsValidHealTarget(pMember, groupHealPercent) &&
-                   !pMember->HasAuraType(SPELL_AURA_PERIODIC_HEAL))
-                    return pMember;
-            }
+            // We already checked self.
+            if (pMember == me)
+                continue;
+
+            // Check if we should heal party member.
+            if (IsValidHealTarget(pMember, groupHealPercent) &&
+               !pMember->HasAuraType(SPELL_AURA_PERIODIC_HEAL))
+                return pMember;
         }
     }
 
@@ -2067,18 +1996,18 @@ bool CombatBotBaseAI::FindAndPreHealTarget()
 
     if (!IsInDuel())
     {
-        if (Group* pGroup = me->GetGroup())
+        if (BotGroupStateView const* pView = GetGroupStateView())
         {
-            for (GroupReference* itr = pGroup->GetFirstMember(); itr != nullptr; itr = itr->next())
+            for (BotGroupMember const& member : pView->GetMembers())
             {
-                if (Unit* pMember = itr->getSource())
+                if (Unit* pMember = member.pPlayer)
                 {
                     // We already checked self.
                     if (pMember == me)
                         continue;
 
                     // Avoid all healers picking same target.
-                    if (pTarget && !IsTankClass(pMember->GetClass()) && AreOthersOnSameTarget(pMember->GetObjectGuid(), false, true))
+                    if (pTarget && !IsTankClass(member.pPlayer->GetClass()) && AreOthersOnSameTarget(member.guid, false, true))
                         continue;
 
                     int32 incomingDamage = GetIncomingdamage(pMember);
@@ -2117,6 +2046,43 @@ bool CombatBotBaseAI::FindAndPreHealTarget()
     return pTarget;
 }
 
+Unit* CombatBotBaseAI::SelectFirstInLineOfSight(std::vector<Unit*> const& candidates) const
+{
+    if (candidates.empty())
+        return nullptr;
+
+    // Same points as WorldObject::IsWithinLOSInMap
+    float const eyeZ = me->GetPositionZ() + me->GetCollisionHeight();
+    std::vector<VMAP::LineOfSightSegment> segments(candidates.size());
+    for (uint32 i = 0; i < candidates.size(); ++i)
+    {
+        VMAP::LineOfSightSegment& segment = segments[i];
+        segment.x1 = me->GetPositionX();
+        segment.y1 = me->GetPositionY();
+        segment.z1 = eyeZ;
+
+        // Standing on the unit, nothing can be in between
+        if (me->IsWithinDist(candidates[i], 0.0f))
+        {
+            segment.x2 = segment.x1;
+            segment.y2 = segment.y1;
+            segment.z2 = segment.z1;
+        }
+        else
+            candidates[i]->GetLosCheckPosition(segment.x2, segment.y2, segment.z2);
+    }
+
+    me->GetMap()->areInLineOfSight(segments.data(), uint32(segments.size()));
+
+    for (uint32 i = 0; i < candidates.size(); ++i)
+    {
+        if (segments[i].inLineOfSight && me->IsInMap(candidates[i]))
+            return candidates[i];
+    }
+
+    return nullptr;
+}
+
 bool CombatBotBaseAI::IsValidHostileTarget(Unit const* pTarget) const
 {
     return me->IsValidAttackTarget(pTarget) &&
@@ -2231,21 +2197,44 @@ bool CombatBotBaseAI::IsValidBuffTarget(Unit const* pTarget, SpellEntry const* p
 
 Player* CombatBotBaseAI::SelectBuffTarget(SpellEntry const* pSpellEntry) const
 {
-    Group* pGroup = me->GetGroup();
-    if (pGroup)
+    BotGroupStateView* pView = GetGroupStateView();
+    if (!pView)
+        return nullptr;
+
+    // Who lacks the buff is the same for every bot, work it out once per pass.
+    uint64 const* pMissing = pView->FindMissingBuffMask(pSpellEntry->Id);
+    if (!pMissing)
     {
-        for (GroupReference* itr = pGroup->GetFirstMember(); itr != nullptr; itr = itr->next())
+        uint64 mask = 0;
+        std::vector<BotGroupMember> const& members = pView->GetMembers();
+        for (uint32 i = 0; i < members.size(); ++i)
         {
-            if (Player* pMember = itr->getSource())
-            {
-                if (me->IsValidHelpfulTarget(pMember) &&
-                   !pMember->IsGameMaster() &&
-                    IsValidBuffTarget(pMember, pSpellEntry) &&
-                    me->IsWithinLOSInMap(pMember) &&
-                    me->IsWithinDist(pMember, 30.0f))
-                    return pMember;
-            }
+            if (!members[i].isGameMaster && IsValidBuffTarget(members[i].pPlayer, pSpellEntry))
+                mask |= uint64(1) << i;
+        }
+        pView->SetMissingBuffMask(pSpellEntry->Id, mask);
+        pMissing = pView->FindMissingBuffMask(pSpellEntry->Id);
+    }
+
+    for (uint32 i = 0; i < pView->GetMembers().size(); ++i)
+    {
+        if (!(*pMissing & (uint64(1) << i)))
+            continue;
+
+        Player* pMember = pView->GetMembers()[i].pPlayer;
+        if (!me->IsValidHelpfulTarget(pMember) ||
+            !me->IsWithinDist(pMember, 30.0f) ||
+            !me->IsWithinLOSInMap(pMember))
+            continue;
+
+        // May have been buffed by someone else since.
+        if (!IsValidBuffTarget(pMember, pSpellEntry))
+        {
+            pView->ClearMissingBuff(pSpellEntry->Id, uint8(i));
+            continue;
         }
+
+        return pMember;
     }
 
     return nullptr;
@@ -2253,21 +2242,29 @@ Player* CombatBotBaseAI::SelectBuffTarget(SpellEntry const* pSpellEntry) const
 
 Player* CombatBotBaseAI::SelectDispelTarget(SpellEntry const* pSpellEntry) const
 {
-    Group* pGroup = me->GetGroup();
-    if (pGroup)
+    BotGroupStateView const* pView = GetGroupStateView();
+    if (!pView)
+        return nullptr;
+
+    uint32 dispelMask = 0;
+    for (uint8 i = 0; i < MAX_EFFECT_INDEX; ++i)
     {
-        for (GroupReference* itr = pGroup->GetFirstMember(); itr != nullptr; itr = itr->next())
-        {
-            if (Player* pMember = itr->getSource())
-            {
-                if (me->IsValidHelpfulTarget(pMember) &&
-                   !pMember->IsGameMaster() &&
-                    IsValidDispelTarget(pMember, pSpellEntry) &&
-                    me->IsWithinLOSInMap(pMember) &&
-                    me->IsWithinDist(pMember, 30.0f))
-                    return pMember;
-            }
-        }
+        if (pSpellEntry->Effect[i] == SPELL_EFFECT_DISPEL)
+            dispelMask |= Spells::GetDispellMask(DispelType(pSpellEntry->EffectMiscValue[i]));
+    }
+
+    for (BotGroupMember const& member : pView->GetMembers())
+    {
+        // Nothing to remove, charmed members count as hostile so check them fully.
+        if (!(member.dispelMask & dispelMask) && !member.isCharmed)
+            continue;
+
+        if (me->IsValidHelpfulTarget(member.pPlayer) &&
+           !member.isGameMaster &&
+            me->IsWithinDist(member.pPlayer, 30.0f) &&
+            IsValidDispelTarget(member.pPlayer, pSpellEntry) &&
+            me->IsWithinLOSInMap(member.pPlayer))
+            return member.pPlayer;
     }
 
     return nullptr;
@@ -2540,103 +2537,96 @@ void CombatBotBaseAI::EquipRandomGearInEmptySlots()
     bool const onlyPvE = urand(0, 1) != 0;
     uint8 const honorRank = onlyPvE ? 0 : urand(5, 18);
 
-    std::map<uint32 /*slot*/, std::vector<ItemPrototype const*>> itemsPerSlot;
-    for (auto const& itr : sObjectMgr.GetItemPrototypeMap())
-    {
-        ItemPrototype const* pProto = &itr.second;
-
-        // Only items that have already been discovered by someone
-        if (!pProto->Discovered)
-            continue;
-
-        // Skip unobtainable items
-        if (pProto->HasExtraFlag(ITEM_EXTRA_NOT_OBTAINABLE))
-            continue;
-
-        // Only gear and weapons
-        if (pProto->Class != ITEM_CLASS_WEAPON && pProto->Class != ITEM_CLASS_ARMOR)
-            continue;
+    // Avoid low level items
+    uint32 const levelDifference = sWorld.getConfig(CONFIG_UINT32_PARTY_BOT_RANDOM_GEAR_LEVEL_DIFFERENCE);
 
-        // No tabards and shirts
-        if (pProto->InventoryType == INVTYPE_TABARD || pProto->InventoryType == INVTYPE_BODY)
-            continue;
-
-        if (pProto->SourceQuestRaces && !(pProto->SourceQuestRaces & me->GetRaceMask()))
-            continue;
-
-        if (pProto->SourceQuestClasses && !(pProto->SourceQuestClasses & me->GetClassMask()))
-            continue;
+    std::map<uint32 /*slot*/, std::vector<BotGearItem const*>> itemsPerSlot;
+    for (BotGearGroup const& group : BotGearIndex::GetGearGroups(me->GetLevel()))
+    {
+        // Slots and proficiency only depend on inventory type, class and subclass
+        uint8 slots[4];
+        group.pFirst->GetAllowedEquipSlots(slots, me->GetClass(), me->CanDualWield());
 
-        if (pProto->SourceQuestLevel < 0)
-        {
-            // Avoid higher level items with no level requirement
-            if (!pProto->RequiredLevel && pProto->ItemLevel > me->GetLevel())
-                continue;
-        }
-        else
+        bool hasFreeSlot = false;
+        for (uint8 slot : slots)
         {
-            // Item is from a high level quest
-            if (uint32(pProto->SourceQuestLevel) > me->GetLevel())
-                continue;
+            if (slot >= EQUIPMENT_SLOT_START && slot < EQUIPMENT_SLOT_END &&
+                !me->GetItemByPos(INVENTORY_SLOT_BAG_0, slot))
+                hasFreeSlot = true;
         }
 
-        // Avoid low level items
-        if ((pProto->ItemLevel + sWorld.getConfig(CONFIG_UINT32_PARTY_BOT_RANDOM_GEAR_LEVEL_DIFFERENCE)) < me->GetLevel())
+        if (!hasFreeSlot)
             continue;
 
-        if (me->CanUseItem(pProto, onlyPvE) != EQUIP_ERR_OK)
-            continue;
-
-        if (pProto->RequiredHonorRank > honorRank)
-            continue;
-
-        if (pProto->RequiredReputationFaction && uint32(me->GetReputationRank(pProto->RequiredReputationFaction)) < pProto->RequiredReputationRank)
-            continue;
-
-        if (uint32 skill = pProto->GetProficiencySkill())
+        if (uint32 skill = group.pFirst->GetProficiencySkill())
         {
             // Don't equip cloth items on warriors, etc unless bot is a healer
-            if (pProto->Class == ITEM_CLASS_ARMOR &&
-                pProto->InventoryType != INVTYPE_CLOAK &&
-                pProto->InventoryType != INVTYPE_SHIELD &&
+            if (group.pFirst->Class == ITEM_CLASS_ARMOR &&
+                group.pFirst->InventoryType != INVTYPE_CLOAK &&
+                group.pFirst->InventoryType != INVTYPE_SHIELD &&
                 skill != me->GetHighestKnownArmorProficiency() &&
                 m_role != ROLE_HEALER)
                 continue;
 
             // Fist weapons use unarmed skill calculations, but we must query fist weapon skill presence to use this item
-            if (pProto->SubClass == ITEM_SUBCLASS_WEAPON_FIST)
+            if (group.pFirst->SubClass == ITEM_SUBCLASS_WEAPON_FIST)
                 skill = SKILL_FIST_WEAPONS;
             if (!me->GetSkillValue(skill))
                 continue;
         }
 
-        uint8 slots[4];
-        pProto->GetAllowedEquipSlots(slots, me->GetClass(), me->CanDualWield());
-
-        for (uint8 slot : slots)
+        for (BotGearItem const& item : group.items)
         {
-            if (slot >= EQUIPMENT_SLOT_START && slot < EQUIPMENT_SLOT_END &&
-                !me->GetItemByPos(INVENTORY_SLOT_BAG_0, slot))
+            ItemPrototype const* pProto = item.pProto;
+
+            // Sorted by item level, the rest of the group is too low
+            if (pProto->ItemLevel + levelDifference < me->GetLevel())
+                break;
+
+            // Only items that have already been discovered by someone
+            if (!pProto->Discovered)
+                continue;
+
+            if (pProto->SourceQuestRaces && !(pProto->SourceQuestRaces & me->GetRaceMask()))
+                continue;
+
+            if (pProto->SourceQuestClasses && !(pProto->SourceQuestClasses & me->GetClassMask()))
+                continue;
+
+            if (me->CanUseItem(pProto, onlyPvE) != EQUIP_ERR_OK)
+                continue;
+
+            if (pProto->RequiredHonorRank > honorRank)
+                continue;
+
+            if (pProto->RequiredReputationFaction && uint32(me->GetReputationRank(pProto->RequiredReputationFaction)) < pProto->RequiredReputationRank)
+                continue;
+
+            for (uint8 slot : slots)
             {
-                // Offhand checks
-                if (slot == EQUIPMENT_SLOT_OFFHAND)
+                if (slot >= EQUIPMENT_SLOT_START && slot < EQUIPMENT_SLOT_END &&
+                    !me->GetItemByPos(INVENTORY_SLOT_BAG_0, slot))
                 {
-                    // Only allow shield in offhand for tanks
-                    if (pProto->InventoryType != INVTYPE_SHIELD &&
-                        m_role == ROLE_TANK && IsShieldClass(me->GetClass()))
-                        continue;
-
-                    // Only equip holdables on mana users
-                    if (pProto->InventoryType == INVTYPE_HOLDABLE &&
-                        m_role != ROLE_HEALER && m_role != ROLE_RANGE_DPS)
-                        continue;
-                }
+                    // Offhand checks
+                    if (slot == EQUIPMENT_SLOT_OFFHAND)
+                    {
+                        // Only allow shield in offhand for tanks
+                        if (pProto->InventoryType != INVTYPE_SHIELD &&
+                            m_role == ROLE_TANK && IsShieldClass(me->GetClass()))
+                            continue;
+
+                        // Only equip holdables on mana users
+                        if (pProto->InventoryType == INVTYPE_HOLDABLE &&
+                            m_role != ROLE_HEALER && m_role != ROLE_RANGE_DPS)
+                            continue;
+                    }
 
-                itemsPerSlot[slot].push_back(pProto);
+                    itemsPerSlot[slot].push_back(&item);
 
-                // Unique item
-                if (pProto->MaxCount == 1)
-                    break;
+                    // Unique item
+                    if (pProto->MaxCount == 1)
+                        break;
+                }
             }
         }
     }
@@ -2650,35 +2640,19 @@ void CombatBotBaseAI::EquipRandomGearInEmptySlots()
         
         for (auto const& pItem : itr.second)
         {
-            for (auto const& stat : pItem->ItemStat)
+            if (BotGearIndex::HasStat(*pItem, primaryStat))
             {
-                if (stat.ItemStatType == primaryStat && stat.ItemStatValue > 0)
-                {
-                    hasPrimaryStatItem = true;
-                    break;
-                }
-            }
-
-            if (hasPrimaryStatItem)
+                hasPrimaryStatItem = true;
                 break;
+            }
         }
 
         if (hasPrimaryStatItem)
         {
             itr.second.erase(std::remove_if(itr.second.begin(), itr.second.end(),
-            [primaryStat](ItemPrototype const* & pItem)
+            [primaryStat](BotGearItem const* & pItem)
             {
-                bool itemHasPrimaryStat = false;
-                for (auto const& stat : pItem->ItemStat)
-                {
-                    if (stat.ItemStatType == primaryStat && stat.ItemStatValue > 0)
-                    {
-                        itemHasPrimaryStat = true;
-                        break;
-                    }
-                }
-
-                return !itemHasPrimaryStat;
+                return !BotGearIndex::HasStat(*pItem, primaryStat);
             }),
                 itr.second.end());
         }
@@ -2687,7 +2661,7 @@ void CombatBotBaseAI::EquipRandomGearInEmptySlots()
 
         for (auto const& pItem : itr.second)
         {
-            if (pItem->RequiredHonorRank)
+            if (pItem->pProto->RequiredHonorRank)
             {
                 hasPvpItem = true;
                 break;
@@ -2697,9 +2671,9 @@ void CombatBotBaseAI::EquipRandomGearInEmptySlots()
         if (hasPvpItem)
         {
             itr.second.erase(std::remove_if(itr.second.begin(), itr.second.end(),
-                [](ItemPrototype const* & pItem)
+                [](BotGearItem const* & pItem)
             {
-                return pItem->RequiredHonorRank == 0;
+                return pItem->pProto->RequiredHonorRank == 0;
             }),
                 itr.second.end());
         }
@@ -2718,7 +2692,7 @@ void CombatBotBaseAI::EquipRandomGearInEmptySlots()
         if (itr.second.empty())
             continue;
 
-        ItemPrototype const* pProto = SelectRandomContainerElement(itr.second);
+        ItemPrototype const* pProto = SelectRandomContainerElement(itr.second)->pProto;
         if (!pProto)
             continue;
 
@@ -2814,6 +2788,11 @@ SpellCastResult CombatBotBaseAI::DoCastSpell(Unit* pTarget, SpellEntry const* pS
     me->SetTargetGuid(pTarget->GetObjectGuid());
     auto result = me->CastSpell(pTarget, pSpellEntry, false);
 
+    // Let the other bots in the group see who we are casting at.
+    if (result == SPELL_CAST_OK)
+        if (BotGroupStateView* pView = GetGroupStateView())
+            pView->UpdateMemberTarget(me);
+
     //printf("cast %s result %u\n", pSpellEntry->SpellName[0].c_str(), result);
 
     if ((result == SPELL_FAILED_MOVING ||
@@ -2868,18 +2847,15 @@ void CombatBotBaseAI::AddHunterAmmo()
                         return;
                 }
 
+                // Highest item level first
                 ItemPrototype const* pAmmoProto = nullptr;
-                for (auto const& itr : sObjectMgr.GetItemPrototypeMap())
+                for (ItemPrototype const* pProto : BotGearIndex::GetAmmo(ammoType))
                 {
-                    ItemPrototype const* pProto = &itr.second;
-
-                    if (pProto->Class == ITEM_CLASS_PROJECTILE &&
-                        pProto->SubClass == ammoType &&
-                        pProto->RequiredLevel <= me->GetLevel() &&
-                        (!pAmmoProto || pAmmoProto->ItemLevel < pProto->ItemLevel) &&
+                    if (pProto->RequiredLevel <= me->GetLevel() &&
                         me->CanUseAmmo(pProto->ItemId) == EQUIP_ERR_OK)
                     {
                         pAmmoProto = pProto;
+                        break;
                     }
                 }
 
@@ -3141,6 +3117,20 @@ void CombatBotBaseAI::ActivateNearbyAreaTrigger()
     }
 }
 
+bool CombatBotBaseAI::WantsPacket(uint16 opcode) const
+{
+    // Keep in sync with the opcodes handled in OnPacketReceived
+    switch (opcode)
+    {
+        case SMSG_NEW_WORLD:
+        case MSG_MOVE_TELEPORT_ACK:
+        case SMSG_LOGIN_SETTIMESPEED:
+        case SMSG_BATTLEFIELD_STATUS:
+            return true;
+    }
+    return false;
+}
+
 void CombatBotBaseAI::OnPacketReceived(WorldPacket const* packet)
 {
     // Must always check "me" player pointer here!
@@ -3178,75 +3168,74 @@ void CombatBotBaseAI::OnPacketReceived(WorldPacket const* packet)
             UpdateVisualHonorRankBasedOnItems();
             break;
         }
-        case SMSG_TRADE_STATUS:
+        case SMSG_BATTLEFIELD_STATUS:
         {
             if (!me)
                 return;
 
-            uint32 status = *((uint32*)(*packet).contents());
-            if (status == TRADE_STATUS_BEGIN_TRADE)
+            if (me->IsBeingTeleported() || me->InBattleGround())
+                m_receivedBgInvite = false;
+            else
+            {
+                for (uint32 i = BATTLEGROUND_QUEUE_AV; i <= BATTLEGROUND_QUEUE_AB; i++)
+                {
+                    if (me->IsInvitedForBattleGroundQueueType(BattleGroundQueueTypeId(i)))
+                    {
+                        m_receivedBgInvite = true;
+                        break;
+                    }
+                }
+            }
+            return;
+        }
+    }
+}
+
+void CombatBotBaseAI::OnEvent(BotEvent const& event)
+{
+    if (!me)
+        return;
+
+    switch (event.type)
+    {
+        case BOT_EVENT_TRADE_STATUS:
+        {
+            if (event.value == TRADE_STATUS_BEGIN_TRADE)
             {
                 std::unique_ptr<WorldPacket> data = std::make_unique<WorldPacket>(CMSG_BEGIN_TRADE);
                 me->GetSession()->QueuePacket(std::move(data));
             }
-            else if (status == TRADE_STATUS_TRADE_ACCEPT)
+            else if (event.value == TRADE_STATUS_TRADE_ACCEPT)
             {
                 std::unique_ptr<WorldPacket> data = std::make_unique<WorldPacket>(CMSG_ACCEPT_TRADE);
                 *data << uint32(1);
                 me->GetSession()->QueuePacket(std::move(data));
             }
-            else if (status == TRADE_STATUS_TRADE_COMPLETE)
+            else if (event.value == TRADE_STATUS_TRADE_COMPLETE)
             {
                 EquipOrUseNewItem();
                 UpdateVisualHonorRankBasedOnItems();
             }
             break;
         }
-        case SMSG_RESURRECT_REQUEST:
+        case BOT_EVENT_RESURRECT_REQUEST:
         {
-            if (!me)
-                return;
-
             std::unique_ptr<WorldPacket> data = std::make_unique<WorldPacket>(CMSG_RESURRECT_RESPONSE);
             *data << me->GetResurrector();
             *data << uint8(1);
             me->GetSession()->QueuePacket(std::move(data));
             break;
         }
-        case SMSG_BATTLEFIELD_STATUS:
+        case BOT_EVENT_LOOT_ROLL_STARTED:
         {
-            if (!me)
-                return;
-
-            if (me->IsBeingTeleported() || me->InBattleGround())
-                m_receivedBgInvite = false;
-            else
-            {
-                for (uint32 i = BATTLEGROUND_QUEUE_AV; i <= BATTLEGROUND_QUEUE_AB; i++)
-                {
-                    if (me->IsInvitedForBattleGroundQueueType(BattleGroundQueueTypeId(i)))
-                    {
-                        m_receivedBgInvite = true;
-                        break;
-                    }
-                }
-            }
-            return;
-        }
-        case SMSG_LOOT_START_ROLL:
-        {
-            if (!me)
-                return;
-
-            uint64 guid = *((uint64*)(*packet).contents());
-            uint32 slot = *(((uint32*)(*packet).contents()) + 2);
-
             std::unique_ptr<WorldPacket> data = std::make_unique<WorldPacket>(CMSG_LOOT_ROLL);
-            *data << uint64(guid);
-            *data << uint32(slot);
+            *data << event.guid;
+            *data << uint32(event.value);
             *data << uint8(0); // pass
             me->GetSession()->QueuePacket(std::move(data));
-            return;
+            break;
         }
+        default:
+            break;
     }
 }
@@ -5,6 +5,8 @@
 #include "SpellEntry.h"
 #include "Player.h"
 
+class BotGroupStateView;
+
 struct HealSpellCompare
 {
     bool operator() (SpellEntry const* const lhs, SpellEntry const* const rhs) const
@@ -71,6 +73,366 @@ struct HealAuraCompare
     }
 };
 
+// Spell slots of a combat bot, one struct per class
+union CombatBotSpellSlots
+{
+    struct
+    {
+        SpellEntry const* spells[45];
+    } raw;
+    struct
+    {
+        SpellEntry const* pAura;
+        SpellEntry const* pSeal;
+        SpellEntry const* pBlessingBuff;
+        SpellEntry const* pBlessingOfProtection;
+        SpellEntry const* pBlessingOfFreedom;
+        SpellEntry const* pBlessingOfSacrifice;
+        SpellEntry const* pHammerOfJustice;
+        SpellEntry const* pJudgement;
+        SpellEntry const* pExorcism;
+        SpellEntry const* pConsecration;
+        SpellEntry const* pHammerOfWrath;
+        SpellEntry const* pCleanse;
+        SpellEntry const* pDivineShield;
+        SpellEntry const* pLayOnHands;
+        SpellEntry const* pRighteousFury;
+        SpellEntry const* pHolyShock;
+        SpellEntry const* pDivineFavor;
+        SpellEntry const* pHolyWrath;
+        SpellEntry const* pTurnEvil;
+        SpellEntry const* pHolyShield;
+    } paladin;
+    struct
+    {
+        SpellEntry const* pLightningBolt;
+        SpellEntry const* pChainLightning;
+        SpellEntry const* pEarthShock;
+        SpellEntry const* pFlameShock;
+        SpellEntry const* pFrostShock;
+        SpellEntry const* pPurge;
+        SpellEntry const* pStormstrike;
+        SpellEntry const* pElementalMastery;
+        SpellEntry const* pLightningShield;
+        SpellEntry const* pGhostWolf;
+        SpellEntry const* pCureDisease;
+        SpellEntry const* pCurePoison;
+        SpellEntry const* pAirTotem;
+        SpellEntry const* pEarthTotem;
+        SpellEntry const* pFireTotem;
+        SpellEntry const* pWaterTotem;
+        SpellEntry const* pManaTideTotem;
+        SpellEntry const* pWeaponBuff;
+    } shaman;
+    struct
+    {
+        SpellEntry const* pAspectOfTheCheetah;
+        SpellEntry const* pAspectOfTheMonkey;
+        SpellEntry const* pAspectOfTheHawk;
+        SpellEntry const* pSerpentSting;
+        SpellEntry const* pArcaneShot;
+        SpellEntry const* pAimedShot;
+        SpellEntry const* pMultiShot;
+        SpellEntry const* pConcussiveShot;
+        SpellEntry const* pWingClip;
+        SpellEntry const* pHuntersMark;
+        SpellEntry const* pMongooseBite;
+        SpellEntry const* pRaptorStrike;
+        SpellEntry const* pDisengage;
+        SpellEntry const* pFeignDeath;
+        SpellEntry const* pScareBeast;
+        SpellEntry const* pVolley;
+    } hunter;
+    struct
+    {
+        SpellEntry const* pIceArmor;
+        SpellEntry const* pArcaneIntellect;
+        SpellEntry const* pArcaneBrilliance;
+        SpellEntry const* pIceBarrier;
+        SpellEntry const* pManaShield;
+        SpellEntry const* pPolymorph;
+        SpellEntry const* pFrostbolt;
+        SpellEntry const* pFireBlast;
+        SpellEntry const* pFireball;
+        SpellEntry const* pArcaneExplosion;
+        SpellEntry const* pFrostNova;
+        SpellEntry const* pConeofCold;
+        SpellEntry const* pBlink;
+        SpellEntry const* pCounterspell;
+        SpellEntry const* pPresenceOfMind;
+        SpellEntry const* pArcanePower;
+        SpellEntry const* pRemoveLesserCurse;
+        SpellEntry const* pScorch;
+        SpellEntry const* pPyroblast;
+        SpellEntry const* pEvocation;
+        SpellEntry const* pIceBlock;
+        SpellEntry const* pBlizzard;
+        SpellEntry const* pBlastWave;
+        SpellEntry const* pCombustion;
+    } mage;
+    struct
+    {
+        SpellEntry const* pPowerWordFortitude;
+        SpellEntry const* pDivineSpirit;
+        SpellEntry const* pPrayerofSpirit;
+        SpellEntry const* pPrayerofFortitude;
+        SpellEntry const* pPrayerofShadowProtection;
+        SpellEntry const* pInnerFire;
+        SpellEntry const* pShadowProtection;
+        SpellEntry const* pPowerWordShield;
+        SpellEntry const* pHolyNova;
+        SpellEntry const* pHolyFire;
+        SpellEntry const* pMindBlast;
+        SpellEntry const* pMindFlay;
+        SpellEntry const* pShadowWordPain;
+        SpellEntry const* pInnerFocus;
+        SpellEntry const* pAbolishDisease;
+        SpellEntry const* pDispelMagic;
+        SpellEntry const* pManaBurn;
+        SpellEntry const* pDevouringPlague;
+        SpellEntry const* pPsychicScream;
+        SpellEntry const* pShadowform;
+        SpellEntry const* pVampiricEmbrace;
+        SpellEntry const* pSilence;
+        SpellEntry const* pFade;
+        SpellEntry const* pShackleUndead;
+        SpellEntry const* pSmite;
+    } priest;
+    struct
+    {
+        SpellEntry const* pDemonArmor;
+        SpellEntry const* pDeathCoil;
+        SpellEntry const* pDetectInvisibility;
+        SpellEntry const* pShadowWard;
+        SpellEntry const* pShadowBolt;
+        SpellEntry const* pCorruption;
+        SpellEntry const* pConflagrate;
+        SpellEntry const* pShadowburn;
+        SpellEntry const* pSearingPain;
+        SpellEntry const* pImmolate;
+        SpellEntry const* pRainOfFire;
+        SpellEntry const* pDemonicSacrifice;
+        SpellEntry const* pDrainLife;
+        SpellEntry const* pSiphonLife;
+        SpellEntry const* pBanish;
+        SpellEntry const* pFear;
+        SpellEntry const* pHowlofTerror;
+        SpellEntry const* pCurseofAgony;
+        SpellEntry const* pCurseofDoom;
+        SpellEntry const* pCurseoftheElements;
+        SpellEntry const* pCurseofShadow;
+        SpellEntry const* pCurseofRecklessness;
+        SpellEntry const* pCurseofTongues;
+        SpellEntry const* pCurseofExhaustion;
+        SpellEntry const* pLifeTap;
+    } warlock;
+    struct
+    {
+        SpellEntry const* pBattleStance;
+        SpellEntry const* pBerserkerStance;
+        SpellEntry const* pDefensiveStance;
+        SpellEntry const* pCharge;
+        SpellEntry const* pIntercept;
+        SpellEntry const* pOverpower;
+        SpellEntry const* pHeroicStrike;
+        SpellEntry const* pCleave;
+        SpellEntry const* pExecute;
+        SpellEntry const* pMortalStrike;
+        SpellEntry const* pBloodthirst;
+        SpellEntry const* pBloodrage;
+        SpellEntry const* pBerserkerRage;
+        SpellEntry const* pRecklessness;
+        SpellEntry const* pRetaliation;
+        SpellEntry const* pDeathWish;
+        SpellEntry const* pIntimidatingShout;
+        SpellEntry const* pPummel;
+        SpellEntry const* pRend;
+        SpellEntry const* pDisarm;
+        SpellEntry const* pWhirlwind;
+        SpellEntry const* pBattleShout;
+        SpellEntry const* pDemoralizingShout;
+        SpellEntry const* pHamstring;
+        SpellEntry const* pThunderClap;
+        SpellEntry const* pSweepingStrikes;
+        SpellEntry const* pLastStand;
+        SpellEntry const* pShieldBlock;
+        SpellEntry const* pShieldWall;
+        SpellEntry const* pShieldBash;
+        SpellEntry const* pShieldSlam;
+        SpellEntry const* pSunderArmor;
+        SpellEntry const* pConcussionBlow;
+        SpellEntry const* pPiercingHowl;
+    } warrior;
+    struct
+    {
+        SpellEntry const* pSliceAndDice;
+        SpellEntry const* pSinisterStrike;
+        SpellEntry const* pAdrenalineRush;
+        SpellEntry const* pEviscerate;
+        SpellEntry const* pStealth;
+        SpellEntry const* pGarrote;
+        SpellEntry const* pAmbush;
+        SpellEntry const* pCheapShot;
+        SpellEntry const* pPremeditation;
+        SpellEntry const* pBackstab;
+        SpellEntry const* pHemorrhage;
+        SpellEntry const* pGhostlyStrike;
+        SpellEntry const* pGouge;
+        SpellEntry const* pRupture;
+        SpellEntry const* pExposeArmor;
+        SpellEntry const* pKidneyShot;
+        SpellEntry const* pColdBlood;
+        SpellEntry const* pBladeFlurry;
+        SpellEntry const* pVanish;
+        SpellEntry const* pBlind;
+        SpellEntry const* pPreparation;
+        SpellEntry const* pEvasion;
+        SpellEntry const* pRiposte;
+        SpellEntry const* pKick;
+        SpellEntry const* pSprint;
+        SpellEntry const* pMainHandPoison;
+        SpellEntry const* pOffHandPoison;
+    } rogue;
+    struct
+    {
+        SpellEntry const* pBearForm;
+        SpellEntry const* pCatForm;
+        SpellEntry const* pTravelForm;
+        SpellEntry const* pAquaticForm;
+        SpellEntry const* pMoonkinForm;
+        SpellEntry const* pWrath;
+        SpellEntry const* pMoonfire;
+        SpellEntry const* pStarfire;
+        SpellEntry const* pHurricane;
+        SpellEntry const* pInsectSwarm;
+        SpellEntry const* pBarkskin;
+        SpellEntry const* pNaturesGrasp;
+        SpellEntry const* pMarkoftheWild;
+        SpellEntry const* pGiftoftheWild;
+        SpellEntry const* pThorns;
+        SpellEntry const* pRemoveCurse;
+        SpellEntry const* pCurePoison;
+        SpellEntry const* pAbolishPoison;
+        SpellEntry const* pRebirth;
+        SpellEntry const* pFaerieFire;
+        SpellEntry const* pInnervate;
+        SpellEntry const* pNaturesSwiftness;
+        SpellEntry const* pEntanglingRoots;
+        SpellEntry const* pHibernate;
+        // Cat
+        SpellEntry const* pProwl;
+        SpellEntry const* pPounce;
+        SpellEntry const* pRavage;
+        SpellEntry const* pClaw;
+        SpellEntry const* pShred;
+        SpellEntry const* pRake;
+        SpellEntry const* pRip;
+        SpellEntry const* pFerociousBite;
+        SpellEntry const* pTigersFury;
+        SpellEntry const* pDash;
+        SpellEntry const* pFaerieFireFeral;
+        SpellEntry const* pCower;
+        // Bear
+        SpellEntry const* pGrowl;
+        SpellEntry const* pChallengingRoar;
+        SpellEntry const* pDemoralizingRoar;
+        SpellEntry const* pEnrage;
+        SpellEntry const* pFrenziedRegeneration;
+        SpellEntry const* pSwipe;
+        SpellEntry const* pMaul;
+        SpellEntry const* pBash;
+        SpellEntry const* pFeralCharge;
+    } druid;
+};
+
+// Spells of one class and spell list, sorted into the CombatBotBaseAI slots.
+// Immutable and shared by all bots knowing the same spells, see BotSpellTable.
+struct CombatBotSpellSet
+{
+    CombatBotSpellSet()
+    {
+        for (auto& ptr : spells.raw.spells)
+            ptr = nullptr;
+    }
+
+    CombatBotSpellSlots spells;
+
+    // Candidates for the slots that are picked per bot, by role or at random
+    // Paladin Seals
+    SpellEntry const* pSealOfRighteousness = nullptr;
+    SpellEntry const* pSealOfCommand = nullptr;
+    SpellEntry const* pSealOfFury = nullptr;
+
+    // Paladin Blessings
+    SpellEntry const* pBlessingOfLight = nullptr;
+    SpellEntry const* pBlessingOfMight = nullptr;
+    SpellEntry const* pBlessingOfWisdom = nullptr;
+    SpellEntry const* pBlessingOfKings = nullptr;
+    SpellEntry const* pBlessingOfSanctuary = nullptr;
+
+    // Paladin Auras
+    SpellEntry const* pDevotionAura = nullptr;
+    SpellEntry const* pConcentrationAura = nullptr;
+    SpellEntry const* pRetributionAura = nullptr;
+    SpellEntry const* pSanctityAura = nullptr;
+    SpellEntry const* pShadowResistanceAura = nullptr;
+    SpellEntry const* pFrostResistanceAura = nullptr;
+    SpellEntry const* pFireResistanceAura = nullptr;
+
+    // Air Totems
+    SpellEntry const* pGraceOfAirTotem = nullptr;
+    SpellEntry const* pNatureResistanceTotem = nullptr;
+    SpellEntry const* pWindfuryTotem = nullptr;
+    SpellEntry const* pWindwallTotem = nullptr;
+    SpellEntry const* pTranquilAirTotem = nullptr;
+
+    // Earth Totems
+    SpellEntry const* pEarthbindTotem = nullptr;
+    SpellEntry const* pStoneclawtotem = nullptr;
+    SpellEntry const* pStoneskinTotem = nullptr;
+    SpellEntry const* pStrengthOfEarthTotem = nullptr;
+    SpellEntry const* pTremorTotem = nullptr;
+
+    // Fire Totems
+    SpellEntry const* pFireNovaTotem = nullptr;
+    SpellEntry const* pMagmaTotem = nullptr;
+    SpellEntry const* pSearingTotem = nullptr;
+    SpellEntry const* pFlametongueTotem = nullptr;
+    SpellEntry const* pFrostResistanceTotem = nullptr;
+
+    // Water Totems
+    SpellEntry const* pFireResistanceTotem = nullptr;
+    SpellEntry const* pDiseaseCleansingTotem = nullptr;
+    SpellEntry const* pHealingStreamTotem = nullptr;
+    SpellEntry const* pManaSpringTotem = nullptr;
+    SpellEntry const* pPoisonCleansingTotem = nullptr;
+
+    // Shaman Weapon Buffs
+    SpellEntry const* pFrostbrandWeapon = nullptr;
+    SpellEntry const* pRockbiterWeapon = nullptr;
+    SpellEntry const* pWindfuryWeapon = nullptr;
+
+    // Mage Polymorph
+    SpellEntry const* pPolymorphSheep = nullptr;
+    SpellEntry const* pPolymorphCow = nullptr;
+    SpellEntry const* pPolymorphPig = nullptr;
+    SpellEntry const* pPolymorphTurtle = nullptr;
+
+    // Mage Frost Armor (to replace ice armor at low level)
+    SpellEntry const* pFrostArmor = nullptr;
+
+    bool hasDeadlyPoison = false;
+    bool hasInstantPoison = false;
+    bool hasCripplingPoison = false;
+    bool hasWoundPoison = false;
+    bool HasMindNumbingPoison = false;
+
+    SpellEntry const* pResurrectionSpell = nullptr;
+    std::vector<SpellEntry const*> spellListTaunt;
+    std::set<SpellEntry const*, HealAuraCompare> spellListPeriodicHeal;
+    std::set<SpellEntry const*, HealSpellCompare> spellListDirectHeal;
+};
+
 class CombatBotBaseAI : public PlayerBotAI
 {
 public:
@@ -82,6 +444,8 @@ public:
     }
 
     virtual void OnPacketReceived(WorldPacket const* packet) override;
+    virtual bool WantsPacket(uint16 opcode) const override;
+    virtual void OnEvent(BotEvent const& event) override;
     void SendBattlefieldPortPacket();
     void SendBattlemasterJoinPacket(uint8 battlegroundId);
     void SendAreaTriggerPacket(uint32 areaTriggerId);
@@ -89,6 +453,7 @@ public:
 
     void AutoAssignRole();
     void PopulateSpellData();
+    static void ClassifySpells(uint8 classId, std::vector<uint32> const& spellIds, CombatBotSpellSet& set);
     void ResetSpellData();
     void AddAllSpellReagents();
     void SummonPetIfNeeded();
@@ -109,6 +474,8 @@ public:
     bool IsValidHealTarget(Unit const* pTarget, float healthPercent = 100.0f) const;
     bool IsValidHostileTarget(Unit const* pTarget) const;
     bool IsValidDispelTarget(Unit const* pTarget, SpellEntry const* pSpellEntry) const;
+    // First candidate IsWithinLOSInMap would accept, checked in one batch
+    Unit* SelectFirstInLineOfSight(std::vector<Unit*> const& candidates) const;
     bool FindAndPreHealTarget();
     bool FindAndHealInjuredAlly(float selfHealPercent = 100.0f, float groupHealPercent = 100.0f);
     bool HealInjuredTarget(Unit* pTarget);
@@ -120,6 +487,7 @@ public:
     SpellEntry const* SelectMostEfficientHealingSpell(Unit const* pTarget, int32 missingHealth, std::set<SpellEntry const*, T>& spellList) const;
     int32 GetIncomingdamage(Unit const* pTarget) const;
     bool AreOthersOnSameTarget(ObjectGuid guid, bool checkMelee = true, bool checkSpells = true) const;
+    BotGroupStateView* GetGroupStateView() const;
 
     SpellCastResult DoCastSpell(Unit* pTarget, SpellEntry const* pSpellEntry);
     virtual bool CanTryToCastSpell(Unit const* pTarget, SpellEntry const* pSpellEntry) const;
@@ -281,276 +649,7 @@ public:
     std::vector<SpellEntry const*> m_spellListTaunt;
     std::set<SpellEntry const*, HealAuraCompare> m_spellListPeriodicHeal;
     std::set<SpellEntry const*, HealSpellCompare> m_spellListDirectHeal;
-    union
-    {
-        struct
-        {
-            SpellEntry const* spells[45];
-        } raw;
-        struct
-        {
-            SpellEntry const* pAura;
-            SpellEntry const* pSeal;
-            SpellEntry const* pBlessingBuff;
-            SpellEntry const* pBlessingOfProtection;
-            SpellEntry const* pBlessingOfFreedom;
-            SpellEntry const* pBlessingOfSacrifice;
-            SpellEntry const* pHammerOfJustice;
-            SpellEntry const* pJudgement;
-            SpellEntry const* pExorcism;
-            SpellEntry const* pConsecration;
-            SpellEntry const* pHammerOfWrath;
-            SpellEntry const* pCleanse;
-            SpellEntry const* pDivineShield;
-            SpellEntry const* pLayOnHands;
-            SpellEntry const* pRighteousFury;
-            SpellEntry const* pHolyShock;
-            SpellEntry const* pDivineFavor;
-            SpellEntry const* pHolyWrath;
-            SpellEntry const* pTurnEvil;
-            SpellEntry const* pHolyShield;
-        } paladin;
-        struct
-        {
-            SpellEntry const* pLightningBolt;
-            SpellEntry const* pChainLightning;
-            SpellEntry const* pEarthShock;
-            SpellEntry const* pFlameShock;
-            SpellEntry const* pFrostShock;
-            SpellEntry const* pPurge;
-            SpellEntry const* pStormstrike;
-            SpellEntry const* pElementalMastery;
-            SpellEntry const* pLightningShield;
-            SpellEntry const* pGhostWolf;
-            SpellEntry const* pCureDisease;
-            SpellEntry const* pCurePoison;
-            SpellEntry const* pAirTotem;
-            SpellEntry const* pEarthTotem;
-            SpellEntry const* pFireTotem;
-            SpellEntry const* pWaterTotem;
-            SpellEntry const* pManaTideTotem;
-            SpellEntry const* pWeaponBuff;
-        } shaman;
-        struct
-        {
-            SpellEntry const* pAspectOfTheCheetah;
-            SpellEntry const* pAspectOfTheMonkey;
-            SpellEntry const* pAspectOfTheHawk;
-            SpellEntry const* pSerpentSting;
-            SpellEntry const* pArcaneShot;
-            SpellEntry const* pAimedShot;
-            SpellEntry const* pMultiShot;
-            SpellEntry const* pConcussiveShot;
-            SpellEntry const* pWingClip;
-            SpellEntry const* pHuntersMark;
-            SpellEntry const* pMongooseBite;
-            SpellEntry const* pRaptorStrike;
-            SpellEntry const* pDisengage;
-            SpellEntry const* pFeignDeath;
-            SpellEntry const* pScareBeast;
-            SpellEntry const* pVolley;
-        } hunter;
-        struct
-        {
-            SpellEntry const* pIceArmor;
-            SpellEntry const* pArcaneIntellect;
-            SpellEntry const* pArcaneBrilliance;
-            SpellEntry const* pIceBarrier;
-            SpellEntry const* pManaShield;
-            SpellEntry const* pPolymorph;
-            SpellEntry const* pFrostbolt;
-            SpellEntry const* pFireBlast;
-            SpellEntry const* pFireball;
-            SpellEntry const* pArcaneExplosion;
-            SpellEntry const* pFrostNova;
-            SpellEntry const* pConeofCold;
-            SpellEntry const* pBlink;
-            SpellEntry const* pCounterspell;
-            SpellEntry const* pPresenceOfMind;
-            SpellEntry const* pArcanePower;
-            SpellEntry const* pRemoveLesserCurse;
-            SpellEntry const* pScorch;
-            SpellEntry const* pPyroblast;
-            SpellEntry const* pEvocation;
-            SpellEntry const* pIceBlock;
-            SpellEntry const* pBlizzard;
-            SpellEntry const* pBlastWave;
-            SpellEntry const* pCombustion;
-        } mage;
-        struct
-        {
-            SpellEntry const* pPowerWordFortitude;
-            SpellEntry const* pDivineSpirit;
-            SpellEntry const* pPrayerofSpirit;
-            SpellEntry const* pPrayerofFortitude;
-            SpellEntry const* pPrayerofShadowProtection;
-            SpellEntry const* pInnerFire;
-            SpellEntry const* pShadowProtection;
-            SpellEntry const* pPowerWordShield;
-            SpellEntry const* pHolyNova;
-            SpellEntry const* pHolyFire;
-            SpellEntry const* pMindBlast;
-            SpellEntry const* pMindFlay;
-            SpellEntry const* pShadowWordPain;
-            SpellEntry const* pInnerFocus;
-            SpellEntry const* pAbolishDisease;
-            SpellEntry const* pDispelMagic;
-            SpellEntry const* pManaBurn;
-            SpellEntry const* pDevouringPlague;
-            SpellEntry const* pPsychicScream;
-            SpellEntry const* pShadowform;
-            SpellEntry const* pVampiricEmbrace;
-            SpellEntry const* pSilence;
-            SpellEntry const* pFade;
-            SpellEntry const* pShackleUndead;
-            SpellEntry const* pSmite;
-        } priest;
-        struct
-        {
-            SpellEntry const* pDemonArmor;
-            SpellEntry const* pDeathCoil;
-            SpellEntry const* pDetectInvisibility;
-            SpellEntry const* pShadowWard;
-            SpellEntry const* pShadowBolt;
-            SpellEntry const* pCorruption;
-            SpellEntry const* pConflagrate;
-            SpellEntry const* pShadowburn;
-            SpellEntry const* pSearingPain;
-            SpellEntry const* pImmolate;
-            SpellEntry const* pRainOfFire;
-            SpellEntry const* pDemonicSacrifice;
-            SpellEntry const* pDrainLife;
-            SpellEntry const* pSiphonLife;
-            SpellEntry const* pBanish;
-            SpellEntry const* pFear;
-            SpellEntry const* pHowlofTerror;
-            SpellEntry const* pCurseofAgony;
-            SpellEntry const* pCurseofDoom;
-            SpellEntry const* pCurseoftheElements;
-            SpellEntry const* pCurseofShadow;
-            SpellEntry const* pCurseofRecklessness;
-            SpellEntry const* pCurseofTongues;
-            SpellEntry const* pCurseofExhaustion;
-            SpellEntry const* pLifeTap;
-        } warlock;
-        struct
-        {
-            SpellEntry const* pBattleStance;
-            SpellEntry const* pBerserkerStance;
-            SpellEntry const* pDefensiveStance;
-            SpellEntry const* pCharge;
-            SpellEntry const* pIntercept;
-            SpellEntry const* pOverpower;
-            SpellEntry const* pHeroicStrike;
-            SpellEntry const* pCleave;
-            SpellEntry const* pExecute;
-            SpellEntry const* pMortalStrike;
-            SpellEntry const* pBloodthirst;
-            SpellEntry const* pBloodrage;
-            SpellEntry const* pBerserkerRage;
-            SpellEntry const* pRecklessness;
-            SpellEntry const* pRetaliation;
-            SpellEntry const* pDeathWish;
-            SpellEntry const* pIntimidatingShout;
-            SpellEntry const* pPummel;
-            SpellEntry const* pRend;
-            SpellEntry const* pDisarm;
-            SpellEntry const* pWhirlwind;
-            SpellEntry const* pBattleShout;
-            SpellEntry const* pDemoralizingShout;
-            SpellEntry const* pHamstring;
-            SpellEntry const* pThunderClap;
-            SpellEntry const* pSweepingStrikes;
-            SpellEntry const* pLastStand;
-            SpellEntry const* pShieldBlock;
-            SpellEntry const* pShieldWall;
-            SpellEntry const* pShieldBash;
-            SpellEntry const* pShieldSlam;
-            SpellEntry const* pSunderArmor;
-            SpellEntry const* pConcussionBlow;
-            SpellEntry const* pPiercingHowl;
-        } warrior;
-        struct
-        {
-            SpellEntry const* pSliceAndDice;
-            SpellEntry const* pSinisterStrike;
-            SpellEntry const* pAdrenalineRush;
-            SpellEntry const* pEviscerate;
-            SpellEntry const* pStealth;
-            SpellEntry const* pGarrote;
-            SpellEntry const* pAmbush;
-            SpellEntry const* pCheapShot;
-            SpellEntry const* pPremeditation;
-            SpellEntry const* pBackstab;
-            SpellEntry const* pHemorrhage;
-            SpellEntry const* pGhostlyStrike;
-            SpellEntry const* pGouge;
-            SpellEntry const* pRupture;
-            SpellEntry const* pExposeArmor;
-            SpellEntry const* pKidneyShot;
-            SpellEntry const* pColdBlood;
-            SpellEntry const* pBladeFlurry;
-            SpellEntry const* pVanish;
-            SpellEntry const* pBlind;
-            SpellEntry const* pPreparation;
-            SpellEntry const* pEvasion;
-            SpellEntry const* pRiposte;
-            SpellEntry const* pKick;
-            SpellEntry const* pSprint;
-            SpellEntry const* pMainHandPoison;
-            SpellEntry const* pOffHandPoison;
-        } rogue;
-        struct
-        {
-            SpellEntry const* pBearForm;
-            SpellEntry const* pCatForm;
-            SpellEntry const* pTravelForm;
-            SpellEntry const* pAquaticForm;
-            SpellEntry const* pMoonkinForm;
-            SpellEntry const* pWrath;
-            SpellEntry const* pMoonfire;
-            SpellEntry const* pStarfire;
-            SpellEntry const* pHurricane;
-            SpellEntry const* pInsectSwarm;
-            SpellEntry const* pBarkskin;
-            SpellEntry const* pNaturesGrasp;
-            SpellEntry const* pMarkoftheWild;
-            SpellEntry const* pGiftoftheWild;
-            SpellEntry const* pThorns;
-            SpellEntry const* pRemoveCurse;
-            SpellEntry const* pCurePoison;
-            SpellEntry const* pAbolishPoison;
-            SpellEntry const* pRebirth;
-            SpellEntry const* pFaerieFire;
-            SpellEntry const* pInnervate;
-            SpellEntry const* pNaturesSwiftness;
-            SpellEntry const* pEntanglingRoots;
-            SpellEntry const* pHibernate;
-            // Cat
-            SpellEntry const* pProwl;
-            SpellEntry const* pPounce;
-            SpellEntry const* pRavage;
-            SpellEntry const* pClaw;
-            SpellEntry const* pShred;
-            SpellEntry const* pRake;
-            SpellEntry const* pRip;
-            SpellEntry const* pFerociousBite;
-            SpellEntry const* pTigersFury;
-            SpellEntry const* pDash;
-            SpellEntry const* pFaerieFireFeral;
-            SpellEntry const* pCower;
-            // Bear
-            SpellEntry const* pGrowl;
-            SpellEntry const* pChallengingRoar;
-            SpellEntry const* pDemoralizingRoar;
-            SpellEntry const* pEnrage;
-            SpellEntry const* pFrenziedRegeneration;
-            SpellEntry const* pSwipe;
-            SpellEntry const* pMaul;
-            SpellEntry const* pBash;
-            SpellEntry const* pFeralCharge;
-        } druid;
-    } m_spells;
+    CombatBotSpellSlots m_spells;
 
     bool m_initialized = false;
     bool m_isBuffing = false;
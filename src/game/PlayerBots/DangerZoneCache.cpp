@@ -11,29 +11,82 @@
 #include "Policies/SingletonImp.h"
 #include "Log.h"
 #include "World.h"
+#include <algorithm>
 #include <cmath>
+#include <functional>
+#include <thread>
 
 INSTANTIATE_SINGLETON_1(DangerZoneCache);
 
 DangerZoneCache::DangerZoneCache()
-    : m_cleanupTimer(0)
+    : m_snapshots(std::make_shared<SnapshotSet const>())
+    , m_pendingReports(0)
+    , m_zoneCount(0)
+    , m_expiryCursor(WorldTimer::getMSTime() / DangerZoneConstants::EXPIRY_BUCKET_MS)
+    , m_publishTimer(0)
 {
 }
 
+// ============================================================================
+// Writers
+// ============================================================================
+
 void DangerZoneCache::ReportDanger(uint32 mapId, float x, float y, uint8 threatLevel)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
+#if !ENABLE_DANGER_ZONES
+    // Nothing would ever merge the reports
+    (void)mapId; (void)x; (void)y; (void)threatLevel;
+    return;
+#else
+    PendingReport report;
+    report.mapId = mapId;
+    report.x = x;
+    report.y = y;
+    report.threatLevel = threatLevel;
 
-    int32 cellX = GetCellX(x);
-    int32 cellY = GetCellY(y);
+    ReportShard& shard = m_reportShards[std::hash<std::thread::id>()(std::this_thread::get_id()) % DangerZoneConstants::REPORT_SHARDS];
+    {
+        std::lock_guard<std::mutex> lock(shard.lock);
+        shard.reports.push_back(report);
+    }
+    ++m_pendingReports;
+#endif
+}
+
+void DangerZoneCache::MergeReports()
+{
+    if (!m_pendingReports.load())
+        return;
+
+    std::vector<PendingReport> reports;
+    for (ReportShard& shard : m_reportShards)
+    {
+        std::lock_guard<std::mutex> lock(shard.lock);
+        if (shard.reports.empty())
+            continue;
+
+        m_pendingReports -= uint32(shard.reports.size());
+        reports.insert(reports.end(), shard.reports.begin(), shard.reports.end());
+        shard.reports.clear();
+    }
+
+    for (PendingReport const& report : reports)
+        AddZone(report);
+}
+
+void DangerZoneCache::AddZone(PendingReport const& report)
+{
+    int32 cellX = GetCellX(report.x);
+    int32 cellY = GetCellY(report.y);
+    uint64 cellKey = MakeCellKey(cellX, cellY);
 
     // Check if we already have a recent danger zone at this location
     // (avoid duplicate entries from same encounter)
-    auto& cell = m_grid[mapId][cellX][cellY];
+    auto& cell = m_master[report.mapId][cellKey];
     for (auto const& existing : cell)
     {
-        float dx = existing.x - x;
-        float dy = existing.y - y;
+        float dx = existing.x - report.x;
+        float dy = existing.y - report.y;
         float distSq = dx * dx + dy * dy;
 
         // If within 20 yards of existing zone, don't add duplicate
@@ -45,46 +98,220 @@ void DangerZoneCache::ReportDanger(uint32 mapId, float x, float y, uint8 threatL
 
     // Add new danger zone
     DangerZone zone;
-    zone.x = x;
-    zone.y = y;
-    zone.threatLevel = threatLevel;
+    zone.x = report.x;
+    zone.y = report.y;
+    zone.threatLevel = report.threatLevel;
     zone.expireTime = WorldTimer::getMSTime() + DangerZoneConstants::EXPIRE_TIME_MS;
 
     cell.push_back(zone);
+    ++m_zoneCount;
+    MarkDirty(report.mapId);
+
+    uint32 bucket = (zone.expireTime / DangerZoneConstants::EXPIRY_BUCKET_MS) % DangerZoneConstants::EXPIRY_BUCKET_COUNT;
+    m_expiryRing[bucket].push_back({ report.mapId, cellKey });
 
     sLog.Out(LOG_BASIC, LOG_LVL_BASIC,
         "[DangerZoneCache] Added danger zone at map %u (%.1f, %.1f) threat level %u",
-        mapId, x, y, threatLevel);
+        report.mapId, report.x, report.y, report.threatLevel);
 }
 
-bool DangerZoneCache::IsDangerous(uint32 mapId, float x, float y, uint8 botLevel) const
+void DangerZoneCache::ExpireZones(uint32 currentTime)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    uint32 nowBucket = currentTime / DangerZoneConstants::EXPIRY_BUCKET_MS;
 
-    int32 cellX = GetCellX(x);
-    int32 cellY = GetCellY(y);
+    // Fell behind by a whole lap: every bucket is due once
+    if (nowBucket - m_expiryCursor > DangerZoneConstants::EXPIRY_BUCKET_COUNT)
+        m_expiryCursor = nowBucket - DangerZoneConstants::EXPIRY_BUCKET_COUNT;
 
-    // Check this cell and 8 neighbors (danger zones can span cell boundaries)
-    for (int32 dx = -1; dx <= 1; ++dx)
+    uint32 removedCount = 0;
+
+    // Only fully elapsed buckets: everything in them has expired
+    for (; m_expiryCursor < nowBucket; ++m_expiryCursor)
     {
-        for (int32 dy = -1; dy <= 1; ++dy)
+        std::vector<ExpiryEntry>& entries = m_expiryRing[m_expiryCursor % DangerZoneConstants::EXPIRY_BUCKET_COUNT];
+
+        for (ExpiryEntry const& entry : entries)
         {
-            auto mapIt = m_grid.find(mapId);
-            if (mapIt == m_grid.end())
+            auto mapItr = m_master.find(entry.mapId);
+            if (mapItr == m_master.end())
                 continue;
 
-            auto rowIt = mapIt->second.find(cellX + dx);
-            if (rowIt == mapIt->second.end())
+            auto cellItr = mapItr->second.find(entry.cellKey);
+            if (cellItr == mapItr->second.end())
                 continue;
 
-            auto cellIt = rowIt->second.find(cellY + dy);
-            if (cellIt == rowIt->second.end())
+            auto& zones = cellItr->second;
+            size_t before = zones.size();
+            zones.erase(std::remove_if(zones.begin(), zones.end(),
+                [currentTime](DangerZone const& zone) { return currentTime >= zone.expireTime; }),
+                zones.end());
+
+            if (zones.size() == before)
                 continue;
 
-            uint32 currentTime = WorldTimer::getMSTime();
+            removedCount += uint32(before - zones.size());
+            m_zoneCount -= uint32(before - zones.size());
+            MarkDirty(entry.mapId);
+
+            if (zones.empty())
+                mapItr->second.erase(cellItr);
+            if (mapItr->second.empty())
+                m_master.erase(mapItr);
+        }
+
+        entries.clear();
+    }
+
+    if (removedCount > 0)
+    {
+        sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
+            "[DangerZoneCache] Cleanup: removed %u expired zones, %u remaining",
+            removedCount, GetTotalZoneCount());
+    }
+}
+
+void DangerZoneCache::MarkDirty(uint32 mapId)
+{
+    if (std::find(m_dirtyMaps.begin(), m_dirtyMaps.end(), mapId) == m_dirtyMaps.end())
+        m_dirtyMaps.push_back(mapId);
+}
+
+void DangerZoneCache::Update(uint32 diff)
+{
+#if !ENABLE_DANGER_ZONES
+    // Feature disabled - no-op to avoid wasted CPU cycles
+    (void)diff;
+    return;
+#else
+    MergeReports();
+    ExpireZones(WorldTimer::getMSTime());
+
+    m_publishTimer += diff;
+    if (m_publishTimer < DangerZoneConstants::PUBLISH_INTERVAL_MS)
+        return;
+
+    m_publishTimer = 0;
+    PublishSnapshots();
+#endif
+}
+
+// ============================================================================
+// Snapshots
+// ============================================================================
+
+void DangerZoneCache::PublishSnapshots()
+{
+    if (m_dirtyMaps.empty())
+        return;
+
+    // Copy-on-write: untouched maps keep sharing their snapshot
+    auto snapshots = std::make_shared<SnapshotSet>(*LoadSnapshots());
+
+    for (uint32 mapId : m_dirtyMaps)
+    {
+        auto mapItr = m_master.find(mapId);
+        if (mapItr == m_master.end())
+            snapshots->erase(mapId);
+        else
+            (*snapshots)[mapId] = BuildSnapshot(mapItr->second);
+    }
+    m_dirtyMaps.clear();
+
+    std::atomic_store(&m_snapshots, std::shared_ptr<SnapshotSet const>(std::move(snapshots)));
+}
+
+std::shared_ptr<DangerZoneCache::MapSnapshot const> DangerZoneCache::BuildSnapshot(CellMap const& cells)
+{
+    auto snapshot = std::make_shared<MapSnapshot>();
+    if (cells.empty())
+        return snapshot;
+
+    int32 minX = INT32_MAX, maxX = INT32_MIN;
+    int32 minY = INT32_MAX, maxY = INT32_MIN;
+    size_t zoneCount = 0;
+    for (auto const& cell : cells)
+    {
+        int32 cellX = int32(uint32(cell.first >> 32));
+        int32 cellY = int32(uint32(cell.first));
+        minX = std::min(minX, cellX);
+        maxX = std::max(maxX, cellX);
+        minY = std::min(minY, cellY);
+        maxY = std::max(maxY, cellY);
+        zoneCount += cell.second.size();
+    }
+
+    snapshot->minCellX = minX;
+    snapshot->minCellY = minY;
+    snapshot->width = maxX - minX + 1;
+    snapshot->height = maxY - minY + 1;
+
+    // Count per cell, prefix-sum into offsets, then fill
+    uint32 numCells = uint32(snapshot->width) * uint32(snapshot->height);
+    snapshot->cellStart.assign(numCells + 1, 0);
+    for (auto const& cell : cells)
+    {
+        int32 cellX = int32(uint32(cell.first >> 32));
+        int32 cellY = int32(uint32(cell.first));
+        snapshot->cellStart[(cellX - minX) * snapshot->height + (cellY - minY) + 1] = uint32(cell.second.size());
+    }
+    for (uint32 i = 1; i <= numCells; ++i)
+        snapshot->cellStart[i] += snapshot->cellStart[i - 1];
+
+    snapshot->zones.resize(zoneCount);
+    for (auto const& cell : cells)
+    {
+        int32 cellX = int32(uint32(cell.first >> 32));
+        int32 cellY = int32(uint32(cell.first));
+        uint32 start = snapshot->cellStart[(cellX - minX) * snapshot->height + (cellY - minY)];
+        std::copy(cell.second.begin(), cell.second.end(), snapshot->zones.begin() + start);
+    }
+
+    return snapshot;
+}
+
+DangerZone const* DangerZoneCache::MapSnapshot::GetCell(int32 cellX, int32 cellY, uint32& count) const
+{
+    count = 0;
+    int32 ix = cellX - minCellX;
+    int32 iy = cellY - minCellY;
+    if (ix < 0 || iy < 0 || ix >= width || iy >= height)
+        return nullptr;
+
+    uint32 index = uint32(ix) * uint32(height) + uint32(iy);
+    count = cellStart[index + 1] - cellStart[index];
+    return count ? &zones[cellStart[index]] : nullptr;
+}
+
+// ============================================================================
+// Readers
+// ============================================================================
+
+bool DangerZoneCache::IsDangerous(uint32 mapId, float x, float y, uint8 botLevel) const
+{
+    std::shared_ptr<SnapshotSet const> snapshots = LoadSnapshots();
+
+    auto mapIt = snapshots->find(mapId);
+    if (mapIt == snapshots->end())
+        return false;
+
+    MapSnapshot const& snapshot = *mapIt->second;
+
+    int32 cellX = GetCellX(x);
+    int32 cellY = GetCellY(y);
+    uint32 currentTime = WorldTimer::getMSTime();
+
+    // Check this cell and 8 neighbors (danger zones can span cell boundaries)
+    for (int32 dx = -1; dx <= 1; ++dx)
+    {
+        for (int32 dy = -1; dy <= 1; ++dy)
+        {
+            uint32 count;
+            DangerZone const* zones = snapshot.GetCell(cellX + dx, cellY + dy, count);
 
-            for (auto const& zone : cellIt->second)
+            for (uint32 i = 0; i < count; ++i)
             {
+                DangerZone const& zone = zones[i];
+
                 // Skip expired zones (will be cleaned up later)
                 if (currentTime >= zone.expireTime)
                     continue;
@@ -112,37 +339,36 @@ bool DangerZoneCache::IsDangerous(uint32 mapId, float x, float y, uint8 botLevel
 void DangerZoneCache::GetNearbyDangers(uint32 mapId, float x, float y, float radius,
                                         std::vector<DangerZone>& out) const
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-
     out.clear();
 
-    // Calculate cell range to check
-    int32 minCellX = GetCellX(x - radius);
-    int32 maxCellX = GetCellX(x + radius);
-    int32 minCellY = GetCellY(y - radius);
-    int32 maxCellY = GetCellY(y + radius);
+    std::shared_ptr<SnapshotSet const> snapshots = LoadSnapshots();
 
-    auto mapIt = m_grid.find(mapId);
-    if (mapIt == m_grid.end())
+    auto mapIt = snapshots->find(mapId);
+    if (mapIt == snapshots->end())
         return;
 
+    MapSnapshot const& snapshot = *mapIt->second;
+
+    // Calculate cell range to check, clamped to the snapshot
+    int32 minCellX = std::max(GetCellX(x - radius), snapshot.minCellX);
+    int32 maxCellX = std::min(GetCellX(x + radius), snapshot.minCellX + snapshot.width - 1);
+    int32 minCellY = std::max(GetCellY(y - radius), snapshot.minCellY);
+    int32 maxCellY = std::min(GetCellY(y + radius), snapshot.minCellY + snapshot.height - 1);
+
     float radiusSq = radius * radius;
     uint32 currentTime = WorldTimer::getMSTime();
 
     for (int32 cx = minCellX; cx <= maxCellX; ++cx)
     {
-        auto rowIt = mapIt->second.find(cx);
-        if (rowIt == mapIt->second.end())
-            continue;
-
         for (int32 cy = minCellY; cy <= maxCellY; ++cy)
         {
-            auto cellIt = rowIt->second.find(cy);
-            if (cellIt == rowIt->second.end())
-                continue;
+            uint32 count;
+            DangerZone const* zones = snapshot.GetCell(cx, cy, count);
 
-            for (auto const& zone : cellIt->second)
+            for (uint32 i = 0; i < count; ++i)
             {
+                DangerZone const& zone = zones[i];
+
                 // Skip expired
                 if (currentTime >= zone.expireTime)
                     continue;
@@ -159,80 +385,13 @@ void DangerZoneCache::GetNearbyDangers(uint32 mapId, float x, float y, float rad
     }
 }
 
-void DangerZoneCache::Update(uint32 diff)
-{
-#if !ENABLE_DANGER_ZONES
-    // Feature disabled - no-op to avoid wasted CPU cycles
-    (void)diff;
-    return;
-#else
-    m_cleanupTimer += diff;
-
-    if (m_cleanupTimer < DangerZoneConstants::CLEANUP_INTERVAL_MS)
-        return;
-
-    m_cleanupTimer = 0;
-
-    std::lock_guard<std::mutex> lock(m_mutex);
-
-    uint32 currentTime = WorldTimer::getMSTime();
-    uint32 removedCount = 0;
-
-    // Iterate through all cells and remove expired zones
-    for (auto& mapPair : m_grid)
-    {
-        for (auto& rowPair : mapPair.second)
-        {
-            for (auto& cellPair : rowPair.second)
-            {
-                auto& zones = cellPair.second;
-
-                // Remove expired zones using erase-remove idiom
-                auto newEnd = std::remove_if(zones.begin(), zones.end(),
-                    [currentTime, &removedCount](DangerZone const& zone) {
-                        if (currentTime >= zone.expireTime)
-                        {
-                            ++removedCount;
-                            return true;
-                        }
-                        return false;
-                    });
-
-                zones.erase(newEnd, zones.end());
-            }
-        }
-    }
-
-    if (removedCount > 0)
-    {
-        sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
-            "[DangerZoneCache] Cleanup: removed %u expired zones, %u remaining",
-            removedCount, GetTotalZoneCount());
-    }
-#endif
-}
-
 uint32 DangerZoneCache::GetTotalZoneCount() const
 {
-    // Note: caller should hold lock if thread safety needed
-    // For debug/logging purposes, approximate count is fine
-    uint32 count = 0;
-
-    for (auto const& mapPair : m_grid)
-    {
-        for (auto const& rowPair : mapPair.second)
-        {
-            for (auto const& cellPair : rowPair.second)
-            {
-                count += cellPair.second.size();
-            }
-        }
-    }
-
-    return count;
+    // Merged zones only, reports still in the shards are not counted
+    return m_zoneCount.load();
 }
 
-bool DangerZoneCache::IsZoneDangerousForLevel(DangerZone const& zone, uint8 botLevel) const
+bool DangerZoneCache::IsZoneDangerousForLevel(DangerZone const& zone, uint8 botLevel)
 {
     // Zone is dangerous if the recorded threat level is 3+ levels above the bot
     return zone.threatLevel >= botLevel + DangerZoneConstants::LEVEL_DIFF_THRESHOLD;
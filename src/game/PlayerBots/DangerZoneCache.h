@@ -10,6 +10,15 @@
  * - All subsequent bots avoid the area
  * - Scales to 3000+ bots with O(1) lookups
  *
+ * Threading (lookups come from every continent map thread):
+ * - Readers use an immutable per-map dense grid snapshot, published by
+ *   swapping a shared_ptr (RCU-style). No lock is taken to read.
+ * - ReportDanger appends to one of several sharded buffers picked by
+ *   thread id. Update() merges them into the writer-owned master grid
+ *   and republishes the snapshots of the maps that changed.
+ * - Expiry walks a ring of time buckets, so only cells with zones
+ *   actually expiring are touched.
+ *
  * Part of the vMangos RandomBot AI Project.
  */
 
@@ -23,6 +32,9 @@
 
 #include "Common.h"
 #include "Policies/Singleton.h"
+#include <array>
+#include <atomic>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 #include <mutex>
@@ -41,8 +53,15 @@ namespace DangerZoneConstants
     // Level difference threshold - only record mobs 3+ levels above bot
     constexpr int32 LEVEL_DIFF_THRESHOLD = 3;
 
-    // Cleanup interval - how often to purge expired entries
-    constexpr uint32 CLEANUP_INTERVAL_MS = 60 * 1000;  // 1 minute
+    // Expiry ring - zones are expired in buckets of this width
+    constexpr uint32 EXPIRY_BUCKET_MS = 10 * 1000;     // 10 seconds
+    constexpr uint32 EXPIRY_BUCKET_COUNT = EXPIRE_TIME_MS / EXPIRY_BUCKET_MS + 1;
+
+    // How often merged reports are published to readers
+    constexpr uint32 PUBLISH_INTERVAL_MS = 1000;
+
+    // Report buffers (ReportDanger picks one by thread id)
+    constexpr uint32 REPORT_SHARDS = 16;
 
     // Detour distance - how far to route around danger zones
     constexpr float DETOUR_DISTANCE = 40.0f;
@@ -89,7 +108,8 @@ public:
                           std::vector<DangerZone>& out) const;
 
     /**
-     * Periodic cleanup of expired entries. Called from PlayerBotMgr::Update().
+     * Merge reported dangers, expire old ones and publish new snapshots.
+     * Called from PlayerBotMgr::Update() (world thread only).
      * @param diff      Time since last update in milliseconds
      */
     void Update(uint32 diff);
@@ -101,23 +121,73 @@ public:
 
 private:
     // Convert world coordinates to grid cell coordinates
-    int32 GetCellX(float x) const { return static_cast<int32>(std::floor(x / DangerZoneConstants::CELL_SIZE)); }
-    int32 GetCellY(float y) const { return static_cast<int32>(std::floor(y / DangerZoneConstants::CELL_SIZE)); }
-
-    // Spatial grid: mapId -> cellX -> cellY -> vector<DangerZone>
-    // Using nested unordered_maps for O(1) cell lookup
-    using CellMap = std::unordered_map<int32, std::vector<DangerZone>>;
-    using RowMap = std::unordered_map<int32, CellMap>;
-    using MapGrid = std::unordered_map<uint32, RowMap>;
-
-    MapGrid m_grid;
-    mutable std::mutex m_mutex;
-
-    // Cleanup timer
-    uint32 m_cleanupTimer = 0;
+    static int32 GetCellX(float x) { return static_cast<int32>(std::floor(x / DangerZoneConstants::CELL_SIZE)); }
+    static int32 GetCellY(float y) { return static_cast<int32>(std::floor(y / DangerZoneConstants::CELL_SIZE)); }
+    static uint64 MakeCellKey(int32 cellX, int32 cellY) { return (uint64(uint32(cellX)) << 32) | uint32(cellY); }
+
+    // Immutable dense grid over the bounding box of a map's zones.
+    // Zones of cell (x, y) are zones[cellStart[i]] .. zones[cellStart[i + 1] - 1]
+    // with i = (x - minCellX) * height + (y - minCellY).
+    struct MapSnapshot
+    {
+        int32 minCellX = 0;
+        int32 minCellY = 0;
+        int32 width = 0;
+        int32 height = 0;
+        std::vector<uint32> cellStart;
+        std::vector<DangerZone> zones;
+
+        // Zones of one cell, nullptr/0 outside the grid
+        DangerZone const* GetCell(int32 cellX, int32 cellY, uint32& count) const;
+    };
+    using SnapshotSet = std::unordered_map<uint32, std::shared_ptr<MapSnapshot const>>;
+
+    // Readers: std::atomic_load, writer: std::atomic_store
+    std::shared_ptr<SnapshotSet const> m_snapshots;
+    std::shared_ptr<SnapshotSet const> LoadSnapshots() const { return std::atomic_load(&m_snapshots); }
+
+    struct PendingReport
+    {
+        uint32 mapId;
+        float x;
+        float y;
+        uint8 threatLevel;
+    };
+
+    struct alignas(64) ReportShard
+    {
+        std::mutex lock;
+        std::vector<PendingReport> reports;
+    };
+    std::array<ReportShard, DangerZoneConstants::REPORT_SHARDS> m_reportShards;
+    std::atomic<uint32> m_pendingReports;
+
+    // Master grid, world thread only: mapId -> cell key -> zones
+    using CellMap = std::unordered_map<uint64, std::vector<DangerZone>>;
+    std::unordered_map<uint32, CellMap> m_master;
+    std::vector<uint32> m_dirtyMaps;
+    std::atomic<uint32> m_zoneCount;
+
+    // Expiry ring: cells to revisit when their bucket comes due
+    struct ExpiryEntry
+    {
+        uint32 mapId;
+        uint64 cellKey;
+    };
+    std::array<std::vector<ExpiryEntry>, DangerZoneConstants::EXPIRY_BUCKET_COUNT> m_expiryRing;
+    uint32 m_expiryCursor;              // next bucket time (ms / EXPIRY_BUCKET_MS) to process
+
+    uint32 m_publishTimer = 0;
+
+    void MergeReports();
+    void AddZone(PendingReport const& report);
+    void ExpireZones(uint32 currentTime);
+    void MarkDirty(uint32 mapId);
+    void PublishSnapshots();
+    static std::shared_ptr<MapSnapshot const> BuildSnapshot(CellMap const& cells);
 
     // Helper to check if a specific zone is dangerous for a bot level
-    bool IsZoneDangerousForLevel(DangerZone const& zone, uint8 botLevel) const;
+    static bool IsZoneDangerousForLevel(DangerZone const& zone, uint8 botLevel);
 };
 
 #define sDangerZoneCache MaNGOS::Singleton<DangerZoneCache>::Instance()
@@ -26,6 +26,7 @@
 #include "Spell.h"
 #include "SpellAuras.h"
 #include "Chat.h"
+#include "Utilities/BotGroupStateCache.h"
 #include <random>
 
 enum PartyBotSpells
@@ -147,22 +148,22 @@ Unit* PartyBotAI::GetDistancingTarget(Unit* pEnemy)
         if (IsValidDistancingTarget(pLeader, pEnemy))
             return pLeader;
 
+    BotGroupStateView const* pView = GetGroupStateView();
+    if (!pView)
+        return nullptr;
+
     Unit* pNonTank = nullptr;
-    Group* pGroup = me->GetGroup();
-    for (GroupReference* itr = pGroup->GetFirstMember(); itr != nullptr; itr = itr->next())
+    for (BotGroupMember const& member : pView->GetMembers())
     {
-        if (Player* pMember = itr->getSource())
-        {
-            if (pMember == me)
-                continue;
+        if (member.pPlayer == me)
+            continue;
 
-            if (IsValidDistancingTarget(pMember, pEnemy))
-            {
-                if (IsTankingForm(pMember->GetShapeshiftForm()) || IsWearingShield(pMember))
-                    return pMember;
-                else
-                    pNonTank = pMember;
-            }
+        if (IsValidDistancingTarget(member.pPlayer, pEnemy))
+        {
+            if (member.isTank)
+                return member.pPlayer;
+            else
+                pNonTank = member.pPlayer;
         }
     }
 
@@ -472,20 +473,23 @@ Player* PartyBotAI::SelectShieldTarget() const
     if (IsInDuel())
         return nullptr;
 
-    Group* pGroup = me->GetGroup();
-    for (GroupReference* itr = pGroup->GetFirstMember(); itr != nullptr; itr = itr->next())
+    BotGroupStateView const* pView = GetGroupStateView();
+    if (!pView)
+        return nullptr;
+
+    // Most injured first.
+    for (uint8 index : pView->GetByHealth())
     {
-        if (Player* pMember = itr->getSource())
-        {
-            // We already checked self.
-            if (pMember == me)
-                continue;
+        Player* pMember = pView->GetMembers()[index].pPlayer;
 
-            if ((pMember->GetHealthPercent() < 90.0f) &&
-                !pMember->GetAttackers().empty() &&
-                !pMember->IsImmuneToMechanic(MECHANIC_SHIELD))
-                return pMember;
-        }
+        // We already checked self.
+        if (pMember == me)
+            continue;
+
+        if ((pMember->GetHealthPercent() < 90.0f) &&
+            !pMember->GetAttackers().empty() &&
+            !pMember->IsImmuneToMechanic(MECHANIC_SHIELD))
+            return pMember;
     }
 
     return nullptr;
@@ -546,29 +550,28 @@ void PartyBotAI::AddToPlayerGroup()
     } 
 }
 
-void PartyBotAI::OnPacketReceived(WorldPacket const* packet)
+void PartyBotAI::OnEvent(BotEvent const& event)
 {
-    //printf("Bot received %s\n", LookupOpcodeName(packet->GetOpcode()));
-    switch (packet->GetOpcode())
+    switch (event.type)
     {
-        case SMSG_LEARNED_SPELL:
-        case SMSG_SUPERCEDED_SPELL:
-        case SMSG_REMOVED_SPELL:
+        case BOT_EVENT_SPELLS_CHANGED:
         {
             if (m_initialized)
                 m_resetSpellData = true;
             return;
         }
-        case SMSG_DUEL_REQUESTED:
+        case BOT_EVENT_DUEL_REQUESTED:
         {
             std::unique_ptr<WorldPacket> data = std::make_unique<WorldPacket>(CMSG_DUEL_ACCEPTED, 8);
             *data << me->GetObjectGuid();
             me->GetSession()->QueuePacket(std::move(data));
             return;
         }
+        default:
+            break;
     }
 
-    CombatBotBaseAI::OnPacketReceived(packet);
+    CombatBotBaseAI::OnEvent(event);
 }
 
 void PartyBotAI::OnPlayerLogin()
@@ -579,6 +582,8 @@ void PartyBotAI::OnPlayerLogin()
 
 void PartyBotAI::UpdateAI(uint32 const diff)
 {
+    ProcessEvents();
+
     m_updateTimer.Update(diff);
     if (m_updateTimer.Passed())
         m_updateTimer.Reset(PB_UPDATE_INTERVAL);
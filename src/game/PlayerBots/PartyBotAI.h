@@ -44,7 +44,7 @@ public:
     bool OnSessionLoaded(PlayerBotEntry* entry, WorldSession* sess) final;
     void OnPlayerLogin() final;
     void UpdateAI(uint32 const diff) final;
-    void OnPacketReceived(WorldPacket const* packet) final;
+    void OnEvent(BotEvent const& event) final;
 
     void CloneFromPlayer(Player const* pPlayer);
     void AddToPlayerGroup();
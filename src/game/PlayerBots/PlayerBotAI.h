@@ -19,6 +19,7 @@
 
 #include "PlayerAI.h"
 #include "WorldSession.h"
+#include "BotEvents.h"
 
 struct PlayerBotEntry;
 class WorldSession;
@@ -39,12 +40,18 @@ class PlayerBotAI: public PlayerAI
         virtual bool OnSessionLoaded(PlayerBotEntry* entry, WorldSession* sess);
         virtual void OnBotEntryLoad(PlayerBotEntry* entry) {}
         virtual void OnPacketReceived(WorldPacket const* /*packet*/) {} // server has sent a packet to this session
+        virtual bool WantsPacket(uint16 /*opcode*/) const { return false; } // opcodes delivered to headless sessions
+        void PostEvent(BotEvent const& event) { m_events.Post(event); } // game code, any thread
+        void ProcessEvents() { m_events.Drain([this](BotEvent const& event) { OnEvent(event); }); }
+        virtual void OnEvent(BotEvent const& /*event*/) {} // called from ProcessEvents in the bot's update
         void UpdateAI(uint32 const /*diff*/) override; // Handle delayed teleports
         virtual void OnPlayerLogin() {}
         virtual void BeforeAddToMap(Player* player) {} // me=nullptr at call
         // Helpers
         bool SpawnNewPlayer(WorldSession* sess, uint8 classId, uint32 raceId, uint32 mapId, uint32 instanceId, float dx, float dy, float dz, float o, Player* pClone = nullptr);
         PlayerBotEntry* botEntry;
+    private:
+        BotEventQueue m_events;
 };
 
 class PlayerCreatorAI: public PlayerBotAI
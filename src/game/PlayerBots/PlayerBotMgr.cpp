@@ -14,17 +14,23 @@
 #include "PartyBotAI.h"
 #include "BattleBotAI.h"
 #include "BattleBotWaypoints.h"
+#include "BattleBotGraph.h"
 #include "BattleGroundMgr.h"
 #include "MapManager.h"
 #include "Language.h"
 #include "Spell.h"
 #include "RandomBotGenerator.h"
 #include "RandomBotAI.h"
-#include "Strategies/VendoringStrategy.h"
-#include "Strategies/TravelingStrategy.h"
-#include "Strategies/TrainingStrategy.h"
 #include "Utilities/BotQuestCache.h"
+#include "Utilities/BotSpawnIndex.h"
+#include "Utilities/BotPOIIndex.h"
+#include "Utilities/BotTravelGraph.h"
+#include "Utilities/BotSpellTable.h"
+#include "Utilities/BotGearIndex.h"
 #include "DangerZoneCache.h"
+#include "BotLODScheduler.h"
+#include "BotProfiler.h"
+#include <algorithm>
 
 INSTANTIATE_SINGLETON_1(PlayerBotMgr);
 
@@ -40,14 +46,20 @@ PlayerBotMgr::PlayerBotMgr()
     m_confRandomBotsRefresh     = 60000;
     m_confUpdateDiff            = 10000;
     m_confEnableRandomBots      = false;
+    m_holdRandomBots            = false;
     m_confPurgeRandomBots       = false;
     m_confDebug                 = false;
+    m_confHeadlessSessions      = true;
+    m_confAllowSaving           = false;
+    m_confAsyncSave             = true;
+    m_confSaveInterval          = 30 * MINUTE * IN_MILLISECONDS;
     m_confBattleBotAutoJoin     = false;
 
     // Time
     m_elapsedTime = 0;
     m_lastBotsRefresh = 0;
     m_lastUpdate = 0;
+    m_lastProfileLog = 0;
     m_lastBattleBotQueueUpdate = 0;
 }
 
@@ -66,13 +78,25 @@ void PlayerBotMgr::LoadConfig()
     m_confDebugGrindSelection = sConfig.GetBoolDefault("RandomBot.DebugGrindSelection", false);
     m_confAllowSaving = sConfig.GetBoolDefault("PlayerBot.AllowSaving", false);
     m_confDebug = sConfig.GetBoolDefault("PlayerBot.Debug", false);
+    m_confHeadlessSessions = sConfig.GetBoolDefault("PlayerBot.HeadlessSessions", true);
+    m_confAsyncSave = sConfig.GetBoolDefault("PlayerBot.AsyncSave", true);
+    m_confSaveInterval = sConfig.GetIntDefault("PlayerBot.SaveInterval", 30 * MINUTE * IN_MILLISECONDS);
     m_confUpdateDiff = sConfig.GetIntDefault("PlayerBot.UpdateMs", 10000);
     m_confBattleBotAutoJoin = sConfig.GetBoolDefault("BattleBot.AutoJoin", false);
+    BotLODScheduler::LoadConfig();
+    BotProfiler::LoadConfig();
+    m_loginScheduler.LoadConfig();
 
     if (!sWorld.getConfig(CONFIG_BOOL_FORCE_LOGOUT_DELAY))
         m_tempBots.clear();
 }
 
+uint32 PlayerBotMgr::GetSaveInterval() const
+{
+    // 0 saves bots as often as players
+    return m_confSaveInterval ? m_confSaveInterval : sWorld.getConfig(CONFIG_UINT32_INTERVAL_SAVE);
+}
+
 void PlayerBotMgr::Load()
 {
     // 1- Clean
@@ -157,14 +181,19 @@ void PlayerBotMgr::Load()
     // immutable after this point. Do not move bot spawning before cache building.
     if (m_confEnableRandomBots && !m_bots.empty())
     {
-        VendoringStrategy::BuildVendorCache();
-        TravelingStrategy::BuildGrindSpotCache();
-        TrainingStrategy::BuildTrainerCache();
+        BotSpawnIndex::Build();     // Spawn lookups used by the caches below
+        BotPOIIndex::Build();       // Vendors, trainers and grind spots
+        BotTravelGraph::Build();    // Continent routes for long trips, uses the POIs
         BotQuestCache::BuildQuestGiverCache();
         BotQuestCache::BuildTurnInCache();
         BotQuestCache::BuildItemDropCache();
     }
 
+    // Party and battle bots use these too
+    BotSpellTable::Build();         // Poison ranks for rogue bots
+    BotGearIndex::Build();          // Random gear and ammo for auto-equip
+    BattleBotGraph::Build();        // Battleground routes
+
     // 6- Start initial bots (AFTER caches are built - see note above)
     if (m_confEnableRandomBots)
     {
@@ -191,6 +220,7 @@ void PlayerBotMgr::DeleteAll()
 {
     m_stats.onlineCount = 0;
     m_stats.loadingCount = 0;
+    m_loginScheduler.Clear();
 
     for (auto i = m_bots.begin(); i != m_bots.end(); i++)
     {
@@ -263,7 +293,35 @@ void PlayerBotMgr::Update(uint32 diff)
     // Update danger zone cache (cleanup expired entries)
     sDangerZoneCache.Update(diff);
 
+    // Staged logins run every tick, admission is rate limited per map
+    std::vector<PlayerBotEntry*> admitted;
+    std::vector<PlayerBotEntry*> failed;
+    m_loginScheduler.Update(diff, admitted, failed);
+    for (PlayerBotEntry* e : admitted)
+    {
+        OnBotLogin(e);
+        m_stats.loadingCount--;
+        m_stats.onlineCount++;
+    }
+    for (PlayerBotEntry* e : failed)
+    {
+        sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "PLAYERBOT: Unable to load session id %u", e->accountId);
+        DeleteBot(e->playerGUID);
+    }
+
     m_elapsedTime += diff;
+
+    if (BotProfiler::IsEnabled() && BotProfiler::GetLogInterval() &&
+        m_elapsedTime - m_lastProfileLog >= BotProfiler::GetLogInterval())
+    {
+        m_lastProfileLog = m_elapsedTime;
+
+        std::vector<std::string> lines;
+        BuildProfileReport(PROFILE_LOG_TOP_BOTS, lines);
+        for (std::string const& line : lines)
+            sLog.Out(LOG_PERFORMANCE, LOG_LVL_MINIMAL, "[BotProfiler] %s", line.c_str());
+    }
+
     if (!((m_elapsedTime - m_lastUpdate) > m_confUpdateDiff))
         return; // No need to update
     m_lastUpdate = m_elapsedTime;
@@ -298,8 +356,8 @@ void PlayerBotMgr::Update(uint32 diff)
             }
         }
 
-        // Connection of pending bots
-        if (iter->second->state != PB_STATE_LOADING)
+        // Connection of pending bots (scheduled ones are handled above)
+        if (iter->second->state != PB_STATE_LOADING || m_loginScheduler.IsQueued(iter->first))
         {
             ++iter;
             continue;
@@ -400,7 +458,7 @@ void PlayerBotMgr::Update(uint32 diff)
         }
     }
 
-    if (m_confEnableRandomBots)
+    if (m_confEnableRandomBots && !m_holdRandomBots)
     {
         uint32 updatesCount = (m_elapsedTime - m_lastBotsRefresh) / m_confRandomBotsRefresh;
         for (uint32 i = 0; i < updatesCount; ++i)
@@ -500,10 +558,15 @@ bool PlayerBotMgr::AddBot(uint32 playerGUID, bool chatBot, PlayerBotAI* pAI)
     e->state = PB_STATE_LOADING;
     WorldSession* session = new WorldSession(accountId, nullptr, sAccountMgr.GetSecurity(accountId), 0, LOCALE_enUS);
     session->SetBot(e);
+    session->SetHeadless(m_confHeadlessSessions);
     // Add directly to sessions map instead of queue to avoid race condition
     // where LoginPlayer's async callback can't find the session
     sWorld.AddSessionToSessionsMap(session);
     m_stats.loadingCount++;
+
+    // Bots loaded from the database log in through the scheduler
+    if (m_loginScheduler.IsEnabled() && !e->customBot && !e->isChatBot)
+        m_loginScheduler.Enqueue(e);
     if (chatBot)
         AddTempBot(accountId, 20000);
 
@@ -567,6 +630,20 @@ bool PlayerBotMgr::DeleteBot(std::map<uint64, std::shared_ptr<PlayerBotEntry>>::
     return true;
 }
 
+uint32 PlayerBotMgr::HoldRandomBots(uint32 count)
+{
+    m_holdRandomBots = true;
+
+    // Bounded, AddRandomBot can pick a bot that fails to log in
+    for (uint32 attempts = 0; attempts < count && m_stats.onlineCount + m_stats.loadingCount < count; ++attempts)
+    {
+        if (!AddRandomBot())
+            break;
+    }
+
+    return m_stats.onlineCount + m_stats.loadingCount;
+}
+
 bool PlayerBotMgr::DeleteRandomBot()
 {
     if (m_stats.onlineCount < 1)
@@ -693,6 +770,57 @@ bool PlayerBotMgr::IsChatBot(uint32 playerGuid)
     return iter != m_bots.end() && iter->second->isChatBot;
 }
 
+void PlayerBotMgr::BuildProfileReport(uint32 topBots, std::vector<std::string>& lines) const
+{
+    BotProfiler::BuildSectionReport(lines);
+    if (!topBots)
+        return;
+
+    struct BotCost
+    {
+        Player const* pBot;
+        uint64 ticks;
+        uint32 updates;
+    };
+
+    std::vector<BotCost> bots;
+    for (auto const& itr : m_bots)
+    {
+        if (itr.second->state != PB_STATE_ONLINE || !itr.second->ai || !itr.second->ai->me)
+            continue;
+
+        RandomBotAI const* pAI = dynamic_cast<RandomBotAI const*>(itr.second->ai.get());
+        if (!pAI)
+            continue;
+
+        BotProfileCounter const& counter = pAI->GetProfileCounter();
+        if (uint64 const ticks = counter.GetTicks())
+            bots.push_back({ pAI->me, ticks, counter.GetUpdates() });
+    }
+
+    if (bots.empty())
+        return;
+
+    uint32 const count = std::min<uint32>(topBots, bots.size());
+    std::partial_sort(bots.begin(), bots.begin() + count, bots.end(), [](BotCost const& a, BotCost const& b)
+    {
+        return a.ticks > b.ticks;
+    });
+
+    lines.push_back("Most expensive bots:");
+    for (uint32 i = 0; i < count; ++i)
+    {
+        BotCost const& bot = bots[i];
+        double const totalUs = BotProfiler::TicksToUs(bot.ticks);
+
+        char line[256];
+        snprintf(line, sizeof(line), "%2u. %-12s level %2u map %3u: %.1f ms over %u ticks, avg %.1fus",
+            i + 1, bot.pBot->GetName(), bot.pBot->GetLevel(), bot.pBot->GetMapId(),
+            totalUs / 1000.0, bot.updates, bot.updates ? totalUs / bot.updates : 0.0);
+        lines.push_back(line);
+    }
+}
+
 void PlayerBotMgr::AddAllBots()
 {
     for (auto it = m_bots.begin(); it != m_bots.end(); it++)
@@ -811,6 +939,42 @@ bool ChatHandler::HandleBotStartCommand(char * args)
     return true;
 }
 
+bool ChatHandler::HandleBotProfileCommand(char* args)
+{
+    if (ExtractLiteralArg(&args, "reset"))
+    {
+        BotProfiler::Reset();
+        SendSysMessage("Bot profile counters reset.");
+        return true;
+    }
+
+    bool const enable = ExtractLiteralArg(&args, "on") != nullptr;
+    if (enable || ExtractLiteralArg(&args, "off"))
+    {
+        BotProfiler::SetEnabled(enable);
+        PSendSysMessage("Bot profiling %s.", enable ? "enabled" : "disabled");
+        return true;
+    }
+
+    // Optional number of bots to list
+    uint32 topBots = 10;
+    if (*args && !ExtractUInt32(&args, topBots))
+    {
+        SendSysMessage("Usage: .bot profile [on|off|reset|#bots]");
+        SetSentErrorMessage(true);
+        return false;
+    }
+
+    std::vector<std::string> lines;
+    sPlayerBotMgr.BuildProfileReport(topBots, lines);
+    for (std::string const& line : lines)
+        SendSysMessage(line.c_str());
+
+    if (!BotProfiler::IsEnabled())
+        SendSysMessage("Profiling is off, turn it on with .bot profile on");
+    return true;
+}
+
 bool ChatHandler::HandleBotStatusCommand(char* args)
 {
     Player* target = GetSelectedPlayer();
@@ -885,8 +1049,8 @@ bool ChatHandler::HandleBotStatusCommand(char* args)
         target->GetPositionX(), target->GetPositionY(), target->GetPositionZ(),
         target->GetMapId());
 
-    PSendSysMessage("[State] Action: %s | Strategy: %s",
-        actionStr, status.activeStrategy.c_str());
+    PSendSysMessage("[State] Action: %s | Strategy: %s | LOD: %s",
+        actionStr, status.activeStrategy.c_str(), BotLODScheduler::GetTierName(status.lodTier));
 
     PSendSysMessage("Moving: %s | Casting: %s",
         status.isMoving ? "YES" : "NO",
@@ -2203,3 +2367,74 @@ bool ChatHandler::HandleBattleBotShowAllPathsCommand(char* args)
     PSendSysMessage("Showing %u paths for battleground.", id);
     return true;
 }
+
+bool ChatHandler::HandleBattleBotShowGraphCommand(char* args)
+{
+    Player* pPlayer = m_session->GetPlayer();
+    BattleGround* pBG = pPlayer->GetBattleGround();
+    if (!pBG)
+    {
+        SendSysMessage("You are not in a battleground.");
+        return false;
+    }
+
+    BattleBotGraph const* pGraph = nullptr;
+    switch (pBG->GetTypeID())
+    {
+        case BATTLEGROUND_AB:
+            pGraph = BattleBotGraph::ForPaths(vPaths_AB);
+            break;
+        case BATTLEGROUND_AV:
+            pGraph = BattleBotGraph::ForPaths(vPaths_AV);
+            break;
+        case BATTLEGROUND_WS:
+            pGraph = BattleBotGraph::ForPaths(vPaths_WS);
+            break;
+        default:
+            break;
+    }
+
+    if (!pGraph || !pGraph->GetNodeCount())
+    {
+        SendSysMessage("No waypoint graph for this battleground.");
+        return false;
+    }
+
+    // Show node id as level.
+    for (uint32 node = 0; node < pGraph->GetNodeCount(); ++node)
+    {
+        BattleBotGraphNode const& point = pGraph->GetNode(node);
+        if (Creature* pWaypoint = pPlayer->GetMap()->SummonCreature(VISUAL_WAYPOINT, point.x, point.y, point.z, 0.0f, TEMPSUMMON_TIMED_DESPAWN, 120000, true))
+            pWaypoint->SetUInt32Value(UNIT_FIELD_LEVEL, node);
+    }
+
+    PSendSysMessage("Showing %u nodes, graph has %u edges.", pGraph->GetNodeCount(), pGraph->GetEdgeCount());
+
+    // Optionally list the route from the nearest node to the given one.
+    uint32 goalNode;
+    if (!ExtractUInt32(&args, goalNode))
+        return true;
+
+    if (goalNode >= pGraph->GetNodeCount())
+    {
+        PSendSysMessage("Node %u does not exist.", goalNode);
+        return true;
+    }
+
+    uint32 node = pGraph->FindNearestNode(pPlayer->GetPositionX(), pPlayer->GetPositionY(), pPlayer->GetPositionZ());
+    if (pGraph->GetDistance(node, goalNode) == FLT_MAX)
+    {
+        PSendSysMessage("Node %u can not be reached from node %u.", goalNode, node);
+        return true;
+    }
+
+    PSendSysMessage("Route from node %u to node %u, %.1f yards:", node, goalNode, pGraph->GetDistance(node, goalNode));
+    while (node != goalNode)
+    {
+        BattleBotGraphEdge const& edge = pGraph->GetEdge(pGraph->GetNextEdge(node, goalNode));
+        PSendSysMessage("  %u -> %u, points %u to %u, %.1f yards", edge.fromNode, edge.toNode, edge.fromPoint, edge.toPoint, edge.length);
+        node = edge.toNode;
+    }
+
+    return true;
+}
@@ -6,6 +6,7 @@
 #include "Database/DatabaseEnv.h"
 #include "PlayerBotAI.h"
 #include "BattleGroundDefines.h"
+#include "BotLoginScheduler.h"
 
 #include <vector>
 #include <memory>
@@ -86,6 +87,9 @@ class PlayerBotMgr
 
         bool AddRandomBot();
         bool DeleteRandomBot();
+        // Log in random bots until count are online or loading, and stop the
+        // periodic add/remove so the population stays fixed (benchmarks)
+        uint32 HoldRandomBots(uint32 count);
 
         void AddBattleBot(BattleGroundQueueTypeId queueType, Team botTeam, uint32 botLevel, bool temporary);
         void DeleteBattleBots();
@@ -103,10 +107,15 @@ class PlayerBotMgr
         bool IsPermanentBot(uint32 playerGuid);
         bool IsChatBot(uint32 playerGuid);
         bool IsSavingAllowed() { return m_confAllowSaving; }
+        bool IsAsyncSaveEnabled() const { return m_confAsyncSave; }
+        uint32 GetSaveInterval() const;
         bool IsDebugGrindSelectionEnabled() const { return m_confDebugGrindSelection; }
 
         uint32 GenBotAccountId() { return ++m_maxAccountId; }
         PlayerBotStats& GetStats(){ return m_stats; }
+
+        // BotProfiler sections, then the random bots with the costliest AI ticks
+        void BuildProfileReport(uint32 topBots, std::vector<std::string>& lines) const;
         void Start() { m_confEnableRandomBots = true; }
 
     protected:
@@ -114,6 +123,7 @@ class PlayerBotMgr
         uint32 m_elapsedTime;
         uint32 m_lastBotsRefresh;
         uint32 m_lastUpdate;
+        uint32 m_lastProfileLog;
         uint32 m_totalChance;
         uint32 m_maxAccountId;
         time_t m_lastBattleBotQueueUpdate;
@@ -121,17 +131,25 @@ class PlayerBotMgr
         std::map<uint64 /*pl guid*/, std::shared_ptr<PlayerBotEntry>> m_bots;
         std::map<uint32 /*account*/, uint32> m_tempBots;
         PlayerBotStats m_stats;
+        BotLoginScheduler m_loginScheduler;
 
         uint32 m_confMinRandomBots;
         uint32 m_confMaxRandomBots;
         uint32 m_confRandomBotsRefresh;
         uint32 m_confUpdateDiff;
         bool m_confAllowSaving;
+        bool m_confAsyncSave;
+        uint32 m_confSaveInterval;
         bool m_confDebug;
+        bool m_confHeadlessSessions;
         bool m_confEnableRandomBots;
+        bool m_holdRandomBots;
         bool m_confPurgeRandomBots;
         bool m_confBattleBotAutoJoin;
         bool m_confDebugGrindSelection;
+
+        // Bots listed in each LOG_PERFORMANCE profile summary
+        static constexpr uint32 PROFILE_LOG_TOP_BOTS = 10;
 };
 
 #define sPlayerBotMgr MaNGOS::Singleton<PlayerBotMgr>::Instance()
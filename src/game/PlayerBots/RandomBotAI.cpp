@@ -19,6 +19,7 @@
 #include "Strategies/TravelingStrategy.h"
 #include "Strategies/TrainingStrategy.h"
 #include "DangerZoneCache.h"
+#include "BotLODScheduler.h"
 #include "Player.h"
 #include "Creature.h"
 #include "Corpse.h"
@@ -31,11 +32,10 @@
 #include "SpellAuras.h"
 #include "MotionMaster.h"
 #include "Log.h"
+#include "Formulas.h"
 #include "Config/Config.h"
 #include <cmath>
 
-#define RB_UPDATE_INTERVAL 1000
-
 // ============================================================================
 // Constructor / Destructor
 // ============================================================================
@@ -47,7 +47,7 @@ RandomBotAI::RandomBotAI()
     , m_trainingStrategy(std::make_unique<TrainingStrategy>())
     , m_combatMgr(std::make_unique<BotCombatMgr>())
 {
-    m_updateTimer.Reset(1000);
+    m_updateTimer.Reset(RB_UPDATE_INTERVAL);
 
     // Weighted activity assignment — configurable via mangosd.conf
     // RandomBot.QuestingPercent = 0-100, default 70 (70% questing, 30% grinding)
@@ -117,6 +117,7 @@ BotStatusInfo RandomBotAI::GetStatusInfo() const
     info.targetZ = 0;
     info.isMoving = me ? me->IsMoving() : false;
     info.isCasting = me ? me->IsNonMeleeSpellCasted() : false;
+    info.lodTier = m_lodTier;
 
     // Determine current action
     if (!me || !me->IsAlive())
@@ -207,13 +208,21 @@ void RandomBotAI::MovementInform(uint32 movementType, uint32 data)
 
 void RandomBotAI::UpdateAI(uint32 const diff)
 {
+    ProcessEvents();
+
+    // Pick tick rate from distance to real players (before throttling,
+    // so a slow-ticking bot speeds up as soon as someone approaches)
+    UpdateLODTier(diff);
+
     // Throttle updates
     m_updateTimer.Update(diff);
     if (m_updateTimer.Passed())
-        m_updateTimer.Reset(RB_UPDATE_INTERVAL);
+        m_updateTimer.Reset(m_tickInterval);
     else
         return;
 
+    BotProfileScope profile(BOT_PROFILE_UPDATE_AI, &m_profile);
+
     if (!me->IsInWorld() || me->IsBeingTeleported())
         return;
 
@@ -282,6 +291,8 @@ void RandomBotAI::UpdateAI(uint32 const diff)
     }
 
     // Long-term stuck detection - if bot hasn't moved 2+ yards in 5 minutes, teleport home
+    // Virtual bots stand still on purpose, so they are exempt
+    if (m_lodTier != BotLODTier::VIRTUAL)
     {
         uint32 currentTime = WorldTimer::getMSTime();
         float dx = me->GetPositionX() - m_lastProgressX;
@@ -407,10 +418,17 @@ void RandomBotAI::UpdateAI(uint32 const diff)
         return;
     }
 
+    // Nobody can see this bot - advance it coarsely instead of simulating it
+    if (m_lodTier == BotLODTier::VIRTUAL)
+    {
+        UpdateVirtualProgression();
+        return;
+    }
+
     // Update movement manager (stuck detection, state tracking)
-    // Note: Uses RB_UPDATE_INTERVAL as diff since we throttle updates
+    // Note: Uses the tick interval as diff since we throttle updates
     if (m_movementMgr)
-        m_movementMgr->Update(RB_UPDATE_INTERVAL);
+        m_movementMgr->Update(m_tickInterval);
 
     // Level-up detection: trigger training on even levels (2, 4, 6, 8, etc.)
     if (me->GetLevel() != m_lastKnownLevel)
@@ -428,7 +446,7 @@ void RandomBotAI::UpdateAI(uint32 const diff)
     // Dead? Use ghost walking strategy
     if (!me->IsAlive())
     {
-        m_ghostStrategy->Update(me, RB_UPDATE_INTERVAL);
+        m_ghostStrategy->Update(me, m_tickInterval);
         return;
     }
 
@@ -474,12 +492,117 @@ void RandomBotAI::ResetBehaviors()
     m_isResting = false;
 }
 
+// ============================================================================
+// Level-of-Detail Scheduling
+// ============================================================================
+
+void RandomBotAI::UpdateLODTier(uint32 diff)
+{
+    if (!BotLODScheduler::IsEnabled())
+        return;
+
+    // A bot pulled into a fight while ticking slowly must react right away
+    bool forceCheck = m_lodTier != BotLODTier::FULL && me->IsInCombat();
+
+    if (!forceCheck && m_lodCheckTimer > diff)
+    {
+        m_lodCheckTimer -= diff;
+        return;
+    }
+    m_lodCheckTimer = BotLODScheduler::GetEvaluateInterval();
+
+    if (!m_initialized || !me->IsInWorld() || me->IsBeingTeleported())
+        return;
+
+    BotLODTier tier = BotLODScheduler::Evaluate(me);
+    if (tier == m_lodTier)
+        return;
+
+    sLog.Out(LOG_BASIC, LOG_LVL_DEBUG, "[RandomBotAI] %s LOD tier %s -> %s",
+        me->GetName(), BotLODScheduler::GetTierName(m_lodTier), BotLODScheduler::GetTierName(tier));
+
+    BotLODTier oldTier = m_lodTier;
+    m_lodTier = tier;
+    m_tickInterval = BotLODScheduler::GetUpdateInterval(tier);
+
+    // Don't sit out the remainder of a long virtual tick when stepping up
+    if (m_updateTimer.GetExpiry() > int32(m_tickInterval))
+        m_updateTimer.Reset(m_tickInterval);
+
+    if (oldTier == BotLODTier::VIRTUAL)
+    {
+        // Back under observation - strategies restart from a clean state
+        ResetBehaviors();
+        m_virtualKillTimer = 0;
+        m_lastProgressTime = 0;
+    }
+
+    if (tier == BotLODTier::VIRTUAL)
+    {
+        me->GetMotionMaster()->Clear(false, true);
+        me->GetMotionMaster()->MoveIdle();
+
+        // Finish anything that would otherwise need pathfinding
+        if (TravelingStrategy* pTravel = GetTravelingStrategy())
+        {
+            if (pTravel->IsTraveling())
+                pTravel->VirtualTravel(me);
+        }
+        if (m_trainingStrategy && m_trainingStrategy->IsActive())
+            m_trainingStrategy->VirtualTrain(me);
+    }
+}
+
+void RandomBotAI::UpdateVirtualProgression()
+{
+    if (!me->IsAlive())
+        return;
+
+    // Simulate grinding: one same-level kill per interval of simulated time
+    m_virtualKillTimer += m_tickInterval;
+    uint32 killInterval = BotLODScheduler::GetVirtualKillInterval();
+    if (!killInterval || m_virtualKillTimer < killInterval)
+        return;
+
+    uint32 kills = m_virtualKillTimer / killInterval;
+    m_virtualKillTimer %= killInterval;
+
+    uint32 startLevel = me->GetLevel();
+    for (uint32 i = 0; i < kills; ++i)
+    {
+        uint32 level = me->GetLevel();
+        me->GiveXP(uint32(MaNGOS::XP::BaseGain(level, level, level)), nullptr);
+        me->ModifyMoney(int32(urand(level * 2, level * 8)));
+    }
+
+    uint32 newLevel = me->GetLevel();
+    if (newLevel == startLevel)
+        return;
+
+    sLog.Out(LOG_BASIC, LOG_LVL_DEBUG, "[RandomBotAI] %s virtually progressed to level %u",
+        me->GetName(), newLevel);
+
+    // Crossed an even level - learn from the nearest trainer without walking there
+    if (newLevel / 2 != startLevel / 2 && m_trainingStrategy)
+        m_trainingStrategy->VirtualTrain(me);
+    m_lastKnownLevel = newLevel;
+
+    // Move on to a spot that fits the new level
+    if (TravelingStrategy* pTravel = GetTravelingStrategy())
+    {
+        pTravel->ResetArrivalCooldown();
+        pTravel->VirtualTravel(me);
+    }
+}
+
 // ============================================================================
 // Combat AI - Main Entry Points
 // ============================================================================
 
 void RandomBotAI::UpdateInCombatAI()
 {
+    BotProfileScope profile(BOT_PROFILE_IN_COMBAT);
+
     Unit* pVictim = me->GetVictim();
     if (!pVictim || pVictim->IsDead())
     {
@@ -522,7 +645,7 @@ void RandomBotAI::UpdateInCombatAI()
             if (GrindingStrategy* pGrinding = GetGrindingStrategy())
             {
                 if (Creature* pCreature = pAttacker->ToCreature())
-                    pGrinding->SetTarget(pCreature);
+                    pGrinding->SetTarget(me, pCreature);
             }
             break;
         }
@@ -554,6 +677,8 @@ void RandomBotAI::UpdateInCombatAI()
 
 void RandomBotAI::UpdateOutOfCombatAI()
 {
+    BotProfileScope profile(BOT_PROFILE_OUT_OF_COMBAT);
+
     // Check if someone is attacking us - respond immediately
     if (!me->GetAttackers().empty())
     {
@@ -598,14 +723,14 @@ void RandomBotAI::UpdateOutOfCombatAI()
     // Training - learning new spells is critical for player power
     if (m_currentActivity && m_currentActivity->AllowsTraining())
     {
-        if (m_trainingStrategy && m_trainingStrategy->Update(me, RB_UPDATE_INTERVAL))
+        if (m_trainingStrategy && m_trainingStrategy->Update(me, m_tickInterval))
             return;  // Busy training
     }
 
     // Vendoring - bags full or gear broken?
     if (m_currentActivity && m_currentActivity->AllowsVendoring())
     {
-        if (m_vendoringStrategy && m_vendoringStrategy->Update(me, RB_UPDATE_INTERVAL))
+        if (m_vendoringStrategy && m_vendoringStrategy->Update(me, m_tickInterval))
             return;  // Busy vendoring
     }
 
@@ -615,7 +740,7 @@ void RandomBotAI::UpdateOutOfCombatAI()
 
     // Delegate to current activity (handles grinding + traveling, or questing, etc.)
     if (m_currentActivity)
-        m_currentActivity->Update(me, RB_UPDATE_INTERVAL);
+        m_currentActivity->Update(me, m_tickInterval);
 
 }
 
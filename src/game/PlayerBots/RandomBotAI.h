@@ -13,6 +13,8 @@
 #include "CombatBotBaseAI.h"
 #include "Strategies/LootingBehavior.h"
 #include "BotCheats.h"
+#include "BotLODScheduler.h"
+#include "BotProfiler.h"
 #include <memory>
 
 class IBotActivity;
@@ -51,6 +53,7 @@ struct BotStatusInfo
     float targetX, targetY, targetZ;
     bool isMoving;
     bool isCasting;
+    BotLODTier lodTier;
 };
 
 class RandomBotAI : public CombatBotBaseAI
@@ -92,6 +95,12 @@ public:
     // Debug status for .bot status command
     BotStatusInfo GetStatusInfo() const;
 
+    // Current level-of-detail tier (see BotLODScheduler)
+    BotLODTier GetLODTier() const { return m_lodTier; }
+
+    // AI tick cost since the last profiler reset (see BotProfiler)
+    BotProfileCounter const& GetProfileCounter() const { return m_profile; }
+
     // Class-specific combat routines
     void UpdateInCombatAI_Paladin() override;
     void UpdateOutOfCombatAI_Paladin() override;
@@ -116,6 +125,18 @@ private:
     ShortTimeTracker m_updateTimer;
     bool m_initialized = false;
 
+    // Level-of-detail scheduling (see BotLODScheduler)
+    BotLODTier m_lodTier = BotLODTier::FULL;
+
+    BotProfileCounter m_profile;
+    uint32 m_tickInterval = RB_UPDATE_INTERVAL; // Simulated ms per AI tick at current tier
+    uint32 m_lodCheckTimer = 0;         // Ms until tier is re-evaluated
+    uint32 m_virtualKillTimer = 0;      // Ms of simulated grinding since last virtual kill
+
+    // LOD helpers
+    void UpdateLODTier(uint32 diff);
+    void UpdateVirtualProgression();
+
     // Current activity (Tier 1) — coordinates high-level behavior
     std::unique_ptr<IBotActivity> m_currentActivity;
 
@@ -15,6 +15,12 @@
 #include "SharedDefines.h"
 #include "Player.h"
 #include "ProgressBar.h"
+#include "ThreadPool.h"
+#include "Timer.h"
+
+#include <iomanip>
+#include <sstream>
+#include <thread>
 
 RandomBotGenerator& RandomBotGenerator::Instance()
 {
@@ -179,121 +185,283 @@ void RandomBotGenerator::PurgeAllRandomBots()
 
 void RandomBotGenerator::GenerateRandomBots(uint32 count)
 {
-    // Clear name tracking from any previous generation cycle
-    m_generatedNames.clear();
+    uint32 const startTime = WorldTimer::getMSTime();
+
+    // Names are checked against this set instead of querying per name
+    LoadExistingNames();
+    InitializeNameData();
 
+    std::vector<BotAccount> accounts;
+    std::vector<BotRecord> records;
+    PlanBots(count, accounts, records);
+    if (records.empty())
+    {
+        sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "[RandomBotGenerator] No valid race/class combination, nothing generated.");
+        return;
+    }
+
+    GenerateBotDetails(records);
+    uint32 const renamed = ResolveNameConflicts(records);
+    uint32 const generatedTime = WorldTimer::getMSTimeDiffToNow(startTime);
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[RandomBotGenerator] Generated names and appearances for %u bots in %u ms (%u renamed after collisions).",
+        uint32(records.size()), generatedTime, renamed);
+
+    if (!WriteAccounts(accounts) || !WriteCharacters(records) || !WritePlayerbotEntries(records))
+    {
+        sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "[RandomBotGenerator] Failed to write generated bots to the database.");
+        return;
+    }
+
+    uint32 const totalTime = std::max(WorldTimer::getMSTimeDiffToNow(startTime), 1u);
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[RandomBotGenerator] Successfully generated %u random bots across %u accounts in %u ms (%.1f bots/s, database writes %u ms).",
+        uint32(records.size()), uint32(accounts.size()), totalTime,
+        records.size() * 1000.0f / totalTime, totalTime - generatedTime);
+}
+
+void RandomBotGenerator::PlanBots(uint32 count, std::vector<BotAccount>& accounts, std::vector<BotRecord>& records)
+{
     // Calculate how many accounts we need (9 characters per account max in vanilla)
     uint32 accountsNeeded = (count + 8) / 9;
 
     uint32 nextAccountId = GetNextFreeAccountId();
 
-    uint32 botsCreated = 0;
+    accounts.reserve(accountsNeeded);
+    records.reserve(count);
 
-    for (uint32 accIdx = 0; accIdx < accountsNeeded && botsCreated < count; ++accIdx)
+    for (uint32 accIdx = 0; accIdx < accountsNeeded && records.size() < count; ++accIdx)
     {
-        uint32 accountId = nextAccountId + accIdx;
+        BotAccount account;
+        account.id = nextAccountId + accIdx;
+
         char accountName[16];
         snprintf(accountName, sizeof(accountName), "RNDBOT%03u", accIdx + 1);
+        account.username = accountName;
+        accounts.push_back(account);
 
-        // Create account
-        CreateBotAccount(accountId, accountName);
-        sLog.Out(LOG_BASIC, LOG_LVL_DETAIL, "[RandomBotGenerator] Created bot account: %s (ID: %u)", accountName, accountId);
-
-        // Create up to 9 characters per account (one per class if possible)
+        // Up to 9 characters per account (one per class if possible)
         uint32 charsOnAccount = 0;
         for (uint8 classId : m_allClasses)
         {
-            if (botsCreated >= count || charsOnAccount >= 9)
+            if (records.size() >= count || charsOnAccount >= 9)
                 break;
 
             uint8 raceId = SelectRandomRaceForClass(classId);
             if (raceId == 0)
                 continue;
 
+            BotRecord record;
             // Use ObjectMgr's GUID generator so the counter stays in sync
             // This prevents player character creation from getting conflicting GUIDs
-            uint32 charGuid = sObjectMgr.GeneratePlayerLowGuid();
-            uint8 level = 1;  // All bots start at level 1 (TODO: make configurable)
-
-            // Create character and playerbot entry
-            CreateBotCharacter(charGuid, accountId, raceId, classId, level);
-            CreatePlayerbotEntry(charGuid);
+            record.guid = sObjectMgr.GeneratePlayerLowGuid();
+            record.accountId = account.id;
+            record.race = raceId;
+            record.classId = classId;
+            records.push_back(record);
 
-            botsCreated++;
             charsOnAccount++;
         }
     }
+}
+
+void RandomBotGenerator::GenerateBotDetails(std::vector<BotRecord>& records)
+{
+    uint32 numThreads = std::min<uint32>(std::thread::hardware_concurrency(),
+        uint32(records.size() + GENERATION_CHUNK - 1) / GENERATION_CHUNK);
+
+    // Name data is read-only from here on and urand is per-thread
+    ThreadPool workers("BotGen", numThreads > 1 ? numThreads : 0);
+    workers.start();
+
+    if (workers.status() != ThreadPool::Status::READY)
+    {
+        GenerateBotDetailsRange(records, 0, records.size());
+        return;
+    }
 
-    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[RandomBotGenerator] Successfully generated %u random bots across %u accounts.",
-        botsCreated, accountsNeeded);
+    for (size_t begin = 0; begin < records.size(); begin += GENERATION_CHUNK)
+    {
+        size_t end = std::min<size_t>(begin + GENERATION_CHUNK, records.size());
+        workers << [this, &records, begin, end]() { GenerateBotDetailsRange(records, begin, end); };
+    }
+    workers.processWorkload().wait();
 }
 
-uint32 RandomBotGenerator::CreateBotAccount(uint32 accountId, const std::string& username)
+void RandomBotGenerator::GenerateBotDetailsRange(std::vector<BotRecord>& records, size_t begin, size_t end)
 {
-    // Create account in realmd.account
+    for (size_t i = begin; i < end; ++i)
+    {
+        BotRecord& record = records[i];
+
+        // Generate gender first so we can use it for race-appropriate name generation
+        record.gender = urand(0, 1);
+        record.name = GenerateCandidateName(record.race, record.gender);
+
+        // Random appearance
+        record.skin = urand(0, 5);
+        record.face = urand(0, 5);
+        record.hairStyle = urand(0, 5);
+        record.hairColor = urand(0, 5);
+        record.facialHair = urand(0, 5);
+    }
+}
+
+uint32 RandomBotGenerator::ResolveNameConflicts(std::vector<BotRecord>& records)
+{
+    // Workers only know their own candidates, uniqueness is settled here in plan order
+    uint32 renamed = 0;
+    for (BotRecord& record : records)
+    {
+        int attempts = 0;
+        const int maxAttempts = 100;
+
+        std::string lowerName = record.name;
+        for (char& c : lowerName)
+            c = std::tolower(c);
+
+        while (m_usedNames.find(lowerName) != m_usedNames.end() && attempts < maxAttempts)
+        {
+            record.name = GenerateCandidateName(record.race, record.gender);
+            lowerName = record.name;
+            for (char& c : lowerName)
+                c = std::tolower(c);
+            attempts++;
+        }
+
+        if (attempts)
+            renamed++;
+
+        m_usedNames.insert(lowerName);
+    }
+
+    return renamed;
+}
+
+bool RandomBotGenerator::WriteAccounts(std::vector<BotAccount> const& accounts)
+{
+    // Create accounts in realmd.account
     // Minimal fields only - bot accounts shouldn't be logged into by players
-    LoginDatabase.PExecute(
-        "INSERT INTO account (id, username, gmlevel) VALUES (%u, '%s', 0)",
-        accountId, username.c_str());
+    std::ostringstream query;
+    uint32 rows = 0;
+
+    LoginDatabase.BeginTransaction();
+    for (BotAccount const& account : accounts)
+    {
+        if (!rows)
+            query << "INSERT INTO account (id, username, gmlevel) VALUES ";
+        else
+            query << ", ";
+
+        query << "(" << account.id << ", '" << account.username << "', 0)";
+
+        if (++rows == INSERT_BATCH_ROWS)
+        {
+            LoginDatabase.Execute(query.str().c_str());
+            query.str("");
+            rows = 0;
+        }
+    }
+    if (rows)
+        LoginDatabase.Execute(query.str().c_str());
 
-    return accountId;
+    // Direct so the rows exist before PlayerBotMgr loads them
+    return LoginDatabase.CommitTransactionDirect();
 }
 
-uint32 RandomBotGenerator::CreateBotCharacter(uint32 charGuid, uint32 accountId, uint8 race, uint8 classId, uint8 level)
+bool RandomBotGenerator::WriteCharacters(std::vector<BotRecord> const& records)
 {
-    // Generate gender first so we can use it for race-appropriate name generation
-    uint8 gender = urand(0, 1);
-    std::string charName = GenerateUniqueBotName(race, gender);
-
-    // Get starting position based on race
-    uint32 mapId;
-    float posX, posY, posZ, posO;
-    GetStartingPosition(race, mapId, posX, posY, posZ, posO);
-
-    // Random appearance
-    uint8 skin = urand(0, 5);
-    uint8 face = urand(0, 5);
-    uint8 hairStyle = urand(0, 5);
-    uint8 hairColor = urand(0, 5);
-    uint8 facialHair = urand(0, 5);
-
-    // Create character in characters.characters
-    CharacterDatabase.PExecute(
-        "INSERT INTO characters (guid, account, name, race, class, gender, level, xp, money, "
-        "skin, face, hair_style, hair_color, facial_hair, bank_bag_slots, character_flags, "
-        "map, position_x, position_y, position_z, orientation, "
-        "online, played_time_total, played_time_level, rest_bonus, logout_time, "
-        "reset_talents_multiplier, reset_talents_time, extra_flags, stable_slots, zone, "
-        "death_expire_time, honor_rank_points, honor_highest_rank, honor_standing, "
-        "honor_last_week_hk, honor_last_week_cp, honor_stored_hk, honor_stored_dk, "
-        "watched_faction, drunk, health, power1, power2, power3, power4, power5, "
-        "explored_zones, equipment_cache, ammo_id, action_bars, world_phase_mask, create_time) "
-        "VALUES (%u, %u, '%s', %u, %u, %u, %u, 0, 0, "
-        "%u, %u, %u, %u, %u, 0, 0, "
-        "%u, %f, %f, %f, %f, "
-        "0, 0, 0, 0, 0, "  // played_time_total=0 allows starting items (cinematic skipped via IsBot check)
-        "0, 0, 0, 0, 0, "
-        "0, 0, 0, 0, "
-        "0, 0, 0, 0, "
-        "0, 0, 100, 100, 100, 100, 100, 100, "
-        "'', '', 0, 0, 1, %u)",  // world_phase_mask = 1 (normal world)
-        charGuid, accountId, charName.c_str(), race, classId, gender, level,
-        skin, face, hairStyle, hairColor, facialHair,
-        mapId, posX, posY, posZ, posO,
-        (uint32)time(nullptr));
-
-    sLog.Out(LOG_BASIC, LOG_LVL_DETAIL, "[RandomBotGenerator] Created bot: %s (GUID: %u, Class: %u, Race: %u, Level: %u)",
-        charName.c_str(), charGuid, classId, race, level);
-
-    return charGuid;
+    uint32 const createTime = uint32(time(nullptr));
+    uint8 const level = 1;  // All bots start at level 1 (TODO: make configurable)
+
+    std::ostringstream query;
+    query.imbue(std::locale::classic());
+    query << std::fixed << std::setprecision(6);
+    uint32 rows = 0;
+
+    BarGoLink bar(uint32(records.size()));
+
+    // Create characters in characters.characters
+    CharacterDatabase.BeginTransaction();
+    for (BotRecord const& record : records)
+    {
+        bar.step();
+
+        if (!rows)
+        {
+            query << "INSERT INTO characters (guid, account, name, race, class, gender, level, xp, money, "
+                "skin, face, hair_style, hair_color, facial_hair, bank_bag_slots, character_flags, "
+                "map, position_x, position_y, position_z, orientation, "
+                "online, played_time_total, played_time_level, rest_bonus, logout_time, "
+                "reset_talents_multiplier, reset_talents_time, extra_flags, stable_slots, zone, "
+                "death_expire_time, honor_rank_points, honor_highest_rank, honor_standing, "
+                "honor_last_week_hk, honor_last_week_cp, honor_stored_hk, honor_stored_dk, "
+                "watched_faction, drunk, health, power1, power2, power3, power4, power5, "
+                "explored_zones, equipment_cache, ammo_id, action_bars, world_phase_mask, create_time) VALUES ";
+        }
+        else
+            query << ", ";
+
+        // Get starting position based on race
+        uint32 mapId;
+        float posX, posY, posZ, posO;
+        GetStartingPosition(record.race, mapId, posX, posY, posZ, posO);
+
+        query << "(" << record.guid << ", " << record.accountId << ", '" << record.name << "', "
+              << uint32(record.race) << ", " << uint32(record.classId) << ", " << uint32(record.gender) << ", "
+              << uint32(level) << ", 0, 0, "
+              << uint32(record.skin) << ", " << uint32(record.face) << ", " << uint32(record.hairStyle) << ", "
+              << uint32(record.hairColor) << ", " << uint32(record.facialHair) << ", 0, 0, "
+              << mapId << ", " << posX << ", " << posY << ", " << posZ << ", " << posO << ", "
+              << "0, 0, 0, 0, 0, "  // played_time_total=0 allows starting items (cinematic skipped via IsBot check)
+              << "0, 0, 0, 0, 0, "
+              << "0, 0, 0, 0, "
+              << "0, 0, 0, 0, "
+              << "0, 0, 100, 100, 100, 100, 100, 100, "
+              << "'', '', 0, 0, 1, " << createTime << ")";  // world_phase_mask = 1 (normal world)
+
+        sLog.Out(LOG_BASIC, LOG_LVL_DETAIL, "[RandomBotGenerator] Created bot: %s (GUID: %u, Class: %u, Race: %u, Level: %u)",
+            record.name.c_str(), record.guid, record.classId, record.race, level);
+
+        if (++rows == INSERT_BATCH_ROWS)
+        {
+            CharacterDatabase.Execute(query.str().c_str());
+            query.str("");
+            rows = 0;
+        }
+    }
+    if (rows)
+        CharacterDatabase.Execute(query.str().c_str());
+
+    return CharacterDatabase.CommitTransactionDirect();
 }
 
-void RandomBotGenerator::CreatePlayerbotEntry(uint32 charGuid)
+bool RandomBotGenerator::WritePlayerbotEntries(std::vector<BotRecord> const& records)
 {
-    // Link character to RandomBotAI in playerbot table
-    CharacterDatabase.PExecute(
-        "INSERT INTO playerbot (char_guid, chance, ai) VALUES (%u, 100, 'RandomBotAI')",
-        charGuid);
+    // Link characters to RandomBotAI in playerbot table
+    std::ostringstream query;
+    uint32 rows = 0;
+
+    CharacterDatabase.BeginTransaction();
+    for (BotRecord const& record : records)
+    {
+        if (!rows)
+            query << "INSERT INTO playerbot (char_guid, chance, ai) VALUES ";
+        else
+            query << ", ";
+
+        query << "(" << record.guid << ", 100, 'RandomBotAI')";
+
+        if (++rows == INSERT_BATCH_ROWS)
+        {
+            CharacterDatabase.Execute(query.str().c_str());
+            query.str("");
+            rows = 0;
+        }
+    }
+    if (rows)
+        CharacterDatabase.Execute(query.str().c_str());
+
+    return CharacterDatabase.CommitTransactionDirect();
 }
 
 // ============================================================================
@@ -313,6 +481,27 @@ uint32 RandomBotGenerator::GetNextFreeAccountId()
     return fields[0].GetUInt32() + 1;
 }
 
+void RandomBotGenerator::LoadExistingNames()
+{
+    m_usedNames.clear();
+
+    std::unique_ptr<QueryResult> result = CharacterDatabase.Query("SELECT name FROM characters");
+    if (!result)
+        return;
+
+    m_usedNames.reserve(result->GetRowCount());
+    do
+    {
+        std::string name = result->Fetch()[0].GetCppString();
+        for (char& c : name)
+            c = std::tolower(c);
+        m_usedNames.insert(std::move(name));
+    }
+    while (result->NextRow());
+
+    sLog.Out(LOG_BASIC, LOG_LVL_DETAIL, "[RandomBotGenerator] Loaded %u existing character names.", uint32(m_usedNames.size()));
+}
+
 void RandomBotGenerator::InitializeNameData()
 {
     if (m_nameDataInitialized)
@@ -604,8 +793,9 @@ std::string RandomBotGenerator::GenerateRaceName(uint8 race, uint8 gender)
     return name;
 }
 
-std::string RandomBotGenerator::GenerateUniqueBotName(uint8 race, uint8 gender)
+std::string RandomBotGenerator::GenerateCandidateName(uint8 race, uint8 gender)
 {
+    // Uniqueness is checked by ResolveNameConflicts, this only has to be a valid name
     std::string name;
     int attempts = 0;
     const int maxAttempts = 100;
@@ -615,12 +805,8 @@ std::string RandomBotGenerator::GenerateUniqueBotName(uint8 race, uint8 gender)
         name = GenerateRaceName(race, gender);
         attempts++;
     }
-    while ((!ValidateGeneratedName(name) ||
-            std::find(m_generatedNames.begin(), m_generatedNames.end(), name) != m_generatedNames.end() ||
-            sObjectMgr.GetPlayerGuidByName(name))
-           && attempts < maxAttempts);
+    while (!ValidateGeneratedName(name) && attempts < maxAttempts);
 
-    m_generatedNames.push_back(name);
     return name;
 }
 
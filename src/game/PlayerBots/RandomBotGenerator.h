@@ -15,6 +15,7 @@
 #include <vector>
 #include <map>
 #include <set>
+#include <unordered_set>
 
 // Race-specific name generation data
 struct RaceNameData
@@ -53,15 +54,42 @@ private:
     RandomBotGenerator(const RandomBotGenerator&) = delete;
     RandomBotGenerator& operator=(const RandomBotGenerator&) = delete;
 
+    // One planned bot character, filled in by the generation pipeline
+    struct BotRecord
+    {
+        uint32 guid;
+        uint32 accountId;
+        uint8 race;
+        uint8 classId;
+        uint8 gender;
+        uint8 skin;
+        uint8 face;
+        uint8 hairStyle;
+        uint8 hairColor;
+        uint8 facialHair;
+        std::string name;
+    };
+
+    struct BotAccount
+    {
+        uint32 id;
+        std::string username;
+    };
+
     // Generation functions
     void GenerateRandomBots(uint32 count);
-    uint32 CreateBotAccount(uint32 accountId, const std::string& username);
-    uint32 CreateBotCharacter(uint32 charGuid, uint32 accountId, uint8 race, uint8 classId, uint8 level);
-    void CreatePlayerbotEntry(uint32 charGuid);
+    void PlanBots(uint32 count, std::vector<BotAccount>& accounts, std::vector<BotRecord>& records);
+    void GenerateBotDetails(std::vector<BotRecord>& records);
+    void GenerateBotDetailsRange(std::vector<BotRecord>& records, size_t begin, size_t end);
+    uint32 ResolveNameConflicts(std::vector<BotRecord>& records);
+    bool WriteAccounts(std::vector<BotAccount> const& accounts);
+    bool WriteCharacters(std::vector<BotRecord> const& records);
+    bool WritePlayerbotEntries(std::vector<BotRecord> const& records);
 
     // Helper functions
     uint32 GetNextFreeAccountId();
-    std::string GenerateUniqueBotName(uint8 race, uint8 gender);
+    void LoadExistingNames();
+    std::string GenerateCandidateName(uint8 race, uint8 gender);
     std::string GenerateRaceName(uint8 race, uint8 gender);
     bool ValidateGeneratedName(std::string const& name);
     void GetStartingPosition(uint8 race, uint32& mapId, float& x, float& y, float& z, float& o);
@@ -78,8 +106,13 @@ private:
     std::set<std::string> m_blacklistedNames;
     bool m_nameDataInitialized = false;
 
-    // Track generated names to avoid duplicates within a session
-    std::vector<std::string> m_generatedNames;
+    // Lowercased names taken in the characters table or by this generation run
+    std::unordered_set<std::string> m_usedNames;
+
+    // Rows per multi-row INSERT statement
+    static constexpr uint32 INSERT_BATCH_ROWS = 500;
+    // Bots handed to a generation worker at once
+    static constexpr uint32 GENERATION_CHUNK = 256;
 };
 
 #define sRandomBotGenerator RandomBotGenerator::Instance()
@@ -8,6 +8,7 @@
 
 #include "GhostWalkingStrategy.h"
 #include "BotMovementManager.h"
+#include "BotProfiler.h"
 #include "TravelingStrategy.h"
 #include "GrindingStrategy.h"
 #include "RandomBotAI.h"
@@ -107,6 +108,8 @@ void GhostWalkingStrategy::OnDeath(Player* pBot)
 
 bool GhostWalkingStrategy::Update(Player* pBot, uint32 /*diff*/)
 {
+    BotProfileScope profile(BOT_PROFILE_GHOST_WALKING);
+
     if (!pBot || pBot->IsAlive())
         return false;
 
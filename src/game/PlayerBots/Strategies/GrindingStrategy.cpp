@@ -9,6 +9,7 @@
 #include "GrindingStrategy.h"
 #include "BotMovementManager.h"
 #include "Combat/BotCombatMgr.h"
+#include "BotProfiler.h"
 #include "Player.h"
 #include "Creature.h"
 #include "Map.h"
@@ -18,6 +19,8 @@
 #include "GridNotifiersImpl.h"
 #include "CellImpl.h"
 #include "PathFinder.h"
+#include "PathRequestService.h"
+#include "BotGrindTargetCache.h"
 #include "Log.h"
 
 #include <algorithm>
@@ -53,12 +56,17 @@ void GrindingStrategy::ClearQuestTargetFilter()
 
 bool GrindingStrategy::Update(Player* pBot, uint32 diff)
 {
+    BotProfileScope profile(BOT_PROFILE_GRINDING);
+
     return UpdateGrinding(pBot, diff) == GrindingResult::ENGAGED;
 }
 
 void GrindingStrategy::OnEnterCombat(Player* pBot)
 {
     // Transition to IN_COMBAT state
+    if (m_state == GrindState::VALIDATING)
+        CancelPathRequests(pBot);
+
     if (m_state == GrindState::APPROACHING)
     {
         m_state = GrindState::IN_COMBAT;
@@ -89,6 +97,7 @@ GrindingResult GrindingStrategy::UpdateGrinding(Player* pBot, uint32 /*diff*/)
     // If bot is in actual combat (game state), let combat system handle it
     if (pBot->IsInCombat())
     {
+        CancelPathRequests(pBot);
         m_state = GrindState::IN_COMBAT;
         return GrindingResult::ENGAGED;
     }
@@ -99,6 +108,9 @@ GrindingResult GrindingStrategy::UpdateGrinding(Player* pBot, uint32 /*diff*/)
         case GrindState::IDLE:
             return HandleIdle(pBot);
 
+        case GrindState::VALIDATING:
+            return HandleValidating(pBot);
+
         case GrindState::APPROACHING:
             return HandleApproaching(pBot);
 
@@ -128,29 +140,85 @@ GrindingResult GrindingStrategy::HandleIdle(Player* pBot)
     if (candidates.empty())
     {
         // No mobs found - apply exponential backoff
-        m_noMobsCount++;
-        if (m_backoffLevel < BACKOFF_MAX_LEVEL)
-            m_backoffLevel++;
-        m_skipTicks = (1u << m_backoffLevel) - 1;
+        ApplyBackoff();
 
         sLog.Out(LOG_BASIC, LOG_LVL_DEBUG, "[Grinding] %s found no targets, backoff level %u",
             pBot->GetName(), m_backoffLevel);
         return GrindingResult::NO_TARGETS;
     }
 
-    // Pick a random target (validates path internally)
-    Creature* pTarget = SelectRandomTarget(pBot, candidates);
+    // Pick a random target once its path comes back
+    RequestPaths(pBot, candidates);
+    m_validateStartTime = WorldTimer::getMSTime();
+    m_state = GrindState::VALIDATING;
+
+    return GrindingResult::BUSY;
+}
+
+GrindingResult GrindingStrategy::HandleValidating(Player* pBot)
+{
+    PathRequestService& pathRequests = pBot->GetMap()->GetPathRequests();
+    bool pending = false;
+
+    for (PathCandidate& candidate : m_pathCandidates)
+    {
+        if (!candidate.ticket)
+            continue;
+
+        PathRequestResult path;
+        PathRequestStatus status = pathRequests.Poll(candidate.ticket, path);
+        if (status == PathRequestStatus::PENDING)
+        {
+            pending = true;
+            continue;
+        }
+
+        candidate.ticket = 0;
+        if (status == PathRequestStatus::READY)
+        {
+            Creature* pCreature = pBot->GetMap()->GetCreature(candidate.guid);
+            candidate.reachable = pCreature && IsPathAcceptable(pBot, pCreature, path);
+        }
+    }
+
+    if (pending)
+    {
+        if (WorldTimer::getMSTime() - m_validateStartTime > VALIDATE_TIMEOUT_MS)
+        {
+            sLog.Out(LOG_BASIC, LOG_LVL_DEBUG, "[Grinding] %s path validation timed out",
+                pBot->GetName());
+            CancelPathRequests(pBot);
+            m_state = GrindState::IDLE;
+        }
+        return GrindingResult::BUSY;
+    }
+
+    // First reachable candidate that is still worth attacking (shuffled order)
+    Creature* pTarget = nullptr;
+    for (PathCandidate const& candidate : m_pathCandidates)
+    {
+        if (!candidate.reachable)
+            continue;
+
+        Creature* pCreature = pBot->GetMap()->GetCreature(candidate.guid);
+        if (IsValidGrindTarget(pBot, pCreature))
+        {
+            pTarget = pCreature;
+            break;
+        }
+    }
+
+    size_t candidateCount = m_pathCandidates.size();
+    m_pathCandidates.clear();
+    m_state = GrindState::IDLE;
 
     if (!pTarget)
     {
         // Had candidates but none had valid paths
-        m_noMobsCount++;
-        if (m_backoffLevel < BACKOFF_MAX_LEVEL)
-            m_backoffLevel++;
-        m_skipTicks = (1u << m_backoffLevel) - 1;
+        ApplyBackoff();
 
         sLog.Out(LOG_BASIC, LOG_LVL_DEBUG, "[Grinding] %s found %zu mobs but none reachable",
-            pBot->GetName(), candidates.size());
+            pBot->GetName(), candidateCount);
         return GrindingResult::NO_TARGETS;
     }
 
@@ -159,8 +227,9 @@ GrindingResult GrindingStrategy::HandleIdle(Player* pBot)
     m_backoffLevel = 0;
     m_skipTicks = 0;
 
-    // Store target and engage
+    // Store target and engage, other bots leave it to us
     m_currentTarget = pTarget->GetObjectGuid();
+    pBot->GetMap()->GetBotGrindTargets().Claim(m_currentTarget, pBot->GetObjectGuid());
     m_approachStartTime = WorldTimer::getMSTime();
     m_state = GrindState::APPROACHING;
 
@@ -239,34 +308,29 @@ GrindingResult GrindingStrategy::HandleInCombat(Player* pBot)
 // Target Finding
 // ============================================================================
 
-// Checker that collects ALL valid grind targets (not just nearest)
-class AllGrindTargets
-{
-public:
-    AllGrindTargets(Player* pBot, GrindingStrategy const* pStrategy, std::vector<Creature*>& targets)
-        : m_pBot(pBot), m_pStrategy(pStrategy), m_targets(targets) {}
-
-    bool operator()(Creature* pCreature)
-    {
-        if (m_pStrategy->IsValidGrindTarget(m_pBot, pCreature))
-            m_targets.push_back(pCreature);
-        return false;  // Keep searching (don't stop at first)
-    }
-
-private:
-    Player* m_pBot;
-    GrindingStrategy const* m_pStrategy;
-    std::vector<Creature*>& m_targets;
-};
-
 std::vector<Creature*> GrindingStrategy::ScanForTargets(Player* pBot, float range)
 {
     std::vector<Creature*> targets;
     targets.reserve(20);  // Pre-allocate for typical case
 
-    AllGrindTargets checker(pBot, this, targets);
-    MaNGOS::CreatureWorker<AllGrindTargets> worker(pBot, checker);
-    Cell::VisitGridObjects(pBot, worker, range);
+    // Level band of IsValidGrindTarget, relaxed when quest filter is active
+    uint32 minLevel = 0;
+    uint32 maxLevel = UINT32_MAX;
+    if (!m_hasQuestFilter)
+    {
+        minLevel = pBot->GetLevel() > uint32(LEVEL_RANGE) ? pBot->GetLevel() - LEVEL_RANGE : 0;
+        maxLevel = pBot->GetLevel();
+    }
+
+    // Cells are scanned once per pass and shared with the other bots on the map
+    Map* pMap = pBot->GetMap();
+    pMap->GetBotGrindTargets().DoCandidates(*pMap, pBot->GetPositionX(), pBot->GetPositionY(),
+        range + pBot->GetObjectBoundingRadius(), minLevel, maxLevel,
+        [&](Creature* pCreature)
+        {
+            if (IsValidGrindTarget(pBot, pCreature))
+                targets.push_back(pCreature);
+        });
 
     return targets;
 }
@@ -321,6 +385,10 @@ bool GrindingStrategy::IsValidGrindTarget(Player* pBot, Creature* pCreature) con
     if (pCreature->HasLootRecipient() && !pCreature->IsTappedBy(pBot))
         return false;
 
+    // Skip mobs another bot is already going for
+    if (pBot->GetMap()->GetBotGrindTargets().IsClaimedByOther(pCreature->GetObjectGuid(), pBot->GetObjectGuid()))
+        return false;
+
     // Skip mobs already in combat (being fought by someone else)
     if (pCreature->IsInCombat() && !pCreature->GetVictim())
         return false;  // In combat but no victim = weird state, skip
@@ -343,15 +411,10 @@ bool GrindingStrategy::IsValidGrindTarget(Player* pBot, Creature* pCreature) con
     return true;
 }
 
-bool GrindingStrategy::HasValidPathTo(Player* pBot, Creature* pCreature) const
+bool GrindingStrategy::IsPathAcceptable(Player* pBot, Creature* pCreature, PathRequestResult const& path) const
 {
-    PathFinder path(pBot);
-    path.calculate(pCreature->GetPositionX(), pCreature->GetPositionY(), pCreature->GetPositionZ(), false);
-
-    PathType type = path.getPathType();
-
     // Reject NOPATH and NOT_USING_PATH (direct line, ignores terrain)
-    if ((type & PATHFIND_NOPATH) || (type & PATHFIND_NOT_USING_PATH))
+    if ((path.type & PATHFIND_NOPATH) || (path.type & PATHFIND_NOT_USING_PATH))
         return false;
 
     // Check path length vs straight-line distance
@@ -359,12 +422,11 @@ bool GrindingStrategy::HasValidPathTo(Player* pBot, Creature* pCreature) const
     float straightDist = pBot->GetDistance(pCreature);
     if (straightDist > 5.0f)  // Only check for non-trivial distances
     {
-        float pathLength = path.Length();
-        if (pathLength > straightDist * PATH_LENGTH_RATIO)
+        if (path.length > straightDist * PATH_LENGTH_RATIO)
         {
             sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
                 "[Grinding] %s rejecting %s - path too long (%.1f vs %.1f straight)",
-                pBot->GetName(), pCreature->GetName(), pathLength, straightDist);
+                pBot->GetName(), pCreature->GetName(), path.length, straightDist);
             return false;
         }
     }
@@ -372,24 +434,49 @@ bool GrindingStrategy::HasValidPathTo(Player* pBot, Creature* pCreature) const
     return true;
 }
 
-Creature* GrindingStrategy::SelectRandomTarget(Player* pBot, std::vector<Creature*>& candidates)
+void GrindingStrategy::RequestPaths(Player* pBot, std::vector<Creature*>& candidates)
 {
-    if (candidates.empty())
-        return nullptr;
-
     // Shuffle candidates for random selection
     std::random_device rd;
     std::mt19937 gen(rd());
     std::shuffle(candidates.begin(), candidates.end(), gen);
 
-    // Try each candidate until we find one with a valid path
+    if (candidates.size() > MAX_PATH_CANDIDATES)
+        candidates.resize(MAX_PATH_CANDIDATES);
+
+    PathRequestService& pathRequests = pBot->GetMap()->GetPathRequests();
+    Vector3 start(pBot->GetPositionX(), pBot->GetPositionY(), pBot->GetPositionZ());
+
+    m_pathCandidates.clear();
     for (Creature* pCreature : candidates)
     {
-        if (HasValidPathTo(pBot, pCreature))
-            return pCreature;
+        PathCandidate candidate;
+        candidate.guid = pCreature->GetObjectGuid();
+        candidate.ticket = pathRequests.Submit(pBot, start,
+            Vector3(pCreature->GetPositionX(), pCreature->GetPositionY(), pCreature->GetPositionZ()));
+        candidate.reachable = false;
+        m_pathCandidates.push_back(candidate);
     }
+}
+
+void GrindingStrategy::CancelPathRequests(Player* pBot)
+{
+    if (m_pathCandidates.empty())
+        return;
+
+    PathRequestService& pathRequests = pBot->GetMap()->GetPathRequests();
+    for (PathCandidate const& candidate : m_pathCandidates)
+        pathRequests.Cancel(candidate.ticket);
 
-    return nullptr;  // None had valid paths
+    m_pathCandidates.clear();
+}
+
+void GrindingStrategy::ApplyBackoff()
+{
+    m_noMobsCount++;
+    if (m_backoffLevel < BACKOFF_MAX_LEVEL)
+        m_backoffLevel++;
+    m_skipTicks = (1u << m_backoffLevel) - 1;
 }
 
 // ============================================================================
@@ -402,6 +489,9 @@ void GrindingStrategy::ClearTarget(Player* pBot)
     if (pBot->GetVictim())
         pBot->AttackStop();
 
+    CancelPathRequests(pBot);
+    if (!m_currentTarget.IsEmpty())
+        pBot->GetMap()->GetBotGrindTargets().Release(m_currentTarget, pBot->GetObjectGuid());
     m_currentTarget.Clear();
     m_state = GrindState::IDLE;
     m_approachStartTime = 0;
@@ -415,10 +505,12 @@ void GrindingStrategy::Reset(Player* pBot)
     m_skipTicks = 0;
 }
 
-void GrindingStrategy::SetTarget(Creature* pTarget)
+void GrindingStrategy::SetTarget(Player* pBot, Creature* pTarget)
 {
     if (pTarget)
     {
+        // Pending requests belong to the target search we are abandoning
+        CancelPathRequests(pBot);
         m_currentTarget = pTarget->GetObjectGuid();
         m_state = GrindState::IN_COMBAT;
         m_approachStartTime = WorldTimer::getMSTime();
@@ -4,9 +4,12 @@
  * Grinding behavior: scan mobs -> pick random -> approach -> kill -> repeat
  *
  * State Machine:
- *   IDLE -> Scan & pick target -> APPROACHING -> IN_COMBAT -> IDLE
- *                                      |
- *                               TIMEOUT (15s) -> Clear target -> IDLE
+ *   IDLE -> Scan & request paths -> VALIDATING -> APPROACHING -> IN_COMBAT -> IDLE
+ *                                        |              |
+ *                                  none reachable  TIMEOUT (30s) -> Clear target -> IDLE
+ *
+ * Candidate paths are computed by the map's PathRequestService and read
+ * back on a later tick, so scanning never blocks on Detour.
  *
  * Part of the vMangos RandomBot AI Project.
  */
@@ -24,6 +27,7 @@ class BotCombatMgr;
 class BotMovementManager;
 class Creature;
 class Player;
+struct PathRequestResult;
 
 // Helper: Returns true for classes that engage at range and need Line of Sight
 inline bool IsRangedClass(uint8 classId)
@@ -52,6 +56,7 @@ enum class GrindingResult
 enum class GrindState
 {
     IDLE,           // No target, ready to search
+    VALIDATING,     // Waiting for candidate paths
     APPROACHING,    // Moving toward target
     IN_COMBAT       // Fighting target
 };
@@ -84,14 +89,13 @@ public:
     void Reset(Player* pBot);
 
     // Set target externally (used when bot switches to a new attacker)
-    void SetTarget(Creature* pTarget);
+    void SetTarget(Player* pBot, Creature* pTarget);
 
     // Get current state (for debugging)
     GrindState GetState() const { return m_state; }
     ObjectGuid GetCurrentTarget() const { return m_currentTarget; }
 
     // Validate a single creature as a grind target (basic checks, no path)
-    // Public because AllGrindTargets checker needs access
     bool IsValidGrindTarget(Player* pBot, Creature* pCreature) const;
 
     // Quest target filter: when set, only target these creature entries
@@ -103,18 +107,25 @@ public:
 private:
     // === Target Finding ===
 
-    // Scan all valid mobs in range (not just nearest)
+    // Scan all valid mobs in range (not just nearest), from the map's shared cell scans
     std::vector<Creature*> ScanForTargets(Player* pBot, float range);
 
-    // Validate that we can path to the target
-    bool HasValidPathTo(Player* pBot, Creature* pCreature) const;
+    // Shuffle candidates and request paths to the first few of them
+    void RequestPaths(Player* pBot, std::vector<Creature*>& candidates);
+
+    // Check a computed path: must use the navmesh and not detour too far
+    bool IsPathAcceptable(Player* pBot, Creature* pCreature, PathRequestResult const& path) const;
+
+    // Drop outstanding path requests
+    void CancelPathRequests(Player* pBot);
 
-    // Pick a random target from candidates (validates path for each)
-    Creature* SelectRandomTarget(Player* pBot, std::vector<Creature*>& candidates);
+    // Apply exponential backoff after a failed search
+    void ApplyBackoff();
 
     // === State Handlers ===
 
     GrindingResult HandleIdle(Player* pBot);
+    GrindingResult HandleValidating(Player* pBot);
     GrindingResult HandleApproaching(Player* pBot);
     GrindingResult HandleInCombat(Player* pBot);
 
@@ -137,6 +148,16 @@ private:
     ObjectGuid m_currentTarget;         // Our tracked target (NOT GetVictim)
     uint32 m_approachStartTime = 0;     // When we started approaching (ms)
 
+    // Outstanding path requests, in shuffled order
+    struct PathCandidate
+    {
+        ObjectGuid guid;
+        uint32 ticket;                  // PathTicket, 0 once the result was read
+        bool reachable;
+    };
+    std::vector<PathCandidate> m_pathCandidates;
+    uint32 m_validateStartTime = 0;
+
     // Consecutive "no mobs" counter for travel system
     uint32 m_noMobsCount = 0;
 
@@ -155,6 +176,8 @@ private:
     static constexpr uint32 APPROACH_TIMEOUT_MS = 30000;    // 30 seconds to reach target
     static constexpr float PATH_LENGTH_RATIO = 2.0f;        // Reject if path > 2x straight-line dist
     static constexpr uint32 BACKOFF_MAX_LEVEL = 3;          // Max backoff: 8 ticks
+    static constexpr uint32 MAX_PATH_CANDIDATES = 4;        // Paths requested per search
+    static constexpr uint32 VALIDATE_TIMEOUT_MS = 5000;     // Give up waiting for paths
 };
 
 #endif // MANGOS_GRINDINGSTRATEGY_H
@@ -8,6 +8,7 @@
 
 #include "LootingBehavior.h"
 #include "BotMovementManager.h"
+#include "BotProfiler.h"
 #include "Player.h"
 #include "Creature.h"
 #include "MotionMaster.h"
@@ -71,6 +72,8 @@ LootingBehavior::LootingBehavior()
 
 bool LootingBehavior::Update(Player* pBot, uint32 diff)
 {
+    BotProfileScope profile(BOT_PROFILE_LOOTING);
+
     if (!m_isLooting)
         return false;
 
@@ -9,6 +9,8 @@
 
 #include "TrainingStrategy.h"
 #include "BotMovementManager.h"
+#include "BotPOIIndex.h"
+#include "BotProfiler.h"
 #include "CombatBotBaseAI.h"
 #include "Spells/SpellDefines.h"
 #include "Player.h"
@@ -20,7 +22,6 @@
 #include "DBCStructure.h"
 #include "SharedDefines.h"
 #include "Map.h"
-#include "ProgressBar.h"
 #include "Cell.h"
 #include "CellImpl.h"
 #include "GridNotifiers.h"
@@ -30,11 +31,6 @@
 #include <cmath>
 #include <cfloat>
 
-// Static member initialization
-std::vector<TrainerLocation> TrainingStrategy::s_trainerCache;
-bool TrainingStrategy::s_cacheBuilt = false;
-std::mutex TrainingStrategy::s_cacheMutex;
-
 TrainingStrategy::TrainingStrategy()
     : m_state(TrainingState::IDLE)
     , m_targetTrainer{}
@@ -45,86 +41,6 @@ TrainingStrategy::TrainingStrategy()
 {
 }
 
-void TrainingStrategy::BuildTrainerCache()
-{
-    std::lock_guard<std::mutex> lock(s_cacheMutex);
-
-    if (s_cacheBuilt)
-        return;
-
-    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[TrainingStrategy] Building class trainer cache...");
-
-    // First pass: count all creature spawns for progress bar
-    uint32 totalCreatures = 0;
-    auto counter = [&totalCreatures](CreatureDataPair const& /*pair*/) {
-        ++totalCreatures;
-        return false; // continue iteration
-    };
-    sObjectMgr.DoCreatureData(counter);
-
-    // Create progress bar
-    BarGoLink bar(totalCreatures);
-
-    uint32 trainerCount = 0;
-
-    // Track trainers per class for logging
-    uint32 trainersPerClass[12] = {0};
-
-    // Second pass: find class trainers with progress
-    auto trainerFinder = [&](CreatureDataPair const& pair) {
-        bar.step();
-
-        CreatureData const& data = pair.second;
-        uint32 guid = pair.first;
-
-        // Get creature template info
-        CreatureInfo const* info = sObjectMgr.GetCreatureTemplate(data.creature_id[0]);
-        if (!info)
-            return false; // continue
-
-        // Check if this NPC is a class trainer (trainer_type = 0, trainer_class > 0)
-        // trainer_type: 0 = class trainer, 1 = mount trainer, 2 = tradeskill trainer
-        if (info->trainer_type != 0 || info->trainer_class == 0)
-            return false; // not a class trainer
-
-        // Must have trainer flag
-        if (!(info->npc_flags & UNIT_NPC_FLAG_TRAINER))
-            return false;
-
-        // Add to cache
-        TrainerLocation loc;
-        loc.x = data.position.x;
-        loc.y = data.position.y;
-        loc.z = data.position.z;
-        loc.mapId = data.position.mapId;
-        loc.creatureEntry = data.creature_id[0];
-        loc.creatureGuid = guid;
-        loc.trainerClass = info->trainer_class;
-        loc.trainerId = info->trainer_id;
-        loc.factionTemplateId = info->faction;
-
-        s_trainerCache.push_back(loc);
-
-        trainerCount++;
-        if (info->trainer_class < 12)
-            trainersPerClass[info->trainer_class]++;
-
-        return false; // continue iteration
-    };
-
-    // Iterate all creature spawns
-    sObjectMgr.DoCreatureData(trainerFinder);
-
-    s_cacheBuilt = true;
-
-    // Log class breakdown
-    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, ">> Class trainer cache built: %u trainers", trainerCount);
-    sLog.Out(LOG_BASIC, LOG_LVL_DEBUG, "   Warrior: %u, Paladin: %u, Hunter: %u, Rogue: %u",
-             trainersPerClass[1], trainersPerClass[2], trainersPerClass[3], trainersPerClass[4]);
-    sLog.Out(LOG_BASIC, LOG_LVL_DEBUG, "   Priest: %u, Shaman: %u, Mage: %u, Warlock: %u, Druid: %u",
-             trainersPerClass[5], trainersPerClass[7], trainersPerClass[8], trainersPerClass[9], trainersPerClass[11]);
-}
-
 bool TrainingStrategy::IsTrainerFriendly(Player* pBot, uint32 factionTemplateId)
 {
     if (!pBot)
@@ -146,48 +62,32 @@ bool TrainingStrategy::FindNearestTrainer(Player* pBot)
     if (!pBot)
         return false;
 
-    // Build cache on first use
-    if (!s_cacheBuilt)
-        BuildTrainerCache();
-
     uint8 botClass = pBot->GetClass();
     float botX = pBot->GetPositionX();
     float botY = pBot->GetPositionY();
     uint32 botMap = pBot->GetMapId();
+    uint32 raceMask = pBot->GetRaceMask();
 
-    float closestDist = FLT_MAX;
-    TrainerLocation const* nearest = nullptr;
-
-    // Search cache for nearest friendly trainer for this class
-    for (TrainerLocation const& loc : s_trainerCache)
+    // Nearest trainer for this class that is friendly to the bot's faction
+    std::vector<BotPOIMatch> matches;
+    BotPOIIndex::FindNearest(BotPOIType::TRAINER, botMap, botX, botY, 1, [botClass, raceMask](BotPOI const& poi)
     {
-        // Must be on same map (continent)
-        if (loc.mapId != botMap)
-            continue;
-
-        // Must train this bot's class
-        if (loc.trainerClass != botClass)
-            continue;
-
-        // Must be friendly to bot's faction
-        if (!IsTrainerFriendly(pBot, loc.factionTemplateId))
-            continue;
+        return poi.trainerClass == botClass && (poi.raceMask & raceMask);
+    }, matches);
 
-        // Calculate 2D distance
-        float dx = loc.x - botX;
-        float dy = loc.y - botY;
-        float dist = std::sqrt(dx * dx + dy * dy);
-
-        if (dist < closestDist)
-        {
-            closestDist = dist;
-            nearest = &loc;
-        }
-    }
+    BotPOI const* nearest = matches.empty() ? nullptr : matches.front().poi;
 
     if (nearest)
     {
-        m_targetTrainer = *nearest;
+        m_targetTrainer.x = nearest->x;
+        m_targetTrainer.y = nearest->y;
+        m_targetTrainer.z = nearest->z;
+        m_targetTrainer.mapId = nearest->mapId;
+        m_targetTrainer.creatureEntry = nearest->entry;
+        m_targetTrainer.creatureGuid = nearest->guid;
+        m_targetTrainer.trainerClass = nearest->trainerClass;
+        m_targetTrainer.trainerId = nearest->trainerId;
+        float closestDist = std::sqrt(matches.front().distSq);
         sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[TrainingStrategy] Bot %s (class %u) found trainer at (%.1f, %.1f, %.1f) map %u, distance: %.1f yards",
                  pBot->GetName(), botClass, m_targetTrainer.x, m_targetTrainer.y, m_targetTrainer.z,
                  m_targetTrainer.mapId, closestDist);
@@ -360,8 +260,19 @@ void TrainingStrategy::LearnAvailableSpells(Player* pBot, Creature* trainer)
         return;
     }
 
+    uint32 learnedCount = LearnSpells(pBot, learnableSpells);
+
+    if (learnedCount > 0)
+    {
+        sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[TrainingStrategy] Bot %s finished learning %u spells from %s",
+                 pBot->GetName(), learnedCount, trainer->GetName());
+    }
+}
+
+uint32 TrainingStrategy::LearnSpells(Player* pBot, std::vector<uint32> const& spells) const
+{
     uint32 learnedCount = 0;
-    for (uint32 spellId : learnableSpells)
+    for (uint32 spellId : spells)
     {
         // Learn the spell (free for now - no gold cost)
         SpellEntry const* spellEntry = sSpellMgr.GetSpellEntry(spellId);
@@ -379,15 +290,40 @@ void TrainingStrategy::LearnAvailableSpells(Player* pBot, Creature* trainer)
         }
     }
 
-    if (learnedCount > 0)
+    return learnedCount;
+}
+
+uint32 TrainingStrategy::VirtualTrain(Player* pBot)
+{
+    if (!pBot || !pBot->IsAlive())
+        return 0;
+
+    if (!FindNearestTrainer(pBot))
     {
-        sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[TrainingStrategy] Bot %s finished learning %u spells from %s",
-                 pBot->GetName(), learnedCount, trainer->GetName());
+        Reset();
+        return 0;
     }
+
+    // Some trainers use their entry as the trainer ID
+    uint32 trainerId = m_targetTrainer.trainerId ? m_targetTrainer.trainerId : m_targetTrainer.creatureEntry;
+    uint32 learnedCount = LearnSpells(pBot, GetLearnableSpells(pBot, trainerId));
+
+    // Refresh spell cache so combat handlers can use newly learned spells
+    if (learnedCount > 0 && m_pAI)
+    {
+        m_pAI->ResetSpellData();
+        m_pAI->PopulateSpellData();
+    }
+
+    m_trainingTriggeredForLevel = pBot->GetLevel();
+    Reset();
+    return learnedCount;
 }
 
 bool TrainingStrategy::Update(Player* pBot, uint32 diff)
 {
+    BotProfileScope profile(BOT_PROFILE_TRAINING);
+
     if (!pBot || !pBot->IsAlive())
     {
         Reset();
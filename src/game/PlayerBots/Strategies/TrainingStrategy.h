@@ -12,14 +12,13 @@
 
 #include "IBotStrategy.h"
 #include <vector>
-#include <mutex>
 
 class Player;
 class Creature;
 class BotMovementManager;
 class CombatBotBaseAI;
 
-// Cached trainer location data
+// Trainer the bot is heading to (from BotPOIIndex)
 struct TrainerLocation
 {
     float x;
@@ -30,7 +29,6 @@ struct TrainerLocation
     uint32 creatureGuid;
     uint8 trainerClass;         // 1=Warrior, 2=Paladin, 3=Hunter, etc.
     uint32 trainerId;           // Links to npc_trainer_template for spell list
-    uint32 factionTemplateId;   // For faction checking
 };
 
 class TrainingStrategy : public IBotStrategy
@@ -56,15 +54,16 @@ public:
     // Reset state
     void Reset();
 
+    // Virtual LOD tier: learn what the nearest class trainer offers
+    // without traveling there. Returns number of spells learned.
+    uint32 VirtualTrain(Player* pBot);
+
     // Set movement manager (called by RandomBotAI after construction)
     void SetMovementManager(BotMovementManager* pMoveMgr) { m_pMovementMgr = pMoveMgr; }
 
     // Set AI reference (for refreshing spell cache after training)
     void SetAI(CombatBotBaseAI* pAI) { m_pAI = pAI; }
 
-    // Pre-build trainer cache (call during server startup)
-    static void BuildTrainerCache();
-
 private:
     // AI reference (for refreshing spell cache after training)
     CombatBotBaseAI* m_pAI = nullptr;
@@ -91,11 +90,6 @@ private:
     // Track the level we triggered training for (to avoid re-triggering)
     uint32 m_trainingTriggeredForLevel;
 
-    // Trainer cache (static, shared across all bots)
-    static std::vector<TrainerLocation> s_trainerCache;
-    static bool s_cacheBuilt;
-    static std::mutex s_cacheMutex;
-
     // Find nearest friendly trainer for this bot's class
     bool FindNearestTrainer(Player* pBot);
 
@@ -105,6 +99,9 @@ private:
     // Learn all available spells from the trainer
     void LearnAvailableSpells(Player* pBot, Creature* trainer);
 
+    // Learn a list of trainer spells, returns number learned
+    uint32 LearnSpells(Player* pBot, std::vector<uint32> const& spells) const;
+
     // Get the trainer creature when we arrive
     Creature* GetTrainerCreature(Player* pBot) const;
 
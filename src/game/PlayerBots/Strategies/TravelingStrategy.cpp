@@ -11,25 +11,22 @@
 #include "BotMovementManager.h"
 #include "VendoringStrategy.h"
 #include "DangerZoneCache.h"
+#include "BotPOIIndex.h"
+#include "BotProfiler.h"
 #include "PlayerBotMgr.h"
 #include "Player.h"
 #include "MotionMaster.h"
 #include "Log.h"
 #include "World.h"
-#include "Database/DatabaseEnv.h"
-#include "ProgressBar.h"
 #include "Map.h"
 #include "MapManager.h"
+#include "PathRequestService.h"
+#include "PathCache.h"
 #include <cmath>
 #include <cfloat>
 
 using namespace TravelConstants;
 
-// Static member initialization
-std::vector<GrindSpotData> TravelingStrategy::s_grindSpotCache;
-bool TravelingStrategy::s_cacheBuilt = false;
-std::mutex TravelingStrategy::s_cacheMutex;
-
 TravelingStrategy::TravelingStrategy()
     : m_state(TravelState::IDLE)
     , m_noMobsSignaled(false)
@@ -43,89 +40,10 @@ TravelingStrategy::TravelingStrategy()
 {
 }
 
-void TravelingStrategy::BuildGrindSpotCache()
-{
-    std::lock_guard<std::mutex> lock(s_cacheMutex);
-
-    if (s_cacheBuilt)
-        return;
-
-    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[TravelingStrategy] Building grind spot cache...");
-
-    // Query all grind spots from database
-    std::unique_ptr<QueryResult> result(CharacterDatabase.PQuery(
-        "SELECT id, map_id, x, y, z, min_level, max_level, faction, priority, name "
-        "FROM grind_spots ORDER BY priority DESC"));
-
-    if (!result)
-    {
-        sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, ">> Grind spot cache: 0 spots loaded (table empty or missing)");
-        s_cacheBuilt = true;
-        return;
-    }
-
-    // Count rows for progress bar
-    uint32 rowCount = result->GetRowCount();
-    BarGoLink bar(rowCount);
-
-    do
-    {
-        bar.step();
-        Field* fields = result->Fetch();
-
-        GrindSpotData spot;
-        spot.id       = fields[0].GetUInt32();
-        spot.mapId    = fields[1].GetUInt32();
-        spot.x        = fields[2].GetFloat();
-        spot.y        = fields[3].GetFloat();
-        spot.z        = fields[4].GetFloat();
-        spot.minLevel = fields[5].GetUInt8();
-        spot.maxLevel = fields[6].GetUInt8();
-        spot.faction  = fields[7].GetUInt8();
-        spot.priority = fields[8].GetUInt8();
-        spot.name     = fields[9].GetCppString();
-
-        s_grindSpotCache.push_back(spot);
-    }
-    while (result->NextRow());
-
-    // Correct Z coordinates using terrain data
-    uint32 correctedCount = 0;
-    for (GrindSpotData& spot : s_grindSpotCache)
-    {
-        // Get the map for this spot (instanceId 0 for continents)
-        Map* map = sMapMgr.FindMap(spot.mapId, 0);
-        if (!map)
-            continue;
-
-        float terrainZ = map->GetHeight(spot.x, spot.y, spot.z + 10.0f);
-        if (terrainZ > INVALID_HEIGHT)
-        {
-            // Check if Z needs correction (more than 1 yard difference)
-            if (std::abs(terrainZ - spot.z) > 1.0f)
-            {
-                spot.z = terrainZ;
-                ++correctedCount;
-            }
-        }
-    }
-
-    s_cacheBuilt = true;
-
-    if (correctedCount > 0)
-    {
-        sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, ">> Grind spot cache built: %u spots loaded (%u Z-coordinates corrected)",
-                 static_cast<uint32>(s_grindSpotCache.size()), correctedCount);
-    }
-    else
-    {
-        sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, ">> Grind spot cache built: %u spots loaded",
-                 static_cast<uint32>(s_grindSpotCache.size()));
-    }
-}
-
 bool TravelingStrategy::Update(Player* pBot, uint32 /*diff*/)
 {
+    BotProfileScope profile(BOT_PROFILE_TRAVELING);
+
     if (!pBot || !pBot->IsAlive())
         return false;
 
@@ -166,14 +84,49 @@ bool TravelingStrategy::Update(Player* pBot, uint32 /*diff*/)
                 return false;
             }
 
+            // Long trips go through travel graph nodes, only the first
+            // leg is checked on the navmesh
+            PlanRoute(pBot);
+
             // Validate path exists before committing to travel
-            if (!ValidatePath(pBot, m_targetX, m_targetY, m_targetZ))
+            m_pathTicket = pBot->GetMap()->GetPathRequests().Submit(pBot,
+                Vector3(pBot->GetPositionX(), pBot->GetPositionY(), pBot->GetPositionZ()),
+                GetFirstLegEnd());
+            m_state = TravelState::VALIDATING;
+            return true;
+        }
+
+        case TravelState::VALIDATING:
+        {
+            PathRequestResult path;
+            PathRequestStatus status = pBot->GetMap()->GetPathRequests().Poll(m_pathTicket, path);
+
+            if (status == PathRequestStatus::PENDING)
+                return true;
+
+            m_pathTicket = 0;
+
+            // Request lost (map change, expired): pick again
+            if (status == PathRequestStatus::UNKNOWN)
+            {
+                m_state = TravelState::FINDING_SPOT;
+                return true;
+            }
+
+            sLog.Out(LOG_BASIC, LOG_LVL_BASIC,
+                "[TravelingStrategy] %s: ValidatePath from (%.1f, %.1f, %.1f) to (%.1f, %.1f, %.1f) - PathType: %u",
+                pBot->GetName(),
+                pBot->GetPositionX(), pBot->GetPositionY(), pBot->GetPositionZ(),
+                m_targetX, m_targetY, m_targetZ, static_cast<uint32>(path.type));
+
+            if (path.type & PATHFIND_NOPATH)
             {
                 sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL,
                     "[TravelingStrategy] %s: Cannot reach %s, aborting travel",
                     pBot->GetName(), m_targetName.c_str());
                 m_state = TravelState::IDLE;
                 m_noMobsSignaled = false;
+                m_route.clear();
                 return false;
             }
 
@@ -216,6 +169,7 @@ bool TravelingStrategy::Update(Player* pBot, uint32 /*diff*/)
                 m_noMobsSignaled = false;
                 m_waypointsGenerated = false;
                 m_waypoints.clear();
+                m_route.clear();
                 return false;  // Let grinding take over
             }
 
@@ -238,10 +192,12 @@ bool TravelingStrategy::Update(Player* pBot, uint32 /*diff*/)
                 sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
                     "[TravelingStrategy] %s stuck while traveling, resetting",
                     pBot->GetName());
+                ReportStuckLeg(pBot);
                 m_state = TravelState::IDLE;
                 m_noMobsSignaled = false;
                 m_waypointsGenerated = false;
                 m_waypoints.clear();
+                m_route.clear();
                 return false;
             }
 
@@ -279,100 +235,47 @@ bool TravelingStrategy::ShouldTravel(Player* /*pBot*/) const
     return true;
 }
 
-uint8 TravelingStrategy::GetBotFaction(Player* pBot)
-{
-    if (!pBot)
-        return 0;
-
-    // Map race to faction: 1=Alliance, 2=Horde
-    switch (pBot->GetRace())
-    {
-        case RACE_HUMAN:
-        case RACE_DWARF:
-        case RACE_NIGHTELF:
-        case RACE_GNOME:
-            return 1;  // Alliance
-        case RACE_ORC:
-        case RACE_UNDEAD:
-        case RACE_TAUREN:
-        case RACE_TROLL:
-            return 2;  // Horde
-        default:
-            return 0;  // Unknown
-    }
-}
-
 bool TravelingStrategy::FindGrindSpot(Player* pBot)
 {
     if (!pBot)
         return false;
 
-    // Ensure cache is built (fallback - should already be built at startup)
-    if (!s_cacheBuilt)
-        BuildGrindSpotCache();
-
     uint32 level = pBot->GetLevel();
     uint32 mapId = pBot->GetMapId();
-    uint8 faction = GetBotFaction(pBot);
+    uint32 raceMask = pBot->GetRaceMask();
 
     float px = pBot->GetPositionX();
     float py = pBot->GetPositionY();
 
-    // Two-phase search: first look for nearby spots (same zone), then expand if needed
-    const float LOCAL_RADIUS_SQ = 800.0f * 800.0f;  // ~800 yards = same zone/area
-
-    std::vector<GrindSpotData const*> nearbySpots;
-    std::vector<GrindSpotData const*> distantSpots;
-
-    for (GrindSpotData const& spot : s_grindSpotCache)
-    {
-        // Filter: must be on same map
-        if (spot.mapId != mapId)
-            continue;
-
-        // Filter: level must be in range
-        if (level < spot.minLevel || level > spot.maxLevel)
-            continue;
-
-        // Filter: faction must match (0 = both factions)
-        if (spot.faction != 0 && spot.faction != faction)
-            continue;
+    // Level range and faction must match
+    auto servesBot = [raceMask, level](BotPOI const& poi) { return BotPOIIndex::Serves(poi, raceMask, level); };
 
-        // Calculate distance squared
-        float dx = spot.x - px;
-        float dy = spot.y - py;
-        float distSq = dx * dx + dy * dy;
-
-        // Categorize by distance
-        if (distSq <= LOCAL_RADIUS_SQ)
-            nearbySpots.push_back(&spot);
-        else
-            distantSpots.push_back(&spot);
-    }
+    // Two-phase search: first look for nearby spots (same zone), then expand if needed
+    std::vector<BotPOIMatch> spots;
+    BotPOIIndex::FindNearest(BotPOIType::GRIND_SPOT, mapId, px, py, MAX_LOCAL_SPOTS, servesBot, spots, LOCAL_RADIUS);
 
     // Prefer nearby spots (stay in current zone, randomize between local options)
-    GrindSpotData const* chosenSpot = nullptr;
+    BotPOI const* chosenSpot = nullptr;
 
-    if (!nearbySpots.empty())
+    if (!spots.empty())
     {
         // Randomly pick from nearby spots (avoids "train" behavior)
-        chosenSpot = nearbySpots[urand(0, nearbySpots.size() - 1)];
+        chosenSpot = spots[urand(0, spots.size() - 1)].poi;
 
         if (sPlayerBotMgr.IsDebugGrindSelectionEnabled())
         {
             sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL,
-                "[GRIND] %s selected '%s' from %zu nearby, %zu distant spots",
-                pBot->GetName(), chosenSpot->name.c_str(),
-                nearbySpots.size(), distantSpots.size());
+                "[GRIND] %s selected '%s' from %zu nearby spots",
+                pBot->GetName(), BotPOIIndex::GetName(*chosenSpot).c_str(), spots.size());
         }
     }
-    else if (!distantSpots.empty())
+    else if (BotPOIIndex::FindNearest(BotPOIType::GRIND_SPOT, mapId, px, py, MAX_DISTANT_SPOTS, servesBot, spots))
     {
         // No nearby spots - need to travel to new zone
-        // Pick closest distant spot (weighted random favoring closer)
-        if (distantSpots.size() == 1)
+        // Pick among the closest distant spots (weighted random favoring closer)
+        if (spots.size() == 1)
         {
-            chosenSpot = distantSpots[0];
+            chosenSpot = spots[0].poi;
         }
         else
         {
@@ -380,12 +283,9 @@ bool TravelingStrategy::FindGrindSpot(Player* pBot)
             std::vector<float> weights;
             float totalWeight = 0.0f;
 
-            for (GrindSpotData const* spot : distantSpots)
+            for (BotPOIMatch const& spot : spots)
             {
-                float dx = spot->x - px;
-                float dy = spot->y - py;
-                float distSq = dx * dx + dy * dy;
-                float weight = 1.0f / (1.0f + distSq / 100000.0f);
+                float weight = 1.0f / (1.0f + spot.distSq / 100000.0f);
                 weights.push_back(weight);
                 totalWeight += weight;
             }
@@ -393,25 +293,25 @@ bool TravelingStrategy::FindGrindSpot(Player* pBot)
             float roll = (float)urand(0, 10000) / 10000.0f * totalWeight;
             float cumulative = 0.0f;
 
-            for (size_t i = 0; i < distantSpots.size(); ++i)
+            for (size_t i = 0; i < spots.size(); ++i)
             {
                 cumulative += weights[i];
                 if (roll <= cumulative)
                 {
-                    chosenSpot = distantSpots[i];
+                    chosenSpot = spots[i].poi;
                     break;
                 }
             }
 
             if (!chosenSpot)
-                chosenSpot = distantSpots[0];
+                chosenSpot = spots[0].poi;
         }
 
         if (sPlayerBotMgr.IsDebugGrindSelectionEnabled())
         {
             sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL,
                 "[GRIND] %s traveling to '%s' (%zu distant spots, no nearby)",
-                pBot->GetName(), chosenSpot->name.c_str(), distantSpots.size());
+                pBot->GetName(), BotPOIIndex::GetName(*chosenSpot).c_str(), spots.size());
         }
     }
 
@@ -424,7 +324,7 @@ bool TravelingStrategy::FindGrindSpot(Player* pBot)
 
     m_targetX = chosenSpot->x + offsetX;
     m_targetY = chosenSpot->y + offsetY;
-    m_targetName = chosenSpot->name;
+    m_targetName = BotPOIIndex::GetName(*chosenSpot);
 
     // Correct Z using terrain height (ignore stored Z which may be invalid/underground)
     if (Map* map = pBot->GetMap())
@@ -452,6 +352,13 @@ bool TravelingStrategy::IsAtDestination(Player* pBot) const
 
 void TravelingStrategy::OnEnterCombat(Player* pBot)
 {
+    // Pick the destination again once combat is over
+    if (m_state == TravelState::VALIDATING)
+    {
+        CancelPathRequest(pBot);
+        m_state = TravelState::IDLE;
+    }
+
     if (m_state == TravelState::WALKING)
     {
         sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
@@ -478,6 +385,36 @@ void TravelingStrategy::ResetArrivalCooldown()
         m_state = TravelState::IDLE;
 }
 
+bool TravelingStrategy::VirtualTravel(Player* pBot)
+{
+    if (!pBot || !pBot->IsAlive())
+        return false;
+
+    CancelPathRequest(pBot);
+
+    // A walk already underway keeps its destination; otherwise pick a spot
+    if (m_state != TravelState::WALKING && !FindGrindSpot(pBot))
+        return false;
+
+    m_state = TravelState::ARRIVED;
+    m_arrivalTime = WorldTimer::getMSTime();
+    m_noMobsSignaled = false;
+    m_waypointsGenerated = false;
+    m_waypoints.clear();
+    m_route.clear();
+
+    if (IsAtDestination(pBot))
+        return false;
+
+    sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
+        "[TravelingStrategy] %s virtually traveled to %s (%.1f, %.1f, %.1f)",
+        pBot->GetName(), m_targetName.c_str(), m_targetX, m_targetY, m_targetZ);
+
+    pBot->GetMotionMaster()->Clear(false, true);
+    pBot->GetMotionMaster()->MoveIdle();
+    return pBot->NearTeleportTo(m_targetX, m_targetY, m_targetZ, pBot->GetOrientation());
+}
+
 bool TravelingStrategy::IsTraveling() const
 {
     return m_state == TravelState::WALKING;
@@ -510,6 +447,16 @@ bool TravelingStrategy::ValidatePath(Player* pBot, float destX, float destY, flo
     return true;
 }
 
+void TravelingStrategy::CancelPathRequest(Player* pBot)
+{
+    if (!m_pathTicket)
+        return;
+
+    if (pBot)
+        pBot->GetMap()->GetPathRequests().Cancel(m_pathTicket);
+    m_pathTicket = 0;
+}
+
 void TravelingStrategy::GenerateWaypoints(Player* pBot)
 {
     m_waypoints.clear();
@@ -519,110 +466,60 @@ void TravelingStrategy::GenerateWaypoints(Player* pBot)
     if (!pBot)
         return;
 
-    float startX = pBot->GetPositionX();
-    float startY = pBot->GetPositionY();
-    float startZ = pBot->GetPositionZ();
+    Vector3 from(pBot->GetPositionX(), pBot->GetPositionY(), pBot->GetPositionZ());
+
+    float const journeyDx = m_targetX - from.x;
+    float const journeyDy = m_targetY - from.y;
+    float const journeyDist = std::sqrt(journeyDx * journeyDx + journeyDy * journeyDy);
+
+    // Validate destination Z against the terrain
+    float destZ = m_targetZ;
+    if (Map* map = pBot->GetMap())
+    {
+        float validZ = map->GetHeight(m_targetX, m_targetY, MAX_HEIGHT);
+        if (validZ <= INVALID_HEIGHT)
+            validZ = map->GetHeight(m_targetX, m_targetY, m_targetZ + 10.0f);
+        if (validZ > INVALID_HEIGHT)
+            destZ = validZ;     // Otherwise use target Z as-is (destination from DB should be valid)
+    }
 
-    float dx = m_targetX - startX;
-    float dy = m_targetY - startY;
-    float totalDist = std::sqrt(dx * dx + dy * dy);
+    // Travel graph nodes of a long trip, then the destination
+    std::vector<Vector3> legEnds;
+    for (BotTravelStop const& stop : m_route)
+        legEnds.push_back(Vector3(stop.x, stop.y, stop.z));
+    legEnds.push_back(Vector3(m_targetX, m_targetY, destZ));
 
     uint32 skippedWaypoints = 0;
 
-    if (totalDist <= WAYPOINT_SEGMENT_DISTANCE)
+    // Follow the navmesh path of the first leg when the map has one cached
+    // (usually stored while VALIDATING), then straight segments for
+    // whatever it didn't cover
+    PathRequestResult cached;
+    if (!pBot->GetTransport() &&
+        pBot->GetMap()->GetPathCache().Find(from, GetFirstLegEnd(), cached) &&
+        (cached.type == PATHFIND_NORMAL || cached.type == PATHFIND_INCOMPLETE) && cached.path.size() > 1)
     {
-        // Short distance - single waypoint at destination
-        // Validate destination Z before adding
-        if (Map* map = pBot->GetMap())
+        float walked = 0.0f;
+        for (size_t i = 1; i + 1 < cached.path.size(); ++i)
         {
-            float validZ = map->GetHeight(m_targetX, m_targetY, MAX_HEIGHT);
-            if (validZ > INVALID_HEIGHT)
-            {
-                m_waypoints.push_back(Vector3(m_targetX, m_targetY, validZ));
-            }
-            else
+            walked += (cached.path[i] - cached.path[i - 1]).length();
+            if (walked >= WAYPOINT_SEGMENT_DISTANCE)
             {
-                // Try with target Z as reference
-                validZ = map->GetHeight(m_targetX, m_targetY, m_targetZ + 10.0f);
-                if (validZ > INVALID_HEIGHT)
-                {
-                    m_waypoints.push_back(Vector3(m_targetX, m_targetY, validZ));
-                }
-                else
-                {
-                    // Use target Z as-is (destination from DB should be valid)
-                    m_waypoints.push_back(Vector3(m_targetX, m_targetY, m_targetZ));
-                }
+                m_waypoints.push_back(cached.path[i]);
+                walked = 0.0f;
             }
         }
-        else
-        {
-            m_waypoints.push_back(Vector3(m_targetX, m_targetY, m_targetZ));
-        }
-    }
-    else
-    {
-        // Long distance - generate intermediate waypoints
-        uint32 numSegments = static_cast<uint32>(totalDist / WAYPOINT_SEGMENT_DISTANCE) + 1;
-
-        for (uint32 i = 1; i <= numSegments; ++i)
-        {
-            float t = static_cast<float>(i) / numSegments;
-            float wpX = startX + dx * t;
-            float wpY = startY + dy * t;
-            float wpZ = INVALID_HEIGHT;
-            bool validZ = false;
 
-            if (Map* map = pBot->GetMap())
-            {
-                // First attempt: query with MAX_HEIGHT
-                wpZ = map->GetHeight(wpX, wpY, MAX_HEIGHT);
-                if (wpZ > INVALID_HEIGHT)
-                {
-                    validZ = true;
-                }
-                else
-                {
-                    // Second attempt: query with interpolated Z as reference
-                    float refZ = startZ + (m_targetZ - startZ) * t;
-                    wpZ = map->GetHeight(wpX, wpY, refZ + 10.0f);
-                    if (wpZ > INVALID_HEIGHT)
-                    {
-                        validZ = true;
-                    }
-                }
-            }
+        if (cached.type == PATHFIND_INCOMPLETE)
+            m_waypoints.push_back(cached.path.back());
 
-            if (validZ)
-            {
-                m_waypoints.push_back(Vector3(wpX, wpY, wpZ));
-            }
-            else
-            {
-                ++skippedWaypoints;
-                sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
-                    "[TravelingStrategy] %s: Skipping waypoint %u at (%.1f, %.1f) - invalid terrain height",
-                    pBot->GetName(), i, wpX, wpY);
-            }
-        }
+        from = cached.path.back();
+    }
 
-        // Ensure final waypoint is exact destination (with validated Z)
-        if (!m_waypoints.empty())
-        {
-            if (Map* map = pBot->GetMap())
-            {
-                float destZ = map->GetHeight(m_targetX, m_targetY, MAX_HEIGHT);
-                if (destZ <= INVALID_HEIGHT)
-                    destZ = map->GetHeight(m_targetX, m_targetY, m_targetZ + 10.0f);
-                if (destZ <= INVALID_HEIGHT)
-                    destZ = m_targetZ;  // Fallback to DB value
-                m_waypoints.back() = Vector3(m_targetX, m_targetY, destZ);
-            }
-            else
-            {
-                m_waypoints.back() = Vector3(m_targetX, m_targetY, m_targetZ);
-            }
-        }
+    for (Vector3 const& legEnd : legEnds)
+    {
+        AppendSegments(pBot, from, legEnd, skippedWaypoints);
+        from = legEnd;
     }
 
     // TESTING: Commented out to isolate PathFinder issue
@@ -649,16 +546,134 @@ void TravelingStrategy::GenerateWaypoints(Player* pBot)
     {
         sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
             "[TravelingStrategy] %s: Generated %zu waypoints for %.0f yard journey (skipped %u invalid)",
-            pBot->GetName(), m_waypoints.size(), totalDist, skippedWaypoints);
+            pBot->GetName(), m_waypoints.size(), journeyDist, skippedWaypoints);
     }
     else
     {
         sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
             "[TravelingStrategy] %s: Generated %zu waypoints for %.0f yard journey",
-            pBot->GetName(), m_waypoints.size(), totalDist);
+            pBot->GetName(), m_waypoints.size(), journeyDist);
     }
 }
 
+void TravelingStrategy::AppendSegments(Player* pBot, Vector3 const& from, Vector3 const& to, uint32& skippedWaypoints)
+{
+    float const dx = to.x - from.x;
+    float const dy = to.y - from.y;
+    float const dist = std::sqrt(dx * dx + dy * dy);
+
+    // Intermediate waypoints on the terrain, short distances go straight to the end
+    uint32 const numSegments = static_cast<uint32>(dist / WAYPOINT_SEGMENT_DISTANCE) + 1;
+
+    for (uint32 i = 1; i < numSegments; ++i)
+    {
+        float t = static_cast<float>(i) / numSegments;
+        float wpX = from.x + dx * t;
+        float wpY = from.y + dy * t;
+        float wpZ = INVALID_HEIGHT;
+        bool validZ = false;
+
+        if (Map* map = pBot->GetMap())
+        {
+            // First attempt: query with MAX_HEIGHT
+            wpZ = map->GetHeight(wpX, wpY, MAX_HEIGHT);
+            if (wpZ > INVALID_HEIGHT)
+            {
+                validZ = true;
+            }
+            else
+            {
+                // Second attempt: query with interpolated Z as reference
+                float refZ = from.z + (to.z - from.z) * t;
+                wpZ = map->GetHeight(wpX, wpY, refZ + 10.0f);
+                if (wpZ > INVALID_HEIGHT)
+                {
+                    validZ = true;
+                }
+            }
+        }
+
+        if (validZ)
+        {
+            m_waypoints.push_back(Vector3(wpX, wpY, wpZ));
+        }
+        else
+        {
+            ++skippedWaypoints;
+            sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
+                "[TravelingStrategy] %s: Skipping waypoint %u at (%.1f, %.1f) - invalid terrain height",
+                pBot->GetName(), i, wpX, wpY);
+        }
+    }
+
+    // Ensure the leg ends exactly at its end point
+    m_waypoints.push_back(to);
+}
+
+Vector3 TravelingStrategy::GetFirstLegEnd() const
+{
+    if (m_route.empty())
+        return Vector3(m_targetX, m_targetY, m_targetZ);
+
+    return Vector3(m_route.front().x, m_route.front().y, m_route.front().z);
+}
+
+void TravelingStrategy::PlanRoute(Player* pBot)
+{
+    m_route.clear();
+
+    float const dx = m_targetX - pBot->GetPositionX();
+    float const dy = m_targetY - pBot->GetPositionY();
+    if (dx * dx + dy * dy <= ROUTED_TRIP_DISTANCE * ROUTED_TRIP_DISTANCE || pBot->GetTransport())
+        return;
+
+    if (!BotTravelGraph::FindRoute(pBot->GetMapId(),
+        pBot->GetPositionX(), pBot->GetPositionY(), pBot->GetPositionZ(),
+        m_targetX, m_targetY, m_targetZ, m_route))
+        return;
+
+    sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
+        "[TravelingStrategy] %s: Routed %.0f yard trip through %zu travel graph nodes",
+        pBot->GetName(), std::sqrt(dx * dx + dy * dy), m_route.size());
+}
+
+void TravelingStrategy::ReportStuckLeg(Player* pBot)
+{
+    if (m_route.size() < 2)
+        return;
+
+    // Legs from the start and to the destination are not graph links
+    float const x = pBot->GetPositionX();
+    float const y = pBot->GetPositionY();
+
+    uint32 nearestLeg = 0;
+    float nearestDistSq = BotTravelGraph::LINK_DISTANCE * BotTravelGraph::LINK_DISTANCE;
+    for (uint32 leg = 1; leg < m_route.size(); ++leg)
+    {
+        BotTravelStop const& a = m_route[leg - 1];
+        BotTravelStop const& b = m_route[leg];
+
+        // Distance to the segment between the two nodes
+        float const abX = b.x - a.x;
+        float const abY = b.y - a.y;
+        float const lengthSq = abX * abX + abY * abY;
+        float t = lengthSq > 0.0f ? ((x - a.x) * abX + (y - a.y) * abY) / lengthSq : 0.0f;
+        t = std::min(std::max(t, 0.0f), 1.0f);
+
+        float const offX = a.x + abX * t - x;
+        float const offY = a.y + abY * t - y;
+        float const distSq = offX * offX + offY * offY;
+        if (distSq < nearestDistSq)
+        {
+            nearestDistSq = distSq;
+            nearestLeg = leg;
+        }
+    }
+
+    if (nearestLeg)
+        BotTravelGraph::ReportFailedLeg(pBot->GetMapId(), m_route[nearestLeg - 1].node, m_route[nearestLeg].node);
+}
+
 void TravelingStrategy::MoveToCurrentWaypoint(Player* pBot)
 {
     if (!pBot || m_currentWaypoint >= m_waypoints.size())
@@ -672,7 +687,7 @@ void TravelingStrategy::MoveToCurrentWaypoint(Player* pBot)
         MoveResult result = m_pMovementMgr->MoveTo(wp.x, wp.y, wp.z,
             MovementPriority::PRIORITY_NORMAL, m_currentWaypoint);
 
-        if (result != MoveResult::SUCCESS)
+        if (result != MoveResult::SUCCESS && result != MoveResult::PENDING_PATH)
         {
             sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
                 "[TravelingStrategy] %s: MoveTo failed with result %u for waypoint %u",
@@ -11,29 +11,16 @@
 #define MANGOS_TRAVELINGSTRATEGY_H
 
 #include "IBotStrategy.h"
+#include "BotTravelGraph.h"
 #include "PathFinder.h"
 #include <string>
 #include <vector>
-#include <mutex>
 
 class Player;
 class VendoringStrategy;
 class BotMovementManager;
 struct DangerZone;
 
-// Cached grind spot data (loaded once at startup)
-struct GrindSpotData
-{
-    uint32 id;
-    uint32 mapId;
-    float x, y, z;
-    uint8 minLevel;
-    uint8 maxLevel;
-    uint8 faction;      // 0=both, 1=alliance, 2=horde
-    uint8 priority;
-    std::string name;
-};
-
 namespace TravelConstants
 {
     // Pre-travel vendor thresholds
@@ -49,8 +36,16 @@ namespace TravelConstants
     constexpr uint32 STUCK_TIMEOUT_MS = 30000;      // 30 sec without progress = stuck
     constexpr float STUCK_MIN_DISTANCE = 5.0f;      // Must move 5 yards per check
 
+    // Grind spot selection
+    constexpr float LOCAL_RADIUS = 800.0f;          // ~800 yards = same zone/area
+    constexpr uint32 MAX_LOCAL_SPOTS = 32;          // Random pick among these nearby spots
+    constexpr uint32 MAX_DISTANT_SPOTS = 16;        // Weighted pick among the closest distant spots
+
     // Waypoint segmentation for long journeys
     constexpr float WAYPOINT_SEGMENT_DISTANCE = 200.0f;  // Max yards per segment
+
+    // Trips longer than this are planned on the BotTravelGraph first
+    constexpr float ROUTED_TRIP_DISTANCE = 1.5f * BotTravelGraph::LINK_DISTANCE;
 }
 
 class TravelingStrategy : public IBotStrategy
@@ -76,8 +71,10 @@ public:
     // Called by RandomBotAI::MovementInform when waypoint reached
     void OnWaypointReached(Player* pBot, uint32 waypointId);
 
-    // Cache management (called once at startup from PlayerBotMgr::Load)
-    static void BuildGrindSpotCache();
+    // Virtual LOD tier: finish the current journey (or pick a new
+    // level-appropriate spot) instantly, without pathfinding.
+    // Returns true if the bot was moved.
+    bool VirtualTravel(Player* pBot);
 
     // Set vendoring strategy reference (for pre-travel vendor trigger)
     void SetVendoringStrategy(VendoringStrategy* pVendoring) { m_pVendoringStrategy = pVendoring; }
@@ -92,15 +89,11 @@ private:
     // Movement manager (set by RandomBotAI, centralized movement coordination)
     BotMovementManager* m_pMovementMgr = nullptr;
 
-    // Static cache (shared across all bot instances)
-    static std::vector<GrindSpotData> s_grindSpotCache;
-    static bool s_cacheBuilt;
-    static std::mutex s_cacheMutex;
-
     enum class TravelState
     {
         IDLE,           // Not traveling, checking if needed
         FINDING_SPOT,   // Query DB for destination
+        VALIDATING,     // Waiting for the path to the destination
         WALKING,        // Moving to destination
         ARRIVED         // At destination, on cooldown
     };
@@ -113,6 +106,7 @@ private:
     float m_targetY = 0.0f;
     float m_targetZ = 0.0f;
     std::string m_targetName;
+    uint32 m_pathTicket = 0;            // PathTicket of the destination check
 
     // Anti-thrashing
     uint32 m_arrivalTime = 0;           // When we arrived at current spot
@@ -126,19 +120,30 @@ private:
     bool FindGrindSpot(Player* pBot);
     bool IsAtDestination(Player* pBot) const;
     bool ShouldTravel(Player* pBot) const;
-    static uint8 GetBotFaction(Player* pBot);
 
     // Path validation and waypoint generation
+    // ValidatePath is synchronous (detours); the destination is checked
+    // through the map's PathRequestService in VALIDATING instead.
     bool ValidatePath(Player* pBot, float destX, float destY, float destZ);
+    void CancelPathRequest(Player* pBot);
     void GenerateWaypoints(Player* pBot);
+    void AppendSegments(Player* pBot, Vector3 const& from, Vector3 const& to, uint32& skippedWaypoints);
     void MoveToCurrentWaypoint(Player* pBot);
 
+    // Travel graph route of long trips
+    void PlanRoute(Player* pBot);
+    Vector3 GetFirstLegEnd() const;
+    void ReportStuckLeg(Player* pBot);
+
     // Danger zone avoidance
     void FilterWaypointsForDanger(Player* pBot);
     Vector3 CalculateDetourPoint(Player* pBot, Vector3 const& fromPoint,
                                   Vector3 const& blockedPoint,
                                   std::vector<DangerZone> const& dangers) const;
 
+    // Graph nodes to walk through, empty for short trips
+    std::vector<BotTravelStop> m_route;
+
     // Waypoint tracking
     std::vector<Vector3> m_waypoints;
     uint32 m_currentWaypoint = 0;
@@ -8,6 +8,8 @@
 
 #include "VendoringStrategy.h"
 #include "BotMovementManager.h"
+#include "BotPOIIndex.h"
+#include "BotProfiler.h"
 #include "Player.h"
 #include "Creature.h"
 #include "ObjectMgr.h"
@@ -19,7 +21,6 @@
 #include "DBCStructure.h"
 #include "SharedDefines.h"
 #include "Map.h"
-#include "ProgressBar.h"
 #include "Cell.h"
 #include "CellImpl.h"
 #include "GridNotifiers.h"
@@ -27,11 +28,6 @@
 #include <cmath>
 #include <cfloat>
 
-// Static member initialization
-std::vector<VendorLocation> VendoringStrategy::s_vendorCache;
-bool VendoringStrategy::s_cacheBuilt = false;
-std::mutex VendoringStrategy::s_cacheMutex;
-
 VendoringStrategy::VendoringStrategy()
     : m_state(VendorState::IDLE)
     , m_targetVendor{}
@@ -44,75 +40,6 @@ VendoringStrategy::VendoringStrategy()
 {
 }
 
-void VendoringStrategy::BuildVendorCache()
-{
-    std::lock_guard<std::mutex> lock(s_cacheMutex);
-
-    if (s_cacheBuilt)
-        return;
-
-    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[VendoringStrategy] Building vendor cache...");
-
-    // First pass: count all creature spawns for progress bar
-    uint32 totalCreatures = 0;
-    auto counter = [&totalCreatures](CreatureDataPair const& /*pair*/) {
-        ++totalCreatures;
-        return false; // continue iteration
-    };
-    sObjectMgr.DoCreatureData(counter);
-
-    // Create progress bar
-    BarGoLink bar(totalCreatures);
-
-    uint32 vendorCount = 0;
-    uint32 repairCount = 0;
-
-    // Second pass: find vendors with progress
-    auto vendorFinder = [&](CreatureDataPair const& pair) {
-        bar.step();
-
-        CreatureData const& data = pair.second;
-        uint32 guid = pair.first;
-
-        // Get creature template info
-        CreatureInfo const* info = sObjectMgr.GetCreatureTemplate(data.creature_id[0]);
-        if (!info)
-            return false; // continue
-
-        // Check if this NPC is a vendor
-        bool isVendor = (info->npc_flags & UNIT_NPC_FLAG_VENDOR) != 0;
-        bool canRepair = (info->npc_flags & UNIT_NPC_FLAG_REPAIR) != 0;
-
-        if (!isVendor && !canRepair)
-            return false; // continue - not a vendor
-
-        // Add to cache
-        VendorLocation loc;
-        loc.x = data.position.x;
-        loc.y = data.position.y;
-        loc.z = data.position.z;
-        loc.mapId = data.position.mapId;
-        loc.creatureEntry = data.creature_id[0];
-        loc.creatureGuid = guid;
-        loc.canRepair = canRepair;
-
-        s_vendorCache.push_back(loc);
-
-        vendorCount++;
-        if (canRepair)
-            repairCount++;
-
-        return false; // continue iteration
-    };
-
-    // Iterate all creature spawns (already loaded in memory)
-    sObjectMgr.DoCreatureData(vendorFinder);
-
-    s_cacheBuilt = true;
-    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, ">> Vendor cache built: %u vendors (%u can repair)",
-             vendorCount, repairCount);
-}
-
 bool VendoringStrategy::IsVendorFriendly(Player* pBot, uint32 creatureEntry)
 {
     if (!pBot)
@@ -138,47 +65,31 @@ bool VendoringStrategy::FindNearestVendor(Player* pBot)
     if (!pBot)
         return false;
 
-    // Build cache on first use
-    if (!s_cacheBuilt)
-        BuildVendorCache();
-
     float botX = pBot->GetPositionX();
     float botY = pBot->GetPositionY();
     uint32 botMap = pBot->GetMapId();
+    uint32 raceMask = pBot->GetRaceMask();
 
-    float closestDist = FLT_MAX;
-    VendorLocation const* nearest = nullptr;
-
-    // Search cache for nearest friendly vendor that can repair
-    for (VendorLocation const& loc : s_vendorCache)
+    // Nearest vendor that can repair (we want both sell + repair) and is
+    // friendly to the bot's faction
+    std::vector<BotPOIMatch> matches;
+    BotPOIIndex::FindNearest(BotPOIType::VENDOR, botMap, botX, botY, 1, [raceMask](BotPOI const& poi)
     {
-        // Must be on same map
-        if (loc.mapId != botMap)
-            continue;
-
-        // Must be able to repair (we want both sell + repair)
-        if (!loc.canRepair)
-            continue;
-
-        // Must be friendly to bot's faction
-        if (!IsVendorFriendly(pBot, loc.creatureEntry))
-            continue;
-
-        // Calculate 2D distance
-        float dx = loc.x - botX;
-        float dy = loc.y - botY;
-        float dist = std::sqrt(dx * dx + dy * dy);
+        return (poi.flags & BOT_POI_FLAG_REPAIR) && (poi.raceMask & raceMask);
+    }, matches);
 
-        if (dist < closestDist)
-        {
-            closestDist = dist;
-            nearest = &loc;
-        }
-    }
+    BotPOI const* nearest = matches.empty() ? nullptr : matches.front().poi;
 
     if (nearest)
     {
-        m_targetVendor = *nearest;
+        m_targetVendor.x = nearest->x;
+        m_targetVendor.y = nearest->y;
+        m_targetVendor.z = nearest->z;
+        m_targetVendor.mapId = nearest->mapId;
+        m_targetVendor.creatureEntry = nearest->entry;
+        m_targetVendor.creatureGuid = nearest->guid;
+        m_targetVendor.canRepair = (nearest->flags & BOT_POI_FLAG_REPAIR) != 0;
+        float closestDist = std::sqrt(matches.front().distSq);
         sLog.Out(LOG_BASIC, LOG_LVL_DEBUG, "[VendoringStrategy] Bot %s found vendor at (%.1f, %.1f, %.1f) map %u, distance: %.1f yards",
                  pBot->GetName(), m_targetVendor.x, m_targetVendor.y, m_targetVendor.z,
                  m_targetVendor.mapId, closestDist);
@@ -512,6 +423,8 @@ bool VendoringStrategy::DoVendorBusiness(Player* pBot)
 
 bool VendoringStrategy::Update(Player* pBot, uint32 diff)
 {
+    BotProfileScope profile(BOT_PROFILE_VENDORING);
+
     if (!pBot || !pBot->IsAlive())
     {
         Reset();
@@ -12,13 +12,12 @@
 
 #include "IBotStrategy.h"
 #include <vector>
-#include <mutex>
 
 class Player;
 class Creature;
 class BotMovementManager;
 
-// Cached vendor location data
+// Vendor the bot is heading to (from BotPOIIndex)
 struct VendorLocation
 {
     float x;
@@ -65,9 +64,6 @@ public:
     static float GetBagFullPercent(Player* pBot);
     static float GetLowestDurabilityPercent(Player* pBot);
 
-    // Pre-build vendor cache (call during server startup)
-    static void BuildVendorCache();
-
     // Set movement manager (called by RandomBotAI after construction)
     void SetMovementManager(BotMovementManager* pMoveMgr) { m_pMovementMgr = pMoveMgr; }
 
@@ -90,11 +86,6 @@ private:
     uint32 m_lastDistanceCheckTime;
     float m_lastDistanceToVendor;
 
-    // Vendor cache (static, shared across all bots)
-    static std::vector<VendorLocation> s_vendorCache;
-    static bool s_cacheBuilt;
-    static std::mutex s_cacheMutex;
-
     // Find nearest friendly vendor for this bot
     bool FindNearestVendor(Player* pBot);
 
@@ -0,0 +1,175 @@
+/*
+ * BotGearIndex.cpp
+ *
+ * Immutable index of random gear and ammo for bot auto-equip.
+ * Built once at server startup.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#include "BotGearIndex.h"
+#include "ObjectMgr.h"
+#include "ItemPrototype.h"
+#include "Log.h"
+#include <algorithm>
+#include <unordered_map>
+
+// ============================================================================
+// Static member initialization
+// ============================================================================
+
+std::vector<BotGearGroup> BotGearIndex::s_gearGroups[MAX_LEVEL + 1];
+std::vector<ItemPrototype const*> BotGearIndex::s_arrows;
+std::vector<ItemPrototype const*> BotGearIndex::s_bullets;
+bool BotGearIndex::s_indexBuilt = false;
+std::mutex BotGearIndex::s_indexMutex;
+
+// ============================================================================
+// Index Building
+// ============================================================================
+
+void BotGearIndex::Build()
+{
+    std::lock_guard<std::mutex> lock(s_indexMutex);
+
+    if (s_indexBuilt)
+        return;
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[BotGearIndex] Building gear index...");
+
+    BuildGearGroups();
+    BuildAmmo();
+
+    s_indexBuilt = true;
+}
+
+void BotGearIndex::BuildGearGroups()
+{
+    std::unordered_map<uint32 /*group key*/, uint32 /*group index*/> groupIndex[MAX_LEVEL + 1];
+    uint32 itemCount = 0;
+    uint32 entryCount = 0;
+
+    for (auto const& itr : sObjectMgr.GetItemPrototypeMap())
+    {
+        ItemPrototype const* pProto = &itr.second;
+
+        // Skip unobtainable items
+        if (pProto->HasExtraFlag(ITEM_EXTRA_NOT_OBTAINABLE))
+            continue;
+
+        // Only gear and weapons
+        if (pProto->Class != ITEM_CLASS_WEAPON && pProto->Class != ITEM_CLASS_ARMOR)
+            continue;
+
+        // No tabards and shirts
+        if (pProto->InventoryType == INVTYPE_TABARD || pProto->InventoryType == INVTYPE_BODY)
+            continue;
+
+        // Lowest level allowed to get the item
+        uint32 minLevel = pProto->RequiredLevel;
+        if (pProto->SourceQuestLevel < 0)
+        {
+            // Avoid higher level items with no level requirement
+            if (!pProto->RequiredLevel)
+                minLevel = pProto->ItemLevel;
+        }
+        else
+        {
+            // Item is from a high level quest
+            minLevel = std::max(minLevel, uint32(pProto->SourceQuestLevel));
+        }
+
+        // Low level items are filtered when queried, the allowed level
+        // difference can change on config reload
+        if (minLevel > MAX_LEVEL)
+            continue;
+
+        BotGearItem item;
+        item.pProto = pProto;
+        item.statMask = 0;
+        for (auto const& stat : pProto->ItemStat)
+        {
+            if (stat.ItemStatValue > 0 && stat.ItemStatType < 32)
+                item.statMask |= 1 << stat.ItemStatType;
+        }
+
+        uint32 const key = (pProto->InventoryType << 16) | (pProto->Class << 8) | pProto->SubClass;
+        for (uint32 level = minLevel; level <= MAX_LEVEL; ++level)
+        {
+            std::vector<BotGearGroup>& groups = s_gearGroups[level];
+            auto groupItr = groupIndex[level].find(key);
+            if (groupItr == groupIndex[level].end())
+            {
+                groupItr = groupIndex[level].emplace(key, uint32(groups.size())).first;
+                groups.push_back({ pProto, {} });
+            }
+
+            groups[groupItr->second].items.push_back(item);
+            ++entryCount;
+        }
+
+        ++itemCount;
+    }
+
+    // Highest item level first, so queries can stop at the first item
+    // that is too low for the bot
+    for (std::vector<BotGearGroup>& groups : s_gearGroups)
+    {
+        for (BotGearGroup& group : groups)
+        {
+            std::sort(group.items.begin(), group.items.end(), [](BotGearItem const& a, BotGearItem const& b)
+            {
+                if (a.pProto->ItemLevel != b.pProto->ItemLevel)
+                    return a.pProto->ItemLevel > b.pProto->ItemLevel;
+                return a.pProto->ItemId < b.pProto->ItemId;
+            });
+        }
+    }
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, ">> Gear index built: %u items in %u level buckets", itemCount, entryCount);
+}
+
+void BotGearIndex::BuildAmmo()
+{
+    for (auto const& itr : sObjectMgr.GetItemPrototypeMap())
+    {
+        ItemPrototype const* pProto = &itr.second;
+        if (pProto->Class != ITEM_CLASS_PROJECTILE)
+            continue;
+
+        if (pProto->SubClass == ITEM_SUBCLASS_ARROW)
+            s_arrows.push_back(pProto);
+        else if (pProto->SubClass == ITEM_SUBCLASS_BULLET)
+            s_bullets.push_back(pProto);
+    }
+
+    auto const higherLevel = [](ItemPrototype const* a, ItemPrototype const* b)
+    {
+        if (a->ItemLevel != b->ItemLevel)
+            return a->ItemLevel > b->ItemLevel;
+        return a->ItemId < b->ItemId;
+    };
+
+    std::sort(s_arrows.begin(), s_arrows.end(), higherLevel);
+    std::sort(s_bullets.begin(), s_bullets.end(), higherLevel);
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+std::vector<BotGearGroup> const& BotGearIndex::GetGearGroups(uint32 level)
+{
+    if (!s_indexBuilt)
+        Build();
+
+    return s_gearGroups[std::min<uint32>(level, MAX_LEVEL)];
+}
+
+std::vector<ItemPrototype const*> const& BotGearIndex::GetAmmo(uint32 subClass)
+{
+    if (!s_indexBuilt)
+        Build();
+
+    return subClass == ITEM_SUBCLASS_ARROW ? s_arrows : s_bullets;
+}
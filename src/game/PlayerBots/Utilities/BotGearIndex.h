@@ -0,0 +1,83 @@
+/*
+ * BotGearIndex.h
+ *
+ * Immutable index of the gear bots can be given by auto-equip. Built once
+ * at server startup from the item prototypes, then read by all bots
+ * without locking.
+ *
+ * Random gear is bucketed by bot level and then grouped by inventory
+ * type, item class and subclass, so a bot only looks at items of its
+ * level and skips whole groups it has no free slot or proficiency for.
+ * The bot independent filters (discovered, obtainable, required level)
+ * and the stats of each item are worked out while building. Items of a
+ * group are sorted by item level, highest first, so the configurable
+ * level difference is applied by the caller at query time.
+ *
+ * Also holds the best ammo of each type by item level.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#ifndef MANGOS_BOTGEARINDEX_H
+#define MANGOS_BOTGEARINDEX_H
+
+#include "Common.h"
+#include "DBCEnums.h"
+#include <mutex>
+#include <vector>
+
+struct ItemPrototype;
+
+// ============================================================================
+// Gear entries
+// ============================================================================
+
+struct BotGearItem
+{
+    ItemPrototype const* pProto;
+    uint32 statMask;            // bit ITEM_MOD_* set: item has that stat > 0
+};
+
+// Items of one inventory type, item class and subclass, highest item level first
+struct BotGearGroup
+{
+    ItemPrototype const* pFirst;    // any item of the group, for the shared checks
+    std::vector<BotGearItem> items;
+};
+
+// ============================================================================
+// BotGearIndex — Static index manager
+// ============================================================================
+
+class BotGearIndex
+{
+public:
+    // ---- Index building (called from PlayerBotMgr::Load) ----
+    static void Build();
+    static bool IsBuilt() { return s_indexBuilt; }
+
+    // ---- Queries ----
+
+    // Random gear candidates for a bot of this level
+    static std::vector<BotGearGroup> const& GetGearGroups(uint32 level);
+
+    // Ammo of a projectile subclass, highest item level first
+    static std::vector<ItemPrototype const*> const& GetAmmo(uint32 subClass);
+
+    static bool HasStat(BotGearItem const& item, uint32 statType)
+    {
+        return statType < 32 && (item.statMask & (1 << statType));
+    }
+
+private:
+    static void BuildGearGroups();
+    static void BuildAmmo();
+
+    static std::vector<BotGearGroup> s_gearGroups[MAX_LEVEL + 1];
+    static std::vector<ItemPrototype const*> s_arrows;
+    static std::vector<ItemPrototype const*> s_bullets;
+    static bool s_indexBuilt;
+    static std::mutex s_indexMutex;
+};
+
+#endif // MANGOS_BOTGEARINDEX_H
@@ -0,0 +1,138 @@
+/*
+ * BotGrindTargetCache.cpp
+ *
+ * Per-map cache of grind target candidates and bot target claims.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#include "BotGrindTargetCache.h"
+#include "Creature.h"
+#include "Map.h"
+#include "GridNotifiers.h"
+#include "CellImpl.h"
+#include "Timer.h"
+
+// ============================================================================
+// Candidates
+// ============================================================================
+
+void BotGrindTargetCache::NewPass()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    ++m_pass;
+
+    if (m_pass % PURGE_INTERVAL_PASSES == 0)
+        Purge();
+}
+
+std::vector<BotGrindCandidate> const& BotGrindTargetCache::GetCell(Map& map, uint32 cellX, uint32 cellY)
+{
+    static std::vector<BotGrindCandidate> const empty;
+    if (cellX >= TOTAL_NUMBER_OF_CELLS_PER_MAP || cellY >= TOTAL_NUMBER_OF_CELLS_PER_MAP)
+        return empty;
+
+    std::lock_guard<std::mutex> guard(m_lock);
+    CellCandidates& cell = m_cells[cellX * TOTAL_NUMBER_OF_CELLS_PER_MAP + cellY];
+    if (cell.pass == m_pass)
+    {
+        ++m_cellHits;
+        return cell.candidates;
+    }
+
+    ++m_cellScans;
+    cell.pass = m_pass;
+    cell.candidates.clear();
+
+    // Only checks that hold for every bot, the rest is up to GrindingStrategy
+    auto collect = [&cell](Creature* pCreature)
+    {
+        if (!pCreature->IsAlive() || pCreature->IsTotem())
+            return;
+
+        // Skip critters (rabbits, squirrels, etc.)
+        if (pCreature->GetCreatureInfo()->type == CREATURE_TYPE_CRITTER)
+            return;
+
+        cell.candidates.push_back({ pCreature, pCreature->GetLevel() });
+    };
+
+    Cell gridCell(CellPair(cellX, cellY));
+    gridCell.SetNoCreate();
+    MaNGOS::CreatureWorker<decltype(collect)> worker(nullptr, collect);
+    TypeContainerVisitor<MaNGOS::CreatureWorker<decltype(collect)>, GridTypeMapContainer> visitor(worker);
+    map.Visit(gridCell, visitor);
+
+    std::sort(cell.candidates.begin(), cell.candidates.end(),
+        [](BotGrindCandidate const& a, BotGrindCandidate const& b) { return a.level < b.level; });
+
+    return cell.candidates;
+}
+
+void BotGrindTargetCache::Purge()
+{
+    for (auto itr = m_cells.begin(); itr != m_cells.end();)
+    {
+        if (m_pass - itr->second.pass >= PURGE_INTERVAL_PASSES)
+            itr = m_cells.erase(itr);
+        else
+            ++itr;
+    }
+
+    for (auto itr = m_claims.begin(); itr != m_claims.end();)
+    {
+        if (WorldTimer::getMSTimeDiffToNow(itr->second.claimTime) > CLAIM_TIMEOUT_MS)
+            itr = m_claims.erase(itr);
+        else
+            ++itr;
+    }
+}
+
+// ============================================================================
+// Claims
+// ============================================================================
+
+bool BotGrindTargetCache::Claim(ObjectGuid creatureGuid, ObjectGuid botGuid)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    if (IsClaimedByOtherLocked(creatureGuid, botGuid))
+        return false;
+
+    m_claims[creatureGuid] = { botGuid, WorldTimer::getMSTime() };
+    return true;
+}
+
+void BotGrindTargetCache::Release(ObjectGuid creatureGuid, ObjectGuid botGuid)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    auto itr = m_claims.find(creatureGuid);
+    if (itr != m_claims.end() && itr->second.botGuid == botGuid)
+        m_claims.erase(itr);
+}
+
+bool BotGrindTargetCache::IsClaimedByOther(ObjectGuid creatureGuid, ObjectGuid botGuid) const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return IsClaimedByOtherLocked(creatureGuid, botGuid);
+}
+
+uint64 BotGrindTargetCache::GetCellScans() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_cellScans;
+}
+
+uint64 BotGrindTargetCache::GetCellHits() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_cellHits;
+}
+
+bool BotGrindTargetCache::IsClaimedByOtherLocked(ObjectGuid creatureGuid, ObjectGuid botGuid) const
+{
+    auto itr = m_claims.find(creatureGuid);
+    if (itr == m_claims.end() || itr->second.botGuid == botGuid)
+        return false;
+
+    return WorldTimer::getMSTimeDiffToNow(itr->second.claimTime) <= CLAIM_TIMEOUT_MS;
+}
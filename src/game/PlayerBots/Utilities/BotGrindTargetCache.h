@@ -0,0 +1,124 @@
+/*
+ * BotGrindTargetCache.h
+ *
+ * Per-map cache of grind target candidates, shared by all bots on the map.
+ *
+ * Bots grinding the same area used to visit the same grid cells every
+ * tick. Here each cell is visited at most once per player update pass:
+ * the first bot to search it stores the creatures any bot could grind
+ * (alive, not a totem or critter), sorted by level, and every other bot
+ * reads that list and only applies its own level band and checks.
+ *
+ * Claims: a bot that engages a mob claims it, and other bots skip
+ * claimed mobs, so several bots don't pull the same one. Claims are
+ * released when the bot drops its target and expire on their own if the
+ * bot goes away without releasing.
+ *
+ * Owned by the Map. Locked, since the players of a continent may be
+ * updated by several threads (MapUpdate.Continents.MTPlayers). A cell's
+ * list is only rebuilt on the first search of a pass, so the lists handed
+ * out stay unchanged until the next NewPass().
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#ifndef MANGOS_BOTGRINDTARGETCACHE_H
+#define MANGOS_BOTGRINDTARGETCACHE_H
+
+#include "Common.h"
+#include "ObjectGuid.h"
+#include "Cell.h"
+#include "GridDefines.h"
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+class Creature;
+class Map;
+
+struct BotGrindCandidate
+{
+    Creature* pCreature;
+    uint32 level;
+};
+
+class BotGrindTargetCache
+{
+public:
+    // Start of a player update pass, cells scanned before are stale
+    void NewPass();
+
+    // Candidates with minLevel <= level <= maxLevel in the cells a search
+    // of range around (x, y) covers. Pointers are valid for this pass only.
+    template<typename Visitor>
+    void DoCandidates(Map& map, float x, float y, float range, uint32 minLevel, uint32 maxLevel, Visitor const& visitor);
+
+    // ---- Claims ----
+
+    // Returns false if another bot holds the creature
+    bool Claim(ObjectGuid creatureGuid, ObjectGuid botGuid);
+    void Release(ObjectGuid creatureGuid, ObjectGuid botGuid);
+    bool IsClaimedByOther(ObjectGuid creatureGuid, ObjectGuid botGuid) const;
+
+    // ---- Stats ----
+    uint64 GetCellScans() const;
+    uint64 GetCellHits() const;
+
+private:
+    struct CellCandidates
+    {
+        uint32 pass = 0;
+        std::vector<BotGrindCandidate> candidates;  // sorted by level
+    };
+
+    struct ClaimEntry
+    {
+        ObjectGuid botGuid;
+        uint32 claimTime;
+    };
+
+    std::vector<BotGrindCandidate> const& GetCell(Map& map, uint32 cellX, uint32 cellY);
+    bool IsClaimedByOtherLocked(ObjectGuid creatureGuid, ObjectGuid botGuid) const;
+    void Purge();
+
+    mutable std::mutex m_lock;
+
+    std::unordered_map<uint32 /*cell id*/, CellCandidates> m_cells;
+    std::unordered_map<ObjectGuid, ClaimEntry> m_claims;
+    uint32 m_pass = 0;
+    uint64 m_cellScans = 0;
+    uint64 m_cellHits = 0;
+
+    // Longer than GrindingStrategy's approach timeout and a typical fight
+    static constexpr uint32 CLAIM_TIMEOUT_MS = 120000;
+
+    // Cells unused for this many passes and expired claims are dropped
+    static constexpr uint32 PURGE_INTERVAL_PASSES = 1024;
+};
+
+template<typename Visitor>
+void BotGrindTargetCache::DoCandidates(Map& map, float x, float y, float range, uint32 minLevel, uint32 maxLevel, Visitor const& visitor)
+{
+    CellArea const area = Cell::CalculateCellArea(x, y, range);
+    CellPair const standing = MaNGOS::ComputeCellPair(x, y);
+
+    // Same cells as Cell::Visit: the standing cell alone if the range fits in it
+    CellPair const low = !area ? standing : area.low_bound;
+    CellPair const high = !area ? standing : area.high_bound;
+
+    for (uint32 cellX = low.x_coord; cellX <= high.x_coord; ++cellX)
+    {
+        for (uint32 cellY = low.y_coord; cellY <= high.y_coord; ++cellY)
+        {
+            std::vector<BotGrindCandidate> const& candidates = GetCell(map, cellX, cellY);
+
+            auto itr = std::lower_bound(candidates.begin(), candidates.end(), minLevel,
+                [](BotGrindCandidate const& candidate, uint32 level) { return candidate.level < level; });
+            for (; itr != candidates.end() && itr->level <= maxLevel; ++itr)
+                visitor(itr->pCreature);
+        }
+    }
+}
+
+#endif // MANGOS_BOTGRINDTARGETCACHE_H
@@ -0,0 +1,196 @@
+/*
+ * BotGroupStateCache.cpp
+ *
+ * Per-map snapshot of group members for healer and support bot target
+ * selection.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#include "BotGroupStateCache.h"
+#include "Group.h"
+#include "Map.h"
+#include "Player.h"
+#include "Pet.h"
+#include "SpellAuras.h"
+#include <algorithm>
+
+// ============================================================================
+// View
+// ============================================================================
+
+void BotGroupStateView::Refresh(Group* pGroup, Map const& map)
+{
+    m_members.clear();
+    m_byHealth.clear();
+    m_targets.clear();
+    m_missingBuffs.clear();
+
+    for (GroupReference* itr = pGroup->GetFirstMember(); itr != nullptr; itr = itr->next())
+    {
+        Player* pPlayer = itr->getSource();
+        if (!pPlayer || pPlayer->FindMap() != &map)
+            continue;
+
+        // Missing buff masks have a bit per member
+        if (m_members.size() == 64)
+            break;
+
+        BotGroupMember member;
+        member.pPlayer = pPlayer;
+        member.pPet = pPlayer->GetPet();
+        member.guid = pPlayer->GetObjectGuid();
+        member.targetGuid = pPlayer->GetTargetGuid();
+        member.healthPercent = pPlayer->GetHealthPercent();
+        member.isMeleeAttacking = pPlayer->HasUnitState(UNIT_STATE_MELEE_ATTACKING);
+        member.isCasting = pPlayer->IsNonMeleeSpellCasted();
+        member.isCharmed = !pPlayer->GetCharmerGuid().IsEmpty();
+        member.isGameMaster = pPlayer->IsGameMaster();
+
+        Item* pOffHand = pPlayer->GetItemByPos(INVENTORY_SLOT_BAG_0, EQUIPMENT_SLOT_OFFHAND);
+        member.isTank = IsTankingForm(pPlayer->GetShapeshiftForm()) ||
+                       (pOffHand && pOffHand->GetProto()->InventoryType == INVTYPE_SHIELD);
+
+        // Same rules as CombatBotBaseAI::IsValidDispelTarget on a friendly target
+        member.dispelMask = 0;
+        for (auto const& aura : pPlayer->GetSpellAuraHolderMap())
+        {
+            SpellAuraHolder const* holder = aura.second;
+            uint32 const dispel = holder->GetSpellProto()->Dispel;
+            if (dispel == DISPEL_MAGIC || dispel == DISPEL_DISEASE || dispel == DISPEL_POISON)
+            {
+                if (holder->IsPositive())
+                    continue;
+            }
+            member.dispelMask |= 1 << dispel;
+        }
+
+        m_members.push_back(member);
+        AddTarget(member);
+    }
+
+    m_byHealth.resize(m_members.size());
+    for (uint32 i = 0; i < m_members.size(); ++i)
+        m_byHealth[i] = uint8(i);
+
+    std::stable_sort(m_byHealth.begin(), m_byHealth.end(), [this](uint8 a, uint8 b)
+    {
+        return m_members[a].healthPercent < m_members[b].healthPercent;
+    });
+}
+
+BotGroupMember const* BotGroupStateView::FindMember(ObjectGuid guid) const
+{
+    for (BotGroupMember const& member : m_members)
+    {
+        if (member.guid == guid)
+            return &member;
+    }
+    return nullptr;
+}
+
+void BotGroupStateView::AddTarget(BotGroupMember const& member)
+{
+    // Not the target itself
+    if (member.targetGuid.IsEmpty() || member.targetGuid == member.guid)
+        return;
+
+    TargetCounts& counts = m_targets[member.targetGuid];
+    if (member.isMeleeAttacking)
+        ++counts.melee;
+    if (member.isCasting)
+        ++counts.casting;
+}
+
+void BotGroupStateView::RemoveTarget(BotGroupMember const& member)
+{
+    if (member.targetGuid.IsEmpty() || member.targetGuid == member.guid)
+        return;
+
+    auto itr = m_targets.find(member.targetGuid);
+    if (itr == m_targets.end())
+        return;
+
+    if (member.isMeleeAttacking && itr->second.melee)
+        --itr->second.melee;
+    if (member.isCasting && itr->second.casting)
+        --itr->second.casting;
+}
+
+uint32 BotGroupStateView::GetMeleeAttackers(ObjectGuid guid) const
+{
+    auto itr = m_targets.find(guid);
+    return itr != m_targets.end() ? itr->second.melee : 0;
+}
+
+uint32 BotGroupStateView::GetSpellCasters(ObjectGuid guid) const
+{
+    auto itr = m_targets.find(guid);
+    return itr != m_targets.end() ? itr->second.casting : 0;
+}
+
+void BotGroupStateView::UpdateMemberTarget(Player const* pPlayer)
+{
+    for (BotGroupMember& member : m_members)
+    {
+        if (member.pPlayer != pPlayer)
+            continue;
+
+        RemoveTarget(member);
+        member.targetGuid = pPlayer->GetTargetGuid();
+        member.isMeleeAttacking = pPlayer->HasUnitState(UNIT_STATE_MELEE_ATTACKING);
+        member.isCasting = pPlayer->IsNonMeleeSpellCasted();
+        AddTarget(member);
+        return;
+    }
+}
+
+uint64 const* BotGroupStateView::FindMissingBuffMask(uint32 spellId) const
+{
+    auto itr = m_missingBuffs.find(spellId);
+    return itr != m_missingBuffs.end() ? &itr->second : nullptr;
+}
+
+void BotGroupStateView::ClearMissingBuff(uint32 spellId, uint8 memberIndex)
+{
+    auto itr = m_missingBuffs.find(spellId);
+    if (itr != m_missingBuffs.end())
+        itr->second &= ~(uint64(1) << memberIndex);
+}
+
+// ============================================================================
+// Cache
+// ============================================================================
+
+void BotGroupStateCache::NewPass()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    ++m_pass;
+
+    if (m_pass % PURGE_INTERVAL_PASSES)
+        return;
+
+    for (auto itr = m_views.begin(); itr != m_views.end();)
+    {
+        if (m_pass - itr->second.m_pass >= PURGE_INTERVAL_PASSES)
+            itr = m_views.erase(itr);
+        else
+            ++itr;
+    }
+}
+
+BotGroupStateView& BotGroupStateCache::GetView(Group* pGroup, Map const& map)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    BotGroupStateView& view = m_views[pGroup->GetId()];
+    if (view.m_pass == m_pass)
+    {
+        ++m_hits;
+        return view;
+    }
+
+    ++m_refreshes;
+    view.m_pass = m_pass;
+    view.Refresh(pGroup, map);
+    return view;
+}
@@ -0,0 +1,123 @@
+/*
+ * BotGroupStateCache.h
+ *
+ * Per-map snapshot of each group's members, shared by all bots of the
+ * group on the map.
+ *
+ * Healer and support bots used to walk the whole group several times per
+ * tick (heal, HoT, pre-heal, buff and dispel targets), and the heal
+ * target search asked for every member whether another healer was on it,
+ * which walked the group again. A view is now taken once per player
+ * update pass by the first bot that asks for it:
+ *   - members sorted by health percent, lowest first
+ *   - per member dispel mask of the auras a friendly dispel removes
+ *   - per buff spell, the members still missing it (filled on first use)
+ *   - per target, how many members melee it or cast at it
+ * Bots only do their own range and line of sight checks on the members
+ * the view points them to, and validate the chosen one live.
+ *
+ * Only members on the same map are included. Owned by the Map. The view
+ * list is locked, since the players of a continent may be updated by
+ * several threads (MapUpdate.Continents.MTPlayers); a view itself is not,
+ * as the members of a group on the map are all updated by the same thread.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#ifndef MANGOS_BOTGROUPSTATECACHE_H
+#define MANGOS_BOTGROUPSTATECACHE_H
+
+#include "Common.h"
+#include "ObjectGuid.h"
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+class Group;
+class Map;
+class Player;
+class Unit;
+
+struct BotGroupMember
+{
+    Player* pPlayer;
+    Unit* pPet;
+    ObjectGuid guid;
+    ObjectGuid targetGuid;
+    float healthPercent;
+    uint32 dispelMask;          // bit DispelType set: has an aura a friendly dispel of that type removes
+    bool isMeleeAttacking;
+    bool isCasting;
+    bool isTank;                // in a tanking form or wearing a shield
+    bool isCharmed;
+    bool isGameMaster;
+};
+
+class BotGroupStateView
+{
+public:
+    // Members in group order
+    std::vector<BotGroupMember> const& GetMembers() const { return m_members; }
+
+    // Member indices by health percent at refresh, lowest first
+    std::vector<uint8> const& GetByHealth() const { return m_byHealth; }
+
+    BotGroupMember const* FindMember(ObjectGuid guid) const;
+
+    // Members targeting guid while meleeing / casting, excluding the target itself
+    uint32 GetMeleeAttackers(ObjectGuid guid) const;
+    uint32 GetSpellCasters(ObjectGuid guid) const;
+
+    // Re-read a member's target after it acted this pass
+    void UpdateMemberTarget(Player const* pPlayer);
+
+    // Bit per member index, set when the member lacks the buff, nullptr if not known yet
+    uint64 const* FindMissingBuffMask(uint32 spellId) const;
+    void SetMissingBuffMask(uint32 spellId, uint64 mask) { m_missingBuffs[spellId] = mask; }
+    void ClearMissingBuff(uint32 spellId, uint8 memberIndex);
+
+private:
+    friend class BotGroupStateCache;
+
+    struct TargetCounts
+    {
+        uint8 melee = 0;
+        uint8 casting = 0;
+    };
+
+    void Refresh(Group* pGroup, Map const& map);
+    void AddTarget(BotGroupMember const& member);
+    void RemoveTarget(BotGroupMember const& member);
+
+    std::vector<BotGroupMember> m_members;
+    std::vector<uint8> m_byHealth;
+    std::unordered_map<ObjectGuid, TargetCounts> m_targets;
+    std::unordered_map<uint32 /*spell id*/, uint64> m_missingBuffs;
+    uint32 m_pass = 0;
+};
+
+class BotGroupStateCache
+{
+public:
+    // Start of a player update pass, views taken before are stale
+    void NewPass();
+
+    // View of the group, refreshed on first use in this pass
+    BotGroupStateView& GetView(Group* pGroup, Map const& map);
+
+    // ---- Stats ----
+    uint64 GetRefreshes() const { return m_refreshes; }
+    uint64 GetHits() const { return m_hits; }
+
+private:
+    std::mutex m_lock;
+    std::unordered_map<uint32 /*group id*/, BotGroupStateView> m_views;
+    uint32 m_pass = 1;
+    uint64 m_refreshes = 0;
+    uint64 m_hits = 0;
+
+    // Views of groups unused for this many passes are dropped
+    static constexpr uint32 PURGE_INTERVAL_PASSES = 1024;
+};
+
+#endif // MANGOS_BOTGROUPSTATECACHE_H
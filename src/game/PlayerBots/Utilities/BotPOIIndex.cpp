@@ -0,0 +1,274 @@
+/*
+ * BotPOIIndex.cpp
+ *
+ * Immutable index of vendors, class trainers and grind spots.
+ * Built once at server startup.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#include "BotPOIIndex.h"
+#include "BotSpawnIndex.h"
+#include "ObjectMgr.h"
+#include "DBCStores.h"
+#include "MapManager.h"
+#include "Map.h"
+#include "Log.h"
+#include "Database/DatabaseEnv.h"
+
+// ============================================================================
+// Static member initialization
+// ============================================================================
+
+std::unordered_map<uint64, BotPOIIndex::Layer> BotPOIIndex::s_layers;
+std::vector<std::string> BotPOIIndex::s_names;
+uint32 BotPOIIndex::s_counts[uint8(BotPOIType::MAX)] = {};
+bool BotPOIIndex::s_indexBuilt = false;
+std::mutex BotPOIIndex::s_indexMutex;
+
+constexpr float BotPOIIndex::CELL_SIZE;
+constexpr int32 BotPOIIndex::MAX_CELLS_PER_AXIS;
+constexpr uint32 BotPOIIndex::NO_NAME;
+
+// ============================================================================
+// Masks
+// ============================================================================
+
+uint64 BotPOIIndex::LevelBand(uint32 minLevel, uint32 maxLevel)
+{
+    uint64 mask = 0;
+    for (uint32 level = minLevel; level <= maxLevel && level < 64; ++level)
+        mask |= LevelBit(level);
+    return mask;
+}
+
+// Races of players not hostile to an NPC faction template
+static uint32 GetFriendlyRaceMask(uint32 factionTemplateId)
+{
+    FactionTemplateEntry const* npcFaction = sObjectMgr.GetFactionTemplateEntry(factionTemplateId);
+    if (!npcFaction)
+        return 0;
+
+    uint32 mask = 0;
+    for (uint32 race = 1; race < MAX_RACES; ++race)
+    {
+        ChrRacesEntry const* raceEntry = sChrRacesStore.LookupEntry(race);
+        if (!raceEntry)
+            continue;
+
+        FactionTemplateEntry const* playerFaction = sObjectMgr.GetFactionTemplateEntry(raceEntry->FactionID);
+        if (playerFaction && !playerFaction->IsHostileTo(*npcFaction))
+            mask |= 1 << (race - 1);
+    }
+
+    return mask;
+}
+
+// ============================================================================
+// Index Building
+// ============================================================================
+
+void BotPOIIndex::Build()
+{
+    std::lock_guard<std::mutex> lock(s_indexMutex);
+
+    if (s_indexBuilt)
+        return;
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[BotPOIIndex] Building POI index...");
+
+    std::unordered_map<uint64, std::vector<BotPOI>> pending;
+    CollectCreatures(pending);
+    CollectGrindSpots(pending);
+
+    for (auto& itr : pending)
+        BuildLayer(s_layers[itr.first], itr.second);
+
+    s_indexBuilt = true;
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, ">> POI index built: %u vendors, %u class trainers, %u grind spots in %zu map layers",
+        GetCount(BotPOIType::VENDOR), GetCount(BotPOIType::TRAINER), GetCount(BotPOIType::GRIND_SPOT), s_layers.size());
+}
+
+void BotPOIIndex::CollectCreatures(std::unordered_map<uint64, std::vector<BotPOI>>& pending)
+{
+    // Spawns come from the shared spawn index, so the template check runs
+    // once per creature entry instead of once per spawn
+    BotSpawnIndex::Build();
+
+    std::unordered_map<uint32 /*faction template*/, uint32 /*race mask*/> friendlyRaces;
+
+    auto creatureFinder = [&](uint32 entry, BotSpawnList const& spawns) {
+        CreatureInfo const* info = sObjectMgr.GetCreatureTemplate(entry);
+        if (!info)
+            return;
+
+        bool const isVendor = (info->npc_flags & (UNIT_NPC_FLAG_VENDOR | UNIT_NPC_FLAG_REPAIR)) != 0;
+
+        // trainer_type: 0 = class trainer, 1 = mount trainer, 2 = tradeskill trainer
+        bool const isTrainer = info->trainer_type == 0 && info->trainer_class != 0 &&
+            (info->npc_flags & UNIT_NPC_FLAG_TRAINER);
+
+        if (!isVendor && !isTrainer)
+            return;
+
+        auto raceItr = friendlyRaces.find(info->faction);
+        if (raceItr == friendlyRaces.end())
+            raceItr = friendlyRaces.emplace(info->faction, GetFriendlyRaceMask(info->faction)).first;
+
+        BotPOI poi = {};
+        poi.entry = entry;
+        poi.levelMask = ~uint64(0);
+        poi.raceMask = raceItr->second;
+        poi.flags = (info->npc_flags & UNIT_NPC_FLAG_REPAIR) ? BOT_POI_FLAG_REPAIR : 0;
+        poi.trainerClass = info->trainer_class;
+        poi.trainerId = info->trainer_id;
+        poi.nameIndex = NO_NAME;
+
+        for (BotSpawnPoint const& spawn : spawns)
+        {
+            poi.x = spawn.x;
+            poi.y = spawn.y;
+            poi.z = spawn.z;
+            poi.mapId = spawn.mapId;
+            poi.guid = spawn.guid;
+
+            if (isVendor)
+            {
+                pending[MakeKey(BotPOIType::VENDOR, spawn.mapId)].push_back(poi);
+                ++s_counts[uint8(BotPOIType::VENDOR)];
+            }
+            if (isTrainer)
+            {
+                pending[MakeKey(BotPOIType::TRAINER, spawn.mapId)].push_back(poi);
+                ++s_counts[uint8(BotPOIType::TRAINER)];
+            }
+        }
+    };
+
+    BotSpawnIndex::DoCreatureEntries(creatureFinder);
+}
+
+void BotPOIIndex::CollectGrindSpots(std::unordered_map<uint64, std::vector<BotPOI>>& pending)
+{
+    std::unique_ptr<QueryResult> result(CharacterDatabase.PQuery(
+        "SELECT id, map_id, x, y, z, min_level, max_level, faction, priority, name "
+        "FROM grind_spots ORDER BY priority DESC"));
+
+    if (!result)
+    {
+        sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, ">> Grind spots: 0 loaded (table empty or missing)");
+        return;
+    }
+
+    uint32 correctedCount = 0;
+
+    do
+    {
+        Field* fields = result->Fetch();
+
+        BotPOI poi = {};
+        poi.guid      = fields[0].GetUInt32();
+        poi.mapId     = fields[1].GetUInt32();
+        poi.x         = fields[2].GetFloat();
+        poi.y         = fields[3].GetFloat();
+        poi.z         = fields[4].GetFloat();
+        poi.levelMask = LevelBand(fields[5].GetUInt8(), fields[6].GetUInt8());
+        poi.priority  = fields[8].GetUInt8();
+        poi.nameIndex = uint32(s_names.size());
+
+        // faction: 0=both, 1=alliance, 2=horde
+        switch (fields[7].GetUInt8())
+        {
+            case 1:  poi.raceMask = RACEMASK_ALLIANCE; break;
+            case 2:  poi.raceMask = RACEMASK_HORDE; break;
+            default: poi.raceMask = RACEMASK_ALL_PLAYABLE; break;
+        }
+
+        s_names.push_back(fields[9].GetCppString());
+
+        // Correct Z coordinates using terrain data (instanceId 0 for continents)
+        if (Map* map = sMapMgr.FindMap(poi.mapId, 0))
+        {
+            float terrainZ = map->GetHeight(poi.x, poi.y, poi.z + 10.0f);
+            if (terrainZ > INVALID_HEIGHT && std::abs(terrainZ - poi.z) > 1.0f)
+            {
+                poi.z = terrainZ;
+                ++correctedCount;
+            }
+        }
+
+        pending[MakeKey(BotPOIType::GRIND_SPOT, poi.mapId)].push_back(poi);
+        ++s_counts[uint8(BotPOIType::GRIND_SPOT)];
+    }
+    while (result->NextRow());
+
+    if (correctedCount > 0)
+        sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, ">> Grind spots: %u Z-coordinates corrected", correctedCount);
+}
+
+void BotPOIIndex::BuildLayer(Layer& layer, std::vector<BotPOI>& pois)
+{
+    float maxX = -FLT_MAX;
+    float maxY = -FLT_MAX;
+    layer.minX = FLT_MAX;
+    layer.minY = FLT_MAX;
+
+    for (BotPOI const& poi : pois)
+    {
+        layer.minX = std::min(layer.minX, poi.x);
+        layer.minY = std::min(layer.minY, poi.y);
+        maxX = std::max(maxX, poi.x);
+        maxY = std::max(maxY, poi.y);
+    }
+
+    layer.cols = std::min(int32((maxX - layer.minX) / CELL_SIZE) + 1, MAX_CELLS_PER_AXIS);
+    layer.rows = std::min(int32((maxY - layer.minY) / CELL_SIZE) + 1, MAX_CELLS_PER_AXIS);
+
+    auto cellOf = [&layer](BotPOI const& poi) -> uint32
+    {
+        int32 const cellX = std::min(int32((poi.x - layer.minX) / CELL_SIZE), layer.cols - 1);
+        int32 const cellY = std::min(int32((poi.y - layer.minY) / CELL_SIZE), layer.rows - 1);
+        return uint32(cellY * layer.cols + cellX);
+    };
+
+    // Counting sort by cell
+    uint32 const cellCount = uint32(layer.cols * layer.rows);
+    layer.cellStart.assign(cellCount + 1, 0);
+    for (BotPOI const& poi : pois)
+        ++layer.cellStart[cellOf(poi) + 1];
+    for (uint32 cell = 0; cell < cellCount; ++cell)
+        layer.cellStart[cell + 1] += layer.cellStart[cell];
+
+    std::vector<uint32> fill(layer.cellStart.begin(), layer.cellStart.end() - 1);
+    layer.pois.resize(pois.size());
+    for (BotPOI const& poi : pois)
+        layer.pois[fill[cellOf(poi)]++] = poi;
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+BotPOIIndex::Layer const* BotPOIIndex::FindLayer(BotPOIType type, uint32 mapId)
+{
+    auto itr = s_layers.find(MakeKey(type, mapId));
+    return itr != s_layers.end() ? &itr->second : nullptr;
+}
+
+std::vector<BotPOI> const& BotPOIIndex::GetAll(BotPOIType type, uint32 mapId)
+{
+    static std::vector<BotPOI> const empty;
+
+    if (!s_indexBuilt)
+        Build();
+
+    Layer const* layer = FindLayer(type, mapId);
+    return layer ? layer->pois : empty;
+}
+
+std::string const& BotPOIIndex::GetName(BotPOI const& poi)
+{
+    static std::string const empty;
+    return poi.nameIndex != NO_NAME && poi.nameIndex < s_names.size() ? s_names[poi.nameIndex] : empty;
+}
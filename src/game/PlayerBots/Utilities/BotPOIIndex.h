@@ -0,0 +1,213 @@
+/*
+ * BotPOIIndex.h
+ *
+ * Immutable index of the places bots travel to: repair/sell vendors,
+ * class trainers and grind spots. Built once at server startup, then read
+ * by all bots without locking.
+ *
+ * POIs are partitioned by type and map, and each partition is bucketed
+ * into a 2D grid of CELL_SIZE cells. Every entry carries a race mask (the
+ * races it serves: friendly NPC or matching grind spot faction) and a
+ * level-band mask, so the common filters are two bit tests.
+ *
+ * FindNearest() walks grid rings outward from the query point and stops
+ * once no unvisited cell can beat the k-th best match.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#ifndef MANGOS_BOTPOIINDEX_H
+#define MANGOS_BOTPOIINDEX_H
+
+#include "Common.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+enum class BotPOIType : uint8
+{
+    VENDOR,
+    TRAINER,
+    GRIND_SPOT,
+
+    MAX
+};
+
+enum BotPOIFlags : uint8
+{
+    BOT_POI_FLAG_REPAIR     = 0x01,     // vendor with UNIT_NPC_FLAG_REPAIR
+};
+
+// ============================================================================
+// POI entry
+// ============================================================================
+
+struct BotPOI
+{
+    float x, y, z;
+    uint32 mapId;
+    uint32 guid;                // creature spawn guid, grind_spots.id for grind spots
+    uint32 entry;               // creature entry, 0 for grind spots
+    uint64 levelMask;           // bit L set: usable by level L bots
+    uint32 raceMask;            // races served (1 << (race - 1))
+    uint32 trainerId;           // trainers: npc_trainer_template id
+    uint32 nameIndex;           // grind spots: index into the name table
+    uint8 flags;                // BotPOIFlags
+    uint8 trainerClass;         // trainers: class taught
+    uint8 priority;             // grind spots: grind_spots.priority
+};
+
+struct BotPOIMatch
+{
+    BotPOI const* poi;
+    float distSq;
+};
+
+// ============================================================================
+// BotPOIIndex — Static index manager
+// ============================================================================
+
+class BotPOIIndex
+{
+public:
+    // ---- Index building (called from PlayerBotMgr::Load) ----
+    static void Build();
+    static bool IsBuilt() { return s_indexBuilt; }
+
+    // ---- Masks ----
+    static uint64 LevelBit(uint32 level) { return level < 64 ? uint64(1) << level : 0; }
+    static uint64 LevelBand(uint32 minLevel, uint32 maxLevel);
+
+    // POI serves a bot of this race mask and level
+    static bool Serves(BotPOI const& poi, uint32 raceMask, uint32 level)
+    {
+        return (poi.raceMask & raceMask) && (poi.levelMask & LevelBit(level));
+    }
+
+    // ---- Queries ----
+
+    // Up to k POIs of a type on a map, nearest to (x, y) first (2D), that
+    // pass filter (bool(BotPOI const&)). maxDist 0 means unbounded.
+    // Replaces the content of result, returns the number found.
+    template<typename Filter>
+    static uint32 FindNearest(BotPOIType type, uint32 mapId, float x, float y, uint32 k,
+        Filter const& filter, std::vector<BotPOIMatch>& result, float maxDist = 0.0f);
+
+    static std::string const& GetName(BotPOI const& poi);
+
+    // Every POI of a type on a map, in no particular order
+    static std::vector<BotPOI> const& GetAll(BotPOIType type, uint32 mapId);
+
+    // ---- Stats for logging ----
+    static uint32 GetCount(BotPOIType type) { return s_counts[uint8(type)]; }
+
+private:
+    // All POIs of one type on one map. pois is ordered by cell,
+    // cellStart[c]..cellStart[c + 1] are the POIs of cell c.
+    struct Layer
+    {
+        float minX = 0.0f;
+        float minY = 0.0f;
+        int32 cols = 0;
+        int32 rows = 0;
+        std::vector<uint32> cellStart;
+        std::vector<BotPOI> pois;
+    };
+
+    static uint64 MakeKey(BotPOIType type, uint32 mapId) { return (uint64(type) << 32) | mapId; }
+    static Layer const* FindLayer(BotPOIType type, uint32 mapId);
+
+    static void CollectCreatures(std::unordered_map<uint64, std::vector<BotPOI>>& pending);
+    static void CollectGrindSpots(std::unordered_map<uint64, std::vector<BotPOI>>& pending);
+    static void BuildLayer(Layer& layer, std::vector<BotPOI>& pois);
+
+    static std::unordered_map<uint64 /*type, map*/, Layer> s_layers;
+    static std::vector<std::string> s_names;
+    static uint32 s_counts[uint8(BotPOIType::MAX)];
+    static bool s_indexBuilt;
+    static std::mutex s_indexMutex;
+
+    static constexpr float CELL_SIZE = 256.0f;
+    static constexpr int32 MAX_CELLS_PER_AXIS = 256;
+    static constexpr uint32 NO_NAME = 0xFFFFFFFF;
+};
+
+template<typename Filter>
+uint32 BotPOIIndex::FindNearest(BotPOIType type, uint32 mapId, float x, float y, uint32 k,
+    Filter const& filter, std::vector<BotPOIMatch>& result, float maxDist)
+{
+    result.clear();
+
+    if (!s_indexBuilt)
+        Build();
+
+    Layer const* layer = FindLayer(type, mapId);
+    if (!layer || !k)
+        return 0;
+
+    float const maxDistSq = maxDist > 0.0f ? maxDist * maxDist : FLT_MAX;
+    auto const farther = [](BotPOIMatch const& a, BotPOIMatch const& b) { return a.distSq < b.distSq; };
+
+    int32 const cx = std::min(std::max(int32((x - layer->minX) / CELL_SIZE), 0), layer->cols - 1);
+    int32 const cy = std::min(std::max(int32((y - layer->minY) / CELL_SIZE), 0), layer->rows - 1);
+    int32 const maxRing = std::max(std::max(cx, layer->cols - 1 - cx), std::max(cy, layer->rows - 1 - cy));
+
+    // result is a max-heap on distance while searching
+    for (int32 ring = 0; ring <= maxRing; ++ring)
+    {
+        // Nothing in this ring or beyond is closer than (ring - 1) cells
+        float const ringDist = std::max(ring - 1, 0) * CELL_SIZE;
+        float const ringDistSq = ringDist * ringDist;
+        if (ringDistSq > maxDistSq || (result.size() == k && ringDistSq >= result.front().distSq))
+            break;
+
+        for (int32 cellY = cy - ring; cellY <= cy + ring; ++cellY)
+        {
+            if (cellY < 0 || cellY >= layer->rows)
+                continue;
+
+            // Inner rows of the ring only have their two edge cells
+            bool const edgeRow = cellY == cy - ring || cellY == cy + ring;
+            int32 const step = (edgeRow || ring == 0) ? 1 : 2 * ring;
+
+            for (int32 cellX = cx - ring; cellX <= cx + ring; cellX += step)
+            {
+                if (cellX < 0 || cellX >= layer->cols)
+                    continue;
+
+                uint32 const cell = uint32(cellY * layer->cols + cellX);
+                for (uint32 i = layer->cellStart[cell]; i < layer->cellStart[cell + 1]; ++i)
+                {
+                    BotPOI const& poi = layer->pois[i];
+                    float const dx = poi.x - x;
+                    float const dy = poi.y - y;
+                    float const distSq = dx * dx + dy * dy;
+
+                    if (distSq > maxDistSq)
+                        continue;
+                    if (result.size() == k && distSq >= result.front().distSq)
+                        continue;
+                    if (!filter(poi))
+                        continue;
+
+                    if (result.size() == k)
+                    {
+                        std::pop_heap(result.begin(), result.end(), farther);
+                        result.pop_back();
+                    }
+                    result.push_back({ &poi, distSq });
+                    std::push_heap(result.begin(), result.end(), farther);
+                }
+            }
+        }
+    }
+
+    std::sort_heap(result.begin(), result.end(), farther);
+    return uint32(result.size());
+}
+
+#endif // MANGOS_BOTPOIINDEX_H
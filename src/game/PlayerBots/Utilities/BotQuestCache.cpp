@@ -7,6 +7,7 @@
  */
 
 #include "BotQuestCache.h"
+#include "BotSpawnIndex.h"
 #include "Player.h"
 #include "ObjectMgr.h"
 #include "QuestDef.h"
@@ -104,47 +105,12 @@ void BotQuestCache::BuildQuestGiverCache()
         }
     }
 
-    // Step 3: Iterate creature spawns, find those that are quest givers
-    uint32 creatureGiverCount = 0;
-
-    // Count for progress bar
-    uint32 totalCreatures = 0;
-    auto counter = [&totalCreatures](CreatureDataPair const&) {
-        ++totalCreatures;
-        return false;
-    };
-    sObjectMgr.DoCreatureData(counter);
-
-    BarGoLink bar(totalCreatures);
-
-    auto giverFinder = [&](CreatureDataPair const& pair) {
-        bar.step();
-
-        CreatureData const& data = pair.second;
-        uint32 guid = pair.first;
-        uint32 entry = data.creature_id[0];
-
-        auto it = creatureQuests.find(entry);
-        if (it == creatureQuests.end())
-            return false;  // Not a quest giver
+    // Step 3: Resolve spawns through the spawn index (one pass per giver entry)
+    BotSpawnIndex::Build();
 
-        CreatureInfo const* info = sObjectMgr.GetCreatureTemplate(entry);
-        if (!info)
-            return false;
-
-        // Build QuestGiverInfo
-        QuestGiverInfo giver;
-        giver.x = data.position.x;
-        giver.y = data.position.y;
-        giver.z = data.position.z;
-        giver.mapId = data.position.mapId;
-        giver.sourceEntry = entry;
-        giver.sourceGuid = guid;
-        giver.isGameObject = false;
-        giver.factionTemplateId = info->faction;
-        giver.questIds = it->second;
-
-        // Pre-compute filter fields from quest data
+    // Pre-compute filter fields from quest data (shared by every spawn of an entry)
+    auto fillQuestFilters = [](QuestGiverInfo& giver)
+    {
         giver.minQuestLevel = 255;
         giver.maxQuestLevel = 0;
         giver.classesMask = 0;
@@ -167,83 +133,86 @@ void BotQuestCache::BuildQuestGiverCache()
             giver.classesMask |= pQuest->GetRequiredClasses();
             giver.racesMask |= pQuest->GetRequiredRaces();
         }
+    };
 
-        // If no valid quests found, skip
-        if (giver.minQuestLevel == 255)
-            return false;
+    uint32 creatureGiverCount = 0;
 
-        s_questGiversByMap[giver.mapId].push_back(std::move(giver));
-        s_questGiverCreatureEntries.insert(entry);
-        creatureGiverCount++;
+    BarGoLink bar(creatureQuests.size() + gameobjectQuests.size());
 
-        return false;
-    };
-    sObjectMgr.DoCreatureData(giverFinder);
+    for (auto const& itr : creatureQuests)
+    {
+        bar.step();
 
-    // Step 4: Gameobject quest givers via SQL (no DoGameObjectData equivalent)
-    uint32 goGiverCount = 0;
+        uint32 entry = itr.first;
+        BotSpawnList const* spawns = BotSpawnIndex::GetCreatureSpawns(entry);
+        if (!spawns)
+            continue;  // Not spawned anywhere
 
-    if (!gameobjectQuests.empty())
-    {
-        std::unique_ptr<QueryResult> result(WorldDatabase.Query(
-            "SELECT guid, id, position_x, position_y, position_z, map FROM gameobject"));
+        CreatureInfo const* info = sObjectMgr.GetCreatureTemplate(entry);
+        if (!info)
+            continue;
 
-        if (result)
+        QuestGiverInfo proto;
+        proto.sourceEntry = entry;
+        proto.isGameObject = false;
+        proto.factionTemplateId = info->faction;
+        proto.questIds = itr.second;
+        fillQuestFilters(proto);
+
+        // If no valid quests found, skip
+        if (proto.minQuestLevel == 255)
+            continue;
+
+        for (BotSpawnPoint const& spawn : *spawns)
         {
-            do
-            {
-                Field* fields = result->Fetch();
-                uint32 guid = fields[0].GetUInt32();
-                uint32 goEntry = fields[1].GetUInt32();
-
-                auto it = gameobjectQuests.find(goEntry);
-                if (it == gameobjectQuests.end())
-                    continue;  // Not a quest giver
-
-                QuestGiverInfo giver;
-                giver.x = fields[2].GetFloat();
-                giver.y = fields[3].GetFloat();
-                giver.z = fields[4].GetFloat();
-                giver.mapId = fields[5].GetUInt32();
-                giver.sourceEntry = goEntry;
-                giver.sourceGuid = guid;
-                giver.isGameObject = true;
-                giver.factionTemplateId = 0;  // GameObjects have no faction
-                giver.questIds = it->second;
-
-                // Pre-compute filter fields
-                giver.minQuestLevel = 255;
-                giver.maxQuestLevel = 0;
-                giver.classesMask = 0;
-                giver.racesMask = 0;
-
-                for (uint32 questId : giver.questIds)
-                {
-                    Quest const* pQuest = sObjectMgr.GetQuestTemplate(questId);
-                    if (!pQuest)
-                        continue;
+            QuestGiverInfo giver = proto;
+            giver.x = spawn.x;
+            giver.y = spawn.y;
+            giver.z = spawn.z;
+            giver.mapId = spawn.mapId;
+            giver.sourceGuid = spawn.guid;
+
+            s_questGiversByMap[giver.mapId].push_back(std::move(giver));
+            creatureGiverCount++;
+        }
+        s_questGiverCreatureEntries.insert(entry);
+    }
 
-                    uint8 minLevel = pQuest->GetMinLevel();
-                    uint8 questLevel = pQuest->GetQuestLevel();
+    // Step 4: Gameobject quest givers
+    uint32 goGiverCount = 0;
 
-                    if (minLevel < giver.minQuestLevel)
-                        giver.minQuestLevel = minLevel;
-                    if (questLevel > giver.maxQuestLevel)
-                        giver.maxQuestLevel = questLevel;
+    for (auto const& itr : gameobjectQuests)
+    {
+        bar.step();
 
-                    giver.classesMask |= pQuest->GetRequiredClasses();
-                    giver.racesMask |= pQuest->GetRequiredRaces();
-                }
+        uint32 goEntry = itr.first;
+        BotSpawnList const* spawns = BotSpawnIndex::GetGameObjectSpawns(goEntry);
+        if (!spawns)
+            continue;
 
-                if (giver.minQuestLevel == 255)
-                    continue;
+        QuestGiverInfo proto;
+        proto.sourceEntry = goEntry;
+        proto.isGameObject = true;
+        proto.factionTemplateId = 0;  // GameObjects have no faction
+        proto.questIds = itr.second;
+        fillQuestFilters(proto);
 
-                s_questGiversByMap[giver.mapId].push_back(std::move(giver));
-                s_questGiverObjectEntries.insert(goEntry);
-                goGiverCount++;
+        if (proto.minQuestLevel == 255)
+            continue;
 
-            } while (result->NextRow());
+        for (BotSpawnPoint const& spawn : *spawns)
+        {
+            QuestGiverInfo giver = proto;
+            giver.x = spawn.x;
+            giver.y = spawn.y;
+            giver.z = spawn.z;
+            giver.mapId = spawn.mapId;
+            giver.sourceGuid = spawn.guid;
+
+            s_questGiversByMap[giver.mapId].push_back(std::move(giver));
+            goGiverCount++;
         }
+        s_questGiverObjectEntries.insert(goEntry);
     }
 
     s_totalGiverCount = creatureGiverCount + goGiverCount;
@@ -287,40 +256,40 @@ void BotQuestCache::BuildTurnInCache()
         }
     }
 
-    // Step 2: Iterate creature spawns, find turn-in NPCs
-    auto turnInFinder = [&](CreatureDataPair const& pair) {
-        CreatureData const& data = pair.second;
-        uint32 guid = pair.first;
-        uint32 entry = data.creature_id[0];
+    // Step 2: Resolve turn-in NPC spawns through the spawn index
+    BotSpawnIndex::Build();
 
-        auto it = creatureTurnIns.find(entry);
-        if (it == creatureTurnIns.end())
-            return false;
+    for (auto const& itr : creatureTurnIns)
+    {
+        uint32 entry = itr.first;
+        BotSpawnList const* spawns = BotSpawnIndex::GetCreatureSpawns(entry);
+        if (!spawns)
+            continue;
 
         CreatureInfo const* info = sObjectMgr.GetCreatureTemplate(entry);
         if (!info)
-            return false;
+            continue;
 
-        for (uint32 questId : it->second)
+        for (BotSpawnPoint const& spawn : *spawns)
         {
-            QuestTurnInInfo turnIn;
-            turnIn.x = data.position.x;
-            turnIn.y = data.position.y;
-            turnIn.z = data.position.z;
-            turnIn.mapId = data.position.mapId;
-            turnIn.targetEntry = entry;
-            turnIn.targetGuid = guid;
-            turnIn.isGameObject = false;
-            turnIn.factionTemplateId = info->faction;
-            turnIn.questId = questId;
-
-            s_turnInsByQuestId[questId].push_back(turnIn);
-            creatureTurnInCount++;
+            for (uint32 questId : itr.second)
+            {
+                QuestTurnInInfo turnIn;
+                turnIn.x = spawn.x;
+                turnIn.y = spawn.y;
+                turnIn.z = spawn.z;
+                turnIn.mapId = spawn.mapId;
+                turnIn.targetEntry = entry;
+                turnIn.targetGuid = spawn.guid;
+                turnIn.isGameObject = false;
+                turnIn.factionTemplateId = info->faction;
+                turnIn.questId = questId;
+
+                s_turnInsByQuestId[questId].push_back(turnIn);
+                creatureTurnInCount++;
+            }
         }
-
-        return false;
-    };
-    sObjectMgr.DoCreatureData(turnInFinder);
+    }
 
     // Step 3: Gameobject turn-ins
     std::unordered_map<uint32, std::vector<uint32>> goTurnIns;
@@ -339,41 +308,31 @@ void BotQuestCache::BuildTurnInCache()
         }
     }
 
-    if (!goTurnIns.empty())
+    for (auto const& itr : goTurnIns)
     {
-        std::unique_ptr<QueryResult> result(WorldDatabase.Query(
-            "SELECT guid, id, position_x, position_y, position_z, map FROM gameobject"));
+        uint32 goEntry = itr.first;
+        BotSpawnList const* spawns = BotSpawnIndex::GetGameObjectSpawns(goEntry);
+        if (!spawns)
+            continue;
 
-        if (result)
+        for (BotSpawnPoint const& spawn : *spawns)
         {
-            do
+            for (uint32 questId : itr.second)
             {
-                Field* fields = result->Fetch();
-                uint32 guid = fields[0].GetUInt32();
-                uint32 goEntry = fields[1].GetUInt32();
-
-                auto it = goTurnIns.find(goEntry);
-                if (it == goTurnIns.end())
-                    continue;
-
-                for (uint32 questId : it->second)
-                {
-                    QuestTurnInInfo turnIn;
-                    turnIn.x = fields[2].GetFloat();
-                    turnIn.y = fields[3].GetFloat();
-                    turnIn.z = fields[4].GetFloat();
-                    turnIn.mapId = fields[5].GetUInt32();
-                    turnIn.targetEntry = goEntry;
-                    turnIn.targetGuid = guid;
-                    turnIn.isGameObject = true;
-                    turnIn.factionTemplateId = 0;
-                    turnIn.questId = questId;
-
-                    s_turnInsByQuestId[questId].push_back(turnIn);
-                    goTurnInCount++;
-                }
-
-            } while (result->NextRow());
+                QuestTurnInInfo turnIn;
+                turnIn.x = spawn.x;
+                turnIn.y = spawn.y;
+                turnIn.z = spawn.z;
+                turnIn.mapId = spawn.mapId;
+                turnIn.targetEntry = goEntry;
+                turnIn.targetGuid = spawn.guid;
+                turnIn.isGameObject = true;
+                turnIn.factionTemplateId = 0;
+                turnIn.questId = questId;
+
+                s_turnInsByQuestId[questId].push_back(turnIn);
+                goTurnInCount++;
+            }
         }
     }
 
@@ -664,73 +623,28 @@ bool BotQuestCache::FindCreatureSpawnLocation(uint32 creatureEntry, uint32 mapId
                                                float botX, float botY,
                                                float& outX, float& outY, float& outZ)
 {
-    float closestDist = FLT_MAX;
-    bool found = false;
-
-    auto finder = [&](CreatureDataPair const& pair) {
-        CreatureData const& data = pair.second;
-        if (data.creature_id[0] != creatureEntry)
-            return false;
-        if (data.position.mapId != mapId)
-            return false;
-
-        float dx = data.position.x - botX;
-        float dy = data.position.y - botY;
-        float dist = dx * dx + dy * dy;  // squared distance is fine for comparison
-
-        if (dist < closestDist)
-        {
-            closestDist = dist;
-            outX = data.position.x;
-            outY = data.position.y;
-            outZ = data.position.z;
-            found = true;
-        }
-        return false;  // continue iteration
-    };
-    sObjectMgr.DoCreatureData(finder);
+    BotSpawnPoint const* spawn = BotSpawnIndex::FindNearestCreature(creatureEntry, mapId, botX, botY);
+    if (!spawn)
+        return false;
 
-    return found;
+    outX = spawn->x;
+    outY = spawn->y;
+    outZ = spawn->z;
+    return true;
 }
 
 bool BotQuestCache::FindGameObjectSpawnLocation(uint32 goEntry, uint32 mapId,
                                                   float botX, float botY,
                                                   float& outX, float& outY, float& outZ)
 {
-    // Query gameobject spawn table (no DoGameObjectData equivalent, so use SQL)
-    // This runs rarely (only when bot needs to travel to a gameobject), so SQL is acceptable
-    std::unique_ptr<QueryResult> result(WorldDatabase.PQuery(
-        "SELECT position_x, position_y, position_z FROM gameobject WHERE id = %u AND map = %u",
-        goEntry, mapId));
-
-    if (!result)
+    BotSpawnPoint const* spawn = BotSpawnIndex::FindNearestGameObject(goEntry, mapId, botX, botY);
+    if (!spawn)
         return false;
 
-    float closestDist = FLT_MAX;
-    bool found = false;
-
-    do
-    {
-        Field* fields = result->Fetch();
-        float x = fields[0].GetFloat();
-        float y = fields[1].GetFloat();
-        float z = fields[2].GetFloat();
-
-        float dx = x - botX;
-        float dy = y - botY;
-        float dist = dx * dx + dy * dy;
-
-        if (dist < closestDist)
-        {
-            closestDist = dist;
-            outX = x;
-            outY = y;
-            outZ = z;
-            found = true;
-        }
-    } while (result->NextRow());
-
-    return found;
+    outX = spawn->x;
+    outY = spawn->y;
+    outZ = spawn->z;
+    return true;
 }
 
 // ============================================================================
@@ -5,8 +5,8 @@
  * and item drop sources. Built once at server startup, shared across
  * all bots. Zero runtime database queries.
  *
- * Follows the same pattern as VendoringStrategy::BuildVendorCache(),
- * TrainingStrategy::BuildTrainerCache(), etc.
+ * Follows the same pattern as BotSpawnIndex::Build(),
+ * BotPOIIndex::Build(), etc.
  *
  * Part of the vMangos RandomBot AI Project.
  */
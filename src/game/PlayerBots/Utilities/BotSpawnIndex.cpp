@@ -0,0 +1,185 @@
+/*
+ * BotSpawnIndex.cpp
+ *
+ * In-memory spatial index of creature and gameobject spawns.
+ * Built once at server startup.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#include "BotSpawnIndex.h"
+#include "ObjectMgr.h"
+#include "Log.h"
+#include <algorithm>
+#include <cfloat>
+
+// ============================================================================
+// Static member initialization
+// ============================================================================
+
+std::unordered_map<uint32, BotSpawnList> BotSpawnIndex::s_creatureSpawns;
+std::unordered_map<uint32, BotSpawnList> BotSpawnIndex::s_goSpawns;
+bool BotSpawnIndex::s_indexBuilt = false;
+std::mutex BotSpawnIndex::s_indexMutex;
+
+// ============================================================================
+// Index Building
+// ============================================================================
+
+void BotSpawnIndex::Build()
+{
+    std::lock_guard<std::mutex> lock(s_indexMutex);
+
+    if (s_indexBuilt)
+        return;
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[BotSpawnIndex] Building spawn index...");
+
+    uint32 creatureCount = 0;
+    auto creatureCollector = [&](CreatureDataPair const& pair) {
+        CreatureData const& data = pair.second;
+        BotSpawnPoint spawn;
+        spawn.x = data.position.x;
+        spawn.y = data.position.y;
+        spawn.z = data.position.z;
+        spawn.mapId = data.position.mapId;
+        spawn.guid = pair.first;
+        s_creatureSpawns[data.creature_id[0]].push_back(spawn);
+        ++creatureCount;
+        return false;  // continue iteration
+    };
+    sObjectMgr.DoCreatureData(creatureCollector);
+
+    uint32 goCount = 0;
+    auto goCollector = [&](GameObjectDataPair const& pair) {
+        GameObjectData const& data = pair.second;
+        BotSpawnPoint spawn;
+        spawn.x = data.position.x;
+        spawn.y = data.position.y;
+        spawn.z = data.position.z;
+        spawn.mapId = data.position.mapId;
+        spawn.guid = pair.first;
+        s_goSpawns[data.id].push_back(spawn);
+        ++goCount;
+        return false;  // continue iteration
+    };
+    sObjectMgr.DoGOData(goCollector);
+
+    SortSpawns(s_creatureSpawns);
+    SortSpawns(s_goSpawns);
+
+    s_indexBuilt = true;
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL,
+        ">> Spawn index: %u creature spawns (%zu entries), %u gameobject spawns (%zu entries)",
+        creatureCount, s_creatureSpawns.size(), goCount, s_goSpawns.size());
+}
+
+void BotSpawnIndex::SortSpawns(std::unordered_map<uint32, BotSpawnList>& index)
+{
+    for (auto& itr : index)
+    {
+        BotSpawnList& spawns = itr.second;
+        spawns.shrink_to_fit();
+        std::sort(spawns.begin(), spawns.end(), [](BotSpawnPoint const& a, BotSpawnPoint const& b) {
+            if (a.mapId != b.mapId)
+                return a.mapId < b.mapId;
+            return a.x < b.x;
+        });
+    }
+}
+
+// ============================================================================
+// Nearest Spawn Lookups
+// ============================================================================
+
+BotSpawnPoint const* BotSpawnIndex::FindNearest(BotSpawnList const& spawns, uint32 mapId, float x, float y)
+{
+    // Narrow to this map's slice, then find the first spawn at or east of x
+    auto mapBegin = std::lower_bound(spawns.begin(), spawns.end(), mapId,
+        [](BotSpawnPoint const& s, uint32 id) { return s.mapId < id; });
+    auto mapEnd = std::upper_bound(mapBegin, spawns.end(), mapId,
+        [](uint32 id, BotSpawnPoint const& s) { return id < s.mapId; });
+
+    if (mapBegin == mapEnd)
+        return nullptr;
+
+    auto pivot = std::lower_bound(mapBegin, mapEnd, x,
+        [](BotSpawnPoint const& s, float px) { return s.x < px; });
+
+    float bestDist = FLT_MAX;
+    BotSpawnPoint const* best = nullptr;
+
+    // Sweep outward along x. Once dx^2 alone exceeds the best distance,
+    // nothing further on that side can be closer.
+    for (auto it = pivot; it != mapEnd; ++it)
+    {
+        float dx = it->x - x;
+        if (dx * dx >= bestDist)
+            break;
+        float dy = it->y - y;
+        float dist = dx * dx + dy * dy;
+        if (dist < bestDist)
+        {
+            bestDist = dist;
+            best = &*it;
+        }
+    }
+
+    for (auto it = pivot; it != mapBegin;)
+    {
+        --it;
+        float dx = it->x - x;
+        if (dx * dx >= bestDist)
+            break;
+        float dy = it->y - y;
+        float dist = dx * dx + dy * dy;
+        if (dist < bestDist)
+        {
+            bestDist = dist;
+            best = &*it;
+        }
+    }
+
+    return best;
+}
+
+BotSpawnPoint const* BotSpawnIndex::FindNearestCreature(uint32 creatureEntry, uint32 mapId, float x, float y)
+{
+    BotSpawnList const* spawns = GetCreatureSpawns(creatureEntry);
+    return spawns ? FindNearest(*spawns, mapId, x, y) : nullptr;
+}
+
+BotSpawnPoint const* BotSpawnIndex::FindNearestGameObject(uint32 goEntry, uint32 mapId, float x, float y)
+{
+    BotSpawnList const* spawns = GetGameObjectSpawns(goEntry);
+    return spawns ? FindNearest(*spawns, mapId, x, y) : nullptr;
+}
+
+// ============================================================================
+// Raw Spawn Lists
+// ============================================================================
+
+BotSpawnList const* BotSpawnIndex::GetCreatureSpawns(uint32 creatureEntry)
+{
+    if (!s_indexBuilt)
+        return nullptr;
+
+    auto it = s_creatureSpawns.find(creatureEntry);
+    if (it == s_creatureSpawns.end())
+        return nullptr;
+
+    return &it->second;
+}
+
+BotSpawnList const* BotSpawnIndex::GetGameObjectSpawns(uint32 goEntry)
+{
+    if (!s_indexBuilt)
+        return nullptr;
+
+    auto it = s_goSpawns.find(goEntry);
+    if (it == s_goSpawns.end())
+        return nullptr;
+
+    return &it->second;
+}
@@ -0,0 +1,94 @@
+/*
+ * BotSpawnIndex.h
+ *
+ * In-memory spatial index of creature and gameobject spawns, keyed by
+ * entry. Built once at server startup from ObjectMgr spawn data and
+ * shared across all bots. Answers "nearest spawn of entry E on map M
+ * to (x, y)" with one hash lookup and two binary searches, with zero
+ * runtime database queries.
+ *
+ * Also used by the startup cache builders (vendors, trainers, quest
+ * givers) so they visit each entry once instead of scanning every spawn.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#ifndef MANGOS_BOTSPAWNINDEX_H
+#define MANGOS_BOTSPAWNINDEX_H
+
+#include "Common.h"
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+// ============================================================================
+// Spawn point — one creature or gameobject spawn
+// ============================================================================
+
+struct BotSpawnPoint
+{
+    float x, y, z;
+    uint32 mapId;
+    uint32 guid;                // Spawn GUID (low part)
+};
+
+// Spawns of a single entry, sorted by (mapId, x) for range pruning
+typedef std::vector<BotSpawnPoint> BotSpawnList;
+
+// ============================================================================
+// BotSpawnIndex — Static index manager
+// ============================================================================
+
+class BotSpawnIndex
+{
+public:
+    // ---- Index building (called from PlayerBotMgr::Load) ----
+    static void Build();
+    static bool IsBuilt() { return s_indexBuilt; }
+
+    // ---- Nearest spawn lookups ----
+
+    // Nearest spawn of an entry on a map to (x, y), 2D distance.
+    // Returns nullptr if the entry has no spawn on that map.
+    static BotSpawnPoint const* FindNearestCreature(uint32 creatureEntry, uint32 mapId, float x, float y);
+    static BotSpawnPoint const* FindNearestGameObject(uint32 goEntry, uint32 mapId, float x, float y);
+
+    // ---- Raw spawn lists (all maps) ----
+
+    // Returns nullptr if the entry has no spawns.
+    static BotSpawnList const* GetCreatureSpawns(uint32 creatureEntry);
+    static BotSpawnList const* GetGameObjectSpawns(uint32 goEntry);
+
+    // ---- Per-entry iteration (for cache builders) ----
+
+    // Worker signature: void(uint32 entry, BotSpawnList const& spawns)
+    template<typename Worker>
+    static void DoCreatureEntries(Worker& worker)
+    {
+        for (auto const& itr : s_creatureSpawns)
+            worker(itr.first, itr.second);
+    }
+
+    template<typename Worker>
+    static void DoGameObjectEntries(Worker& worker)
+    {
+        for (auto const& itr : s_goSpawns)
+            worker(itr.first, itr.second);
+    }
+
+    // ---- Stats for logging ----
+
+    static uint32 GetCreatureEntryCount() { return uint32(s_creatureSpawns.size()); }
+    static uint32 GetGameObjectEntryCount() { return uint32(s_goSpawns.size()); }
+
+private:
+    static BotSpawnPoint const* FindNearest(BotSpawnList const& spawns, uint32 mapId, float x, float y);
+    static void SortSpawns(std::unordered_map<uint32, BotSpawnList>& index);
+
+    static std::unordered_map<uint32 /*entry*/, BotSpawnList> s_creatureSpawns;
+    static std::unordered_map<uint32 /*entry*/, BotSpawnList> s_goSpawns;
+    static bool s_indexBuilt;
+    static std::mutex s_indexMutex;
+};
+
+#endif // MANGOS_BOTSPAWNINDEX_H
@@ -0,0 +1,177 @@
+/*
+ * BotSpellTable.cpp
+ *
+ * Shared spell slot sets and poison rank tables for combat bots.
+ * Poison table built once at server startup, spell sets on first use.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#include "BotSpellTable.h"
+#include "CombatBotBaseAI.h"
+#include "SpellMgr.h"
+#include "Player.h"
+#include "Log.h"
+#include <algorithm>
+
+// ============================================================================
+// Static member initialization
+// ============================================================================
+
+BotSpellTable::SpellSetMap BotSpellTable::s_spellSets;
+std::shared_timed_mutex BotSpellTable::s_spellSetMutex;
+SpellEntry const* BotSpellTable::s_poisons[MAX_BOT_POISONS][MAX_LEVEL + 1] = {};
+bool BotSpellTable::s_tableBuilt = false;
+std::mutex BotSpellTable::s_tableMutex;
+
+constexpr uint32 BotSpellTable::MAX_SPELL_SETS;
+
+static char const* const s_poisonNames[MAX_BOT_POISONS] =
+{
+    "Deadly Poison",
+    "Instant Poison",
+    "Crippling Poison",
+    "Wound Poison",
+    "Mind-numbing Poison",
+};
+
+// ============================================================================
+// Table Building
+// ============================================================================
+
+void BotSpellTable::Build()
+{
+    std::lock_guard<std::mutex> lock(s_tableMutex);
+
+    if (s_tableBuilt)
+        return;
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[BotSpellTable] Building spell tables...");
+
+    BuildPoisonTable();
+
+    s_tableBuilt = true;
+}
+
+void BotSpellTable::BuildPoisonTable()
+{
+    // Rogues can only craft an item that applies the poison, they don't know the actual poison enchant.
+    // Collect the enchant ranks of each poison in one pass over the spell store.
+    std::vector<SpellEntry const*> ranks[MAX_BOT_POISONS];
+    for (uint32 i = 0; i < sSpellMgr.GetMaxSpellId(); i++)
+    {
+        SpellEntry const* pSpellEntry = sSpellMgr.GetSpellEntry(i);
+        if (!pSpellEntry || pSpellEntry->Effect[0] != SPELL_EFFECT_ENCHANT_ITEM_TEMPORARY)
+            continue;
+
+        for (uint32 type = 0; type < MAX_BOT_POISONS; ++type)
+        {
+            if (pSpellEntry->SpellName[0] == s_poisonNames[type])
+            {
+                ranks[type].push_back(pSpellEntry);
+                break;
+            }
+        }
+    }
+
+    uint32 rankCount = 0;
+    for (uint32 type = 0; type < MAX_BOT_POISONS; ++type)
+    {
+        rankCount += ranks[type].size();
+
+        // Highest spell level usable at each level, lowest id on ties
+        for (uint32 level = 0; level <= MAX_LEVEL; ++level)
+        {
+            SpellEntry const* pHighestRank = nullptr;
+            for (SpellEntry const* pSpellEntry : ranks[type])
+            {
+                if (pSpellEntry->spellLevel <= level &&
+                   (!pHighestRank || pHighestRank->spellLevel < pSpellEntry->spellLevel))
+                    pHighestRank = pSpellEntry;
+            }
+            s_poisons[type][level] = pHighestRank;
+        }
+    }
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, ">> Poison table built: %u enchant ranks for %u poisons", rankCount, uint32(MAX_BOT_POISONS));
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+std::size_t BotSpellTable::SpellSetKeyHash::operator()(std::vector<uint32> const& key) const
+{
+    uint64 hash = 14695981039346656037ULL;
+    for (uint32 value : key)
+    {
+        hash ^= value;
+        hash *= 1099511628211ULL;
+    }
+    return std::size_t(hash);
+}
+
+CombatBotSpellSet const& BotSpellTable::GetSpellSet(Player const* pPlayer)
+{
+    // Same filter PopulateSpellData always used: active, not passive, displayed
+    thread_local std::vector<uint32> key;
+    key.clear();
+    key.push_back(pPlayer->GetClass());
+
+    for (auto const& spell : pPlayer->GetSpellMap())
+    {
+        if (spell.second.disabled || spell.second.state == PLAYERSPELL_REMOVED)
+            continue;
+
+        SpellEntry const* pSpellEntry = sSpellMgr.GetSpellEntry(spell.first);
+        if (!pSpellEntry)
+            continue;
+
+        if (pSpellEntry->HasAttribute(SPELL_ATTR_PASSIVE) || pSpellEntry->HasAttribute(SPELL_ATTR_DO_NOT_DISPLAY))
+            continue;
+
+        key.push_back(spell.first);
+    }
+
+    std::sort(key.begin() + 1, key.end());
+
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(s_spellSetMutex);
+        auto itr = s_spellSets.find(key);
+        if (itr != s_spellSets.end())
+            return *itr->second;
+    }
+
+    // Sort outside the lock, another thread may insert the same set meanwhile
+    std::unique_ptr<CombatBotSpellSet> pSet(new CombatBotSpellSet());
+    std::vector<uint32> const spellIds(key.begin() + 1, key.end());
+    CombatBotBaseAI::ClassifySpells(pPlayer->GetClass(), spellIds, *pSet);
+
+    std::unique_lock<std::shared_timed_mutex> lock(s_spellSetMutex);
+    auto itr = s_spellSets.find(key);
+    if (itr != s_spellSets.end())
+        return *itr->second;
+
+    if (s_spellSets.size() >= MAX_SPELL_SETS)
+    {
+        thread_local CombatBotSpellSet uncached;
+        uncached = std::move(*pSet);
+        return uncached;
+    }
+
+    return *s_spellSets.emplace(key, std::move(pSet)).first->second;
+}
+
+SpellEntry const* BotSpellTable::GetPoisonEnchant(BotPoisonType type, uint32 level)
+{
+    if (!s_tableBuilt)
+        Build();
+
+    return s_poisons[type][std::min<uint32>(level, MAX_LEVEL)];
+}
+
+uint32 BotSpellTable::GetSpellSetCount()
+{
+    std::shared_lock<std::shared_timed_mutex> lock(s_spellSetMutex);
+    return uint32(s_spellSets.size());
+}
@@ -0,0 +1,90 @@
+/*
+ * BotSpellTable.h
+ *
+ * Shared spell lookup tables for combat bots.
+ *
+ * Sorting a bot's spells into the CombatBotBaseAI slots (best rank of
+ * every seal, blessing, totem, aura...) only depends on the class and
+ * the known spells, and random bots of the same class and level know
+ * the same trainer spells. Each distinct (class, spell list) is sorted
+ * once into an immutable CombatBotSpellSet that all matching bots copy
+ * their slots from, so PopulateSpellData() is one hash lookup instead
+ * of a name match per known spell.
+ *
+ * Also holds a per-level table of the best poison enchant of each rogue
+ * poison, built once at startup from the spell store.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#ifndef MANGOS_BOTSPELLTABLE_H
+#define MANGOS_BOTSPELLTABLE_H
+
+#include "Common.h"
+#include "DBCEnums.h"
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+class Player;
+class SpellEntry;
+struct CombatBotSpellSet;
+
+enum BotPoisonType
+{
+    BOT_POISON_DEADLY,
+    BOT_POISON_INSTANT,
+    BOT_POISON_CRIPPLING,
+    BOT_POISON_WOUND,
+    BOT_POISON_MIND_NUMBING,
+
+    MAX_BOT_POISONS
+};
+
+// ============================================================================
+// BotSpellTable — Static table manager
+// ============================================================================
+
+class BotSpellTable
+{
+public:
+    // ---- Table building (called from PlayerBotMgr::Load) ----
+    static void Build();
+    static bool IsBuilt() { return s_tableBuilt; }
+
+    // ---- Queries ----
+
+    // Slots for the active spells of the player's class, sorted on first use.
+    // The reference stays valid until shutdown.
+    static CombatBotSpellSet const& GetSpellSet(Player const* pPlayer);
+
+    // Highest rank of a poison enchant usable at this level, nullptr if none
+    static SpellEntry const* GetPoisonEnchant(BotPoisonType type, uint32 level);
+
+    // ---- Stats for logging ----
+    static uint32 GetSpellSetCount();
+
+private:
+    // Class first, then the sorted ids of the active spells
+    struct SpellSetKeyHash
+    {
+        std::size_t operator()(std::vector<uint32> const& key) const;
+    };
+
+    typedef std::unordered_map<std::vector<uint32>, std::unique_ptr<CombatBotSpellSet const>, SpellSetKeyHash> SpellSetMap;
+
+    static void BuildPoisonTable();
+
+    static SpellSetMap s_spellSets;
+    static std::shared_timed_mutex s_spellSetMutex;
+    static SpellEntry const* s_poisons[MAX_BOT_POISONS][MAX_LEVEL + 1];
+    static bool s_tableBuilt;
+    static std::mutex s_tableMutex;
+
+    // Bots with unusual spell lists past this are sorted without caching
+    static constexpr uint32 MAX_SPELL_SETS = 8192;
+};
+
+#endif // MANGOS_BOTSPELLTABLE_H
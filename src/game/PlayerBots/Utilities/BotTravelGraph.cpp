@@ -0,0 +1,427 @@
+/*
+ * BotTravelGraph.cpp
+ *
+ * Coarse continent walking graph for long bot trips.
+ * Built once at server startup.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#include "BotTravelGraph.h"
+#include "BotPOIIndex.h"
+#include "ObjectMgr.h"
+#include "DBCStores.h"
+#include "GridDefines.h"
+#include "Log.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <set>
+
+// ============================================================================
+// Static member initialization
+// ============================================================================
+
+std::unordered_map<uint32, std::unique_ptr<BotTravelGraph::MapGraph>> BotTravelGraph::s_graphs;
+bool BotTravelGraph::s_graphsBuilt = false;
+std::mutex BotTravelGraph::s_graphMutex;
+std::atomic<uint64> BotTravelGraph::s_routeHits(0);
+std::atomic<uint64> BotTravelGraph::s_routeMisses(0);
+
+constexpr float BotTravelGraph::LINK_DISTANCE;
+constexpr float BotTravelGraph::NODE_MERGE_DISTANCE;
+constexpr uint32 BotTravelGraph::MAX_LINKS;
+constexpr float BotTravelGraph::MAX_LINK_SLOPE;
+constexpr uint8 BotTravelGraph::MAX_LINK_FAILURES;
+constexpr uint32 BotTravelGraph::MAX_CACHED_ROUTES;
+constexpr int32 BotTravelGraph::REGIONS_PER_AXIS;
+constexpr float BotTravelGraph::MAX_ANCHOR_DISTANCE;
+
+static float GetDistance2DSq(BotTravelStop const& a, BotTravelStop const& b)
+{
+    float const dx = a.x - b.x;
+    float const dy = a.y - b.y;
+    return dx * dx + dy * dy;
+}
+
+static float GetDistance3D(BotTravelStop const& a, BotTravelStop const& b)
+{
+    float const dz = a.z - b.z;
+    return std::sqrt(GetDistance2DSq(a, b) + dz * dz);
+}
+
+// Key of the cellSize cell holding (x, y)
+static uint64 GetCellKey(float x, float y, float cellSize, int32 offsetX = 0, int32 offsetY = 0)
+{
+    int32 const cellX = int32(std::floor(x / cellSize)) + offsetX;
+    int32 const cellY = int32(std::floor(y / cellSize)) + offsetY;
+    return (uint64(uint32(cellX)) << 32) | uint32(cellY);
+}
+
+// ============================================================================
+// Graph Building
+// ============================================================================
+
+void BotTravelGraph::Build()
+{
+    std::lock_guard<std::mutex> lock(s_graphMutex);
+
+    if (s_graphsBuilt)
+        return;
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[BotTravelGraph] Building continent travel graphs...");
+
+    // Eastern Kingdoms and Kalimdor, the only maps bots travel on
+    for (uint32 mapId = 0; mapId <= 1; ++mapId)
+    {
+        std::unique_ptr<MapGraph> graph(new MapGraph());
+        CollectNodes(mapId, graph->nodes);
+        if (graph->nodes.empty())
+            continue;
+
+        BuildLinks(*graph);
+        BuildAnchors(*graph);
+
+        sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, ">> Travel graph of map %u: %u nodes, %u links",
+            mapId, uint32(graph->nodes.size()), uint32(graph->links.size()));
+
+        s_graphs[mapId] = std::move(graph);
+    }
+
+    s_graphsBuilt = true;
+}
+
+void BotTravelGraph::CollectNodes(uint32 mapId, std::vector<BotTravelStop>& nodes)
+{
+    std::unordered_map<uint64 /*cell key*/, std::vector<uint32>> cells;
+
+    auto addNode = [&](float x, float y, float z)
+    {
+        BotTravelStop const stop = { x, y, z, uint32(nodes.size()) };
+
+        for (int32 offsetX = -1; offsetX <= 1; ++offsetX)
+        {
+            for (int32 offsetY = -1; offsetY <= 1; ++offsetY)
+            {
+                auto itr = cells.find(GetCellKey(x, y, NODE_MERGE_DISTANCE, offsetX, offsetY));
+                if (itr == cells.end())
+                    continue;
+
+                for (uint32 node : itr->second)
+                {
+                    if (GetDistance3D(nodes[node], stop) < NODE_MERGE_DISTANCE)
+                        return;
+                }
+            }
+        }
+
+        cells[GetCellKey(x, y, NODE_MERGE_DISTANCE)].push_back(stop.node);
+        nodes.push_back(stop);
+    };
+
+    // Flight masters and graveyards first, they sit on roads and in towns
+    for (uint32 id = 0; id < sObjectMgr.GetMaxTaxiNodeId(); ++id)
+    {
+        TaxiNodesEntry const* pNode = sObjectMgr.GetTaxiNodeEntry(id);
+        if (pNode && pNode->map_id == mapId)
+            addNode(pNode->x, pNode->y, pNode->z);
+    }
+
+    for (uint32 id = 0; id < sWorldSafeLocsStore.GetNumRows(); ++id)
+    {
+        WorldSafeLocsEntry const* pGraveyard = sWorldSafeLocsStore.LookupEntry(id);
+        if (pGraveyard && pGraveyard->map_id == mapId)
+            addNode(pGraveyard->x, pGraveyard->y, pGraveyard->z);
+    }
+
+    for (BotPOIType type : { BotPOIType::VENDOR, BotPOIType::TRAINER, BotPOIType::GRIND_SPOT })
+    {
+        for (BotPOI const& poi : BotPOIIndex::GetAll(type, mapId))
+            addNode(poi.x, poi.y, poi.z);
+    }
+}
+
+void BotTravelGraph::BuildLinks(MapGraph& graph)
+{
+    std::vector<BotTravelStop> const& nodes = graph.nodes;
+
+    std::unordered_map<uint64 /*cell key*/, std::vector<uint32>> cells;
+    for (BotTravelStop const& node : nodes)
+        cells[GetCellKey(node.x, node.y, LINK_DISTANCE)].push_back(node.node);
+
+    // Undirected, a link either end picked is walkable both ways
+    std::set<std::pair<uint32, uint32>> pairs;
+    std::vector<std::pair<float, uint32>> candidates;
+
+    for (BotTravelStop const& node : nodes)
+    {
+        candidates.clear();
+
+        for (int32 offsetX = -1; offsetX <= 1; ++offsetX)
+        {
+            for (int32 offsetY = -1; offsetY <= 1; ++offsetY)
+            {
+                auto itr = cells.find(GetCellKey(node.x, node.y, LINK_DISTANCE, offsetX, offsetY));
+                if (itr == cells.end())
+                    continue;
+
+                for (uint32 other : itr->second)
+                {
+                    if (other == node.node)
+                        continue;
+
+                    float const distSq = GetDistance2DSq(node, nodes[other]);
+                    if (distSq > LINK_DISTANCE * LINK_DISTANCE)
+                        continue;
+
+                    if (std::fabs(node.z - nodes[other].z) > std::sqrt(distSq) * MAX_LINK_SLOPE)
+                        continue;
+
+                    candidates.emplace_back(distSq, other);
+                }
+            }
+        }
+
+        uint32 const count = std::min(uint32(candidates.size()), MAX_LINKS);
+        std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end());
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            uint32 const other = candidates[i].second;
+            pairs.emplace(std::min(node.node, other), std::max(node.node, other));
+        }
+    }
+
+    std::vector<std::vector<uint32>> adjacent(nodes.size());
+    for (auto const& pair : pairs)
+    {
+        adjacent[pair.first].push_back(pair.second);
+        adjacent[pair.second].push_back(pair.first);
+    }
+
+    graph.linkStart.resize(nodes.size() + 1);
+    for (uint32 node = 0; node < nodes.size(); ++node)
+    {
+        graph.linkStart[node] = uint32(graph.links.size());
+        for (uint32 other : adjacent[node])
+            graph.links.push_back({ other, GetDistance3D(nodes[node], nodes[other]), 0 });
+    }
+    graph.linkStart[nodes.size()] = uint32(graph.links.size());
+}
+
+void BotTravelGraph::BuildAnchors(MapGraph& graph)
+{
+    graph.anchors.assign(REGIONS_PER_AXIS * REGIONS_PER_AXIS, -1);
+
+    for (int32 regionX = 0; regionX < REGIONS_PER_AXIS; ++regionX)
+    {
+        for (int32 regionY = 0; regionY < REGIONS_PER_AXIS; ++regionY)
+        {
+            BotTravelStop center;
+            center.x = (regionX - REGIONS_PER_AXIS / 2 + 0.5f) * SIZE_OF_GRIDS;
+            center.y = (regionY - REGIONS_PER_AXIS / 2 + 0.5f) * SIZE_OF_GRIDS;
+
+            float nearestDistSq = MAX_ANCHOR_DISTANCE * MAX_ANCHOR_DISTANCE;
+            int32 nearestNode = -1;
+            for (BotTravelStop const& node : graph.nodes)
+            {
+                float const distSq = GetDistance2DSq(node, center);
+                if (distSq < nearestDistSq)
+                {
+                    nearestDistSq = distSq;
+                    nearestNode = int32(node.node);
+                }
+            }
+
+            graph.anchors[regionX * REGIONS_PER_AXIS + regionY] = nearestNode;
+        }
+    }
+}
+
+// ============================================================================
+// Routing
+// ============================================================================
+
+uint32 BotTravelGraph::GetRegion(float x, float y)
+{
+    int32 const regionX = std::min(std::max(int32(std::floor(x / SIZE_OF_GRIDS)) + REGIONS_PER_AXIS / 2, 0), REGIONS_PER_AXIS - 1);
+    int32 const regionY = std::min(std::max(int32(std::floor(y / SIZE_OF_GRIDS)) + REGIONS_PER_AXIS / 2, 0), REGIONS_PER_AXIS - 1);
+    return uint32(regionX * REGIONS_PER_AXIS + regionY);
+}
+
+BotTravelGraph::MapGraph* BotTravelGraph::FindGraph(uint32 mapId)
+{
+    if (!s_graphsBuilt)
+        Build();
+
+    auto itr = s_graphs.find(mapId);
+    return itr != s_graphs.end() ? itr->second.get() : nullptr;
+}
+
+bool BotTravelGraph::Search(MapGraph const& graph, uint32 fromNode, uint32 toNode, std::vector<uint32>& path)
+{
+    path.clear();
+
+    std::vector<BotTravelStop> const& nodes = graph.nodes;
+    std::vector<float> cost(nodes.size(), FLT_MAX);
+    std::vector<int32> previous(nodes.size(), -1);
+
+    typedef std::pair<float /*estimate*/, uint32 /*node*/> OpenEntry;
+    std::priority_queue<OpenEntry, std::vector<OpenEntry>, std::greater<OpenEntry>> open;
+
+    cost[fromNode] = 0.0f;
+    open.emplace(GetDistance3D(nodes[fromNode], nodes[toNode]), fromNode);
+
+    while (!open.empty())
+    {
+        OpenEntry const current = open.top();
+        open.pop();
+
+        uint32 const node = current.second;
+        if (node == toNode)
+            break;
+
+        // Stale entry, the node was reached cheaper since
+        if (current.first - GetDistance3D(nodes[node], nodes[toNode]) > cost[node] + 0.1f)
+            continue;
+
+        for (uint32 i = graph.linkStart[node]; i < graph.linkStart[node + 1]; ++i)
+        {
+            Link const& link = graph.links[i];
+            if (link.failures >= MAX_LINK_FAILURES)
+                continue;
+
+            float const linkCost = cost[node] + link.length;
+            if (linkCost >= cost[link.toNode])
+                continue;
+
+            cost[link.toNode] = linkCost;
+            previous[link.toNode] = int32(node);
+            open.emplace(linkCost + GetDistance3D(nodes[link.toNode], nodes[toNode]), link.toNode);
+        }
+    }
+
+    if (cost[toNode] == FLT_MAX)
+        return false;
+
+    for (int32 node = int32(toNode); node != -1; node = previous[node])
+        path.push_back(uint32(node));
+    std::reverse(path.begin(), path.end());
+    return true;
+}
+
+bool BotTravelGraph::FindRoute(uint32 mapId, float startX, float startY, float startZ,
+    float destX, float destY, float destZ, std::vector<BotTravelStop>& route)
+{
+    route.clear();
+
+    MapGraph* graph = FindGraph(mapId);
+    if (!graph)
+        return false;
+
+    uint32 const startRegion = GetRegion(startX, startY);
+    uint32 const destRegion = GetRegion(destX, destY);
+    int32 const startAnchor = graph->anchors[startRegion];
+    int32 const destAnchor = graph->anchors[destRegion];
+    if (startAnchor < 0 || destAnchor < 0)
+        return false;
+
+    BotTravelStop const start = { startX, startY, startZ, 0 };
+    BotTravelStop const dest = { destX, destY, destZ, 0 };
+
+    std::lock_guard<std::mutex> lock(graph->lock);
+
+    uint32 const key = (startRegion << 12) | destRegion;
+    auto itr = graph->routes.find(key);
+    if (itr != graph->routes.end())
+        ++s_routeHits;
+    else
+    {
+        ++s_routeMisses;
+
+        if (graph->routes.size() >= MAX_CACHED_ROUTES)
+            graph->routes.clear();
+
+        // Failed searches are cached too, as an empty route
+        std::vector<uint32> path;
+        Search(*graph, uint32(startAnchor), uint32(destAnchor), path);
+        itr = graph->routes.emplace(key, std::move(path)).first;
+    }
+
+    std::vector<uint32> const& path = itr->second;
+    if (path.empty())
+        return false;
+
+    // Join the shared route where it comes closest to this bot's start,
+    // and leave it where it comes closest to its destination
+    uint32 first = 0;
+    for (uint32 i = 1; i < path.size(); ++i)
+    {
+        if (GetDistance2DSq(graph->nodes[path[i]], start) < GetDistance2DSq(graph->nodes[path[first]], start))
+            first = i;
+    }
+
+    uint32 last = first;
+    for (uint32 i = first + 1; i < path.size(); ++i)
+    {
+        if (GetDistance2DSq(graph->nodes[path[i]], dest) < GetDistance2DSq(graph->nodes[path[last]], dest))
+            last = i;
+    }
+
+    for (uint32 i = first; i <= last; ++i)
+        route.push_back(graph->nodes[path[i]]);
+
+    return true;
+}
+
+void BotTravelGraph::ReportFailedLeg(uint32 mapId, uint32 fromNode, uint32 toNode)
+{
+    MapGraph* graph = FindGraph(mapId);
+    if (!graph || fromNode >= graph->nodes.size() || toNode >= graph->nodes.size())
+        return;
+
+    std::lock_guard<std::mutex> lock(graph->lock);
+
+    bool removed = false;
+    for (auto const& leg : { std::make_pair(fromNode, toNode), std::make_pair(toNode, fromNode) })
+    {
+        for (uint32 i = graph->linkStart[leg.first]; i < graph->linkStart[leg.first + 1]; ++i)
+        {
+            Link& link = graph->links[i];
+            if (link.toNode != leg.second || link.failures >= MAX_LINK_FAILURES)
+                continue;
+
+            if (++link.failures == MAX_LINK_FAILURES)
+                removed = true;
+        }
+    }
+
+    // Routes through the link are cached, search again
+    if (removed)
+    {
+        graph->routes.clear();
+
+        sLog.Out(LOG_BASIC, LOG_LVL_DEBUG,
+            "[BotTravelGraph] Map %u: removed link (%.1f, %.1f) - (%.1f, %.1f) after %u failed walks",
+            mapId, graph->nodes[fromNode].x, graph->nodes[fromNode].y,
+            graph->nodes[toNode].x, graph->nodes[toNode].y, uint32(MAX_LINK_FAILURES));
+    }
+}
+
+// ============================================================================
+// Stats
+// ============================================================================
+
+uint32 BotTravelGraph::GetNodeCount(uint32 mapId)
+{
+    MapGraph const* graph = FindGraph(mapId);
+    return graph ? uint32(graph->nodes.size()) : 0;
+}
+
+uint32 BotTravelGraph::GetLinkCount(uint32 mapId)
+{
+    MapGraph const* graph = FindGraph(mapId);
+    return graph ? uint32(graph->links.size()) : 0;
+}
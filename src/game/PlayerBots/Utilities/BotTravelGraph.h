@@ -0,0 +1,139 @@
+/*
+ * BotTravelGraph.h
+ *
+ * Coarse walking graph of each continent, used to plan long bot trips
+ * before any navmesh query is made.
+ *
+ * A single Detour query is capped at MAX_PATH_LENGTH polygons, so a trip
+ * across a zone or two came back incomplete, and the bot fell back on
+ * straight-line segments and re-pathed every time it got stuck on one.
+ * Long trips are now planned on this graph first. Detour only ever sees
+ * one leg of at most LINK_DISTANCE yards.
+ *
+ * Nodes are places bots can already walk to: flight masters, graveyards,
+ * vendors, trainers and grind spots. Those within NODE_MERGE_DISTANCE of
+ * each other are merged. Each node links to its MAX_LINKS nearest nodes
+ * within LINK_DISTANCE, unless the slope between them is too steep to
+ * walk. Links are not checked against the navmesh at startup, since its
+ * tiles are not loaded yet. Instead, bots report the leg they got stuck
+ * on, and a link reported MAX_LINK_FAILURES times is removed.
+ *
+ * Routes are found with A* between region anchors: the node nearest the
+ * center of each terrain grid sized region. They are cached per (source
+ * region, destination region), so bots heading from one area to another
+ * share one search. Each bot then trims the shared route to the nodes
+ * closest to its own start and destination.
+ *
+ * The nodes and links are built once at server startup. Route caches and
+ * link failures are behind a per-map mutex, since bots on the same map
+ * may run on several threads.
+ *
+ * Part of the vMangos RandomBot AI Project.
+ */
+
+#ifndef MANGOS_BOTTRAVELGRAPH_H
+#define MANGOS_BOTTRAVELGRAPH_H
+
+#include "Common.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+struct BotTravelStop
+{
+    float x;
+    float y;
+    float z;
+    uint32 node;
+};
+
+// ============================================================================
+// BotTravelGraph — Static per-map graph registry
+// ============================================================================
+
+class BotTravelGraph
+{
+public:
+    // ---- Graph building (called from PlayerBotMgr::Load) ----
+    static void Build();
+    static bool IsBuilt() { return s_graphsBuilt; }
+
+    // ---- Queries ----
+
+    // Graph nodes to walk through from start to dest, in order and not
+    // including either end. Replaces the content of route. Returns false
+    // if the map has no graph, no route was found or the route has no
+    // nodes to walk through.
+    static bool FindRoute(uint32 mapId, float startX, float startY, float startZ,
+        float destX, float destY, float destZ, std::vector<BotTravelStop>& route);
+
+    // A bot could not walk from one node to the next
+    static void ReportFailedLeg(uint32 mapId, uint32 fromNode, uint32 toNode);
+
+    // ---- Stats for logging ----
+    static uint32 GetNodeCount(uint32 mapId);
+    static uint32 GetLinkCount(uint32 mapId);
+    static uint64 GetRouteHits() { return s_routeHits.load(); }
+    static uint64 GetRouteMisses() { return s_routeMisses.load(); }
+
+    // Legs no longer than this are handed to the navmesh as is
+    static constexpr float LINK_DISTANCE = 400.0f;
+
+private:
+    struct Link
+    {
+        uint32 toNode;
+        float length;
+        uint8 failures;
+    };
+
+    struct MapGraph
+    {
+        std::vector<BotTravelStop> nodes;
+        std::vector<uint32> linkStart;          // linkStart[n]..linkStart[n + 1] are the links of node n
+        std::vector<Link> links;
+        std::vector<int32> anchors;             // node per region, -1 if none near
+
+        std::mutex lock;                        // everything below, and link failures
+        std::unordered_map<uint32 /*region pair*/, std::vector<uint32>> routes;
+    };
+
+    static void CollectNodes(uint32 mapId, std::vector<BotTravelStop>& nodes);
+    static void BuildLinks(MapGraph& graph);
+    static void BuildAnchors(MapGraph& graph);
+
+    static bool Search(MapGraph const& graph, uint32 fromNode, uint32 toNode, std::vector<uint32>& path);
+    static uint32 GetRegion(float x, float y);
+    static MapGraph* FindGraph(uint32 mapId);
+
+    static std::unordered_map<uint32 /*map id*/, std::unique_ptr<MapGraph>> s_graphs;
+    static bool s_graphsBuilt;
+    static std::mutex s_graphMutex;
+    static std::atomic<uint64> s_routeHits;
+    static std::atomic<uint64> s_routeMisses;
+
+    // Places this close are the same node
+    static constexpr float NODE_MERGE_DISTANCE = 40.0f;
+
+    // Links kept per node, nearest first
+    static constexpr uint32 MAX_LINKS = 8;
+
+    // Height change per yard walked above which a link is dropped
+    static constexpr float MAX_LINK_SLOPE = 0.6f;
+
+    // Reports of a stuck bot after which a link is removed
+    static constexpr uint8 MAX_LINK_FAILURES = 3;
+
+    // Cached routes per map before the cache is cleared
+    static constexpr uint32 MAX_CACHED_ROUTES = 8192;
+
+    // Regions are terrain grid sized, 64 per axis
+    static constexpr int32 REGIONS_PER_AXIS = 64;
+
+    // An anchor farther than this from its region center is not used
+    static constexpr float MAX_ANCHOR_DISTANCE = 1200.0f;
+};
+
+#endif // MANGOS_BOTTRAVELGRAPH_H
@@ -46,6 +46,7 @@
 #include "ZoneScript.h"
 #include "TradeData.h"
 #include "Geometry.h"
+#include "BotEvents.h"
 
 using namespace Spells;
 
@@ -5232,6 +5233,9 @@ void Spell::InitializeChanneledVisualTimer()
 
 void Spell::SendResurrectRequest(Player* target, bool sickness)
 {
+    if (target->GetSession()->PostBotEvent(BotEvent(BOT_EVENT_RESURRECT_REQUEST, m_caster->GetObjectGuid())))
+        return;
+
     // Both players and NPCs can resurrect using spells - have a look at creature 28487 for example
     // However, the packet structure differs slightly
 
@@ -49,6 +49,7 @@
 #include "InstanceData.h"
 #include "ScriptMgr.h"
 #include "SocialMgr.h"
+#include "BotEvents.h"
 
 using namespace Spells;
 
@@ -4658,8 +4659,10 @@ void Spell::EffectDuel(SpellEffectIndex effIdx)
     WorldPacket data(SMSG_DUEL_REQUESTED, 8 + 8);
     data << pGameObj->GetObjectGuid();
     data << caster->GetObjectGuid();
-    caster->GetSession()->SendPacket(&data);
-    target->GetSession()->SendPacket(&data);
+    if (!caster->GetSession()->PostBotEvent(BotEvent(BOT_EVENT_DUEL_REQUESTED, pGameObj->GetObjectGuid())))
+        caster->GetSession()->SendPacket(&data);
+    if (!target->GetSession()->PostBotEvent(BotEvent(BOT_EVENT_DUEL_REQUESTED, pGameObj->GetObjectGuid())))
+        target->GetSession()->SendPacket(&data);
 
     // create duel-info
     DuelInfo* duel   = new DuelInfo;
@@ -958,8 +958,11 @@ void World::LoadConfigSettings(bool reload)
     setConfigMinMax(CONFIG_UINT32_MAP_VISIBILITYUPDATE_THREADS, "MapUpdate.VisibilityUpdate.MaxThreads", 4, 1, 20);
     setConfigMinMax(CONFIG_UINT32_MAP_VISIBILITYUPDATE_TIMEOUT, "MapUpdate.VisibilityUpdate.Timeout", 100, 10, 2000);
     setConfigMinMax(CONFIG_UINT32_MAPUPDATE_INSTANCED_UPDATE_THREADS, "MapUpdate.Instanced.UpdateThreads", 2, 0, 20);
+    setConfigMinMax(CONFIG_UINT32_MAPUPDATE_SCHEDULER_THREADS, "MapUpdate.Scheduler.Threads", 0, 0, 256);
     setConfigMinMax(CONFIG_UINT32_MTCELLS_THREADS, "MapUpdate.Continents.MTCells.Threads", 0, 0, 20);
     setConfigMinMax(CONFIG_UINT32_MTCELLS_SAFEDISTANCE, "MapUpdate.Continents.MTCells.SafeDistance", 1066, 0, 34112);
+    setConfigMinMax(CONFIG_UINT32_MTPLAYERS_THREADS, "MapUpdate.Continents.MTPlayers.Threads", 0, 0, 20);
+    setConfig(CONFIG_BOOL_MTPLAYERS_VERIFY, "MapUpdate.Continents.MTPlayers.Verify", false);
     setConfigMinMax(CONFIG_UINT32_MAPUPDATE_UPDATE_PACKETS_DIFF, "MapUpdate.UpdatePacketsDiff", 100, 1, 10000);
     setConfigMinMax(CONFIG_UINT32_MAPUPDATE_UPDATE_PLAYERS_DIFF, "MapUpdate.UpdatePlayersDiff", 100, 1, 10000);
     setConfigMinMax(CONFIG_UINT32_MAPUPDATE_UPDATE_CELLS_DIFF, "MapUpdate.UpdateCellsDiff", 100, 1, 10000);
@@ -972,8 +975,13 @@ void World::LoadConfigSettings(bool reload)
     setConfig(CONFIG_UINT32_MAPUPDATE_MIN_VISIBILITY_DISTANCE, "MapUpdate.MinVisibilityDistance", 0);
     setConfig(CONFIG_BOOL_CONTINENTS_INSTANCIATE, "Continents.Instanciate", false);
     setConfig(CONFIG_UINT32_CONTINENTS_MOTIONUPDATE_THREADS, "Continents.MotionUpdate.Threads", 0);
+    setConfigMinMax(CONFIG_UINT32_CONTINENTS_PATHFINDING_THREADS, "Continents.Pathfinding.Threads", 4, 0, 64);
+    setConfigMinMax(CONFIG_UINT32_CONTINENTS_GRIDPREFETCH_THREADS, "Continents.GridPrefetch.Threads", 0, 0, 8);
+    setConfigMinMax(CONFIG_UINT32_CONTINENTS_GRIDPREFETCH_LOOKAHEAD, "Continents.GridPrefetch.LookAheadMs", 20000, 1000, 120000);
+    setConfig(CONFIG_UINT32_PATHFINDING_CACHE_SIZE_KB, "Pathfinding.Cache.SizeKB", 4096);
     setConfig(CONFIG_BOOL_TERRAIN_PRELOAD_CONTINENTS, "Terrain.Preload.Continents", true);
     setConfig(CONFIG_BOOL_TERRAIN_PRELOAD_INSTANCES, "Terrain.Preload.Instances", true);
+    setConfig(CONFIG_BOOL_TERRAIN_MEMORY_MAPPED, "Terrain.MemoryMapped", false);
 
     setConfig(CONFIG_BOOL_ENABLE_MOVEMENT_EXTRAPOLATION_CHARGE, "Movement.ExtrapolateChargePosition", true);
     setConfig(CONFIG_BOOL_ENABLE_MOVEMENT_EXTRAPOLATION_PET, "Movement.ExtrapolatePetPosition", true);
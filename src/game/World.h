@@ -142,7 +142,9 @@ enum eConfigUInt32Values
     CONFIG_UINT32_DYN_RESPAWN_AFFECT_LEVEL_BELOW,
     CONFIG_UINT32_MTCELLS_THREADS,
     CONFIG_UINT32_MTCELLS_SAFEDISTANCE,
+    CONFIG_UINT32_MTPLAYERS_THREADS,
     CONFIG_UINT32_MAPUPDATE_INSTANCED_UPDATE_THREADS,
+    CONFIG_UINT32_MAPUPDATE_SCHEDULER_THREADS,
     CONFIG_UINT32_MAPUPDATE_UPDATE_PACKETS_DIFF,
     CONFIG_UINT32_MAPUPDATE_UPDATE_PLAYERS_DIFF,
     CONFIG_UINT32_MAPUPDATE_UPDATE_CELLS_DIFF,
@@ -156,6 +158,10 @@ enum eConfigUInt32Values
     CONFIG_UINT32_PBCAST_DIFF_LOWER_VISIBILITY_DISTANCE,
     CONFIG_UINT32_MAPUPDATE_MIN_GRID_ACTIVATION_DISTANCE,
     CONFIG_UINT32_CONTINENTS_MOTIONUPDATE_THREADS,
+    CONFIG_UINT32_CONTINENTS_PATHFINDING_THREADS,
+    CONFIG_UINT32_CONTINENTS_GRIDPREFETCH_THREADS,
+    CONFIG_UINT32_CONTINENTS_GRIDPREFETCH_LOOKAHEAD,
+    CONFIG_UINT32_PATHFINDING_CACHE_SIZE_KB,
     CONFIG_UINT32_PERFLOG_SLOW_WORLD_UPDATE,
     CONFIG_UINT32_PERFLOG_SLOW_MAP_UPDATE,
     CONFIG_UINT32_PERFLOG_SLOW_MAPSYSTEM_UPDATE,
@@ -471,6 +477,7 @@ enum eConfigBoolValues
     CONFIG_BOOL_GMTICKETS_ENABLE,
     CONFIG_BOOL_TAG_IN_BATTLEGROUNDS,
     CONFIG_BOOL_CONTINENTS_INSTANCIATE,
+    CONFIG_BOOL_MTPLAYERS_VERIFY,
     CONFIG_BOOL_GM_JOIN_OPPOSITE_FACTION_CHANNELS,
     CONFIG_BOOL_GM_ALLOW_TRADES,
     CONFIG_BOOL_DIE_COMMAND_CREDIT,
@@ -486,6 +493,7 @@ enum eConfigBoolValues
     CONFIG_BOOL_SMARTLOG_LONGCOMBAT,
     CONFIG_BOOL_TERRAIN_PRELOAD_CONTINENTS,
     CONFIG_BOOL_TERRAIN_PRELOAD_INSTANCES,
+    CONFIG_BOOL_TERRAIN_MEMORY_MAPPED,
     CONFIG_BOOL_CLEANUP_TERRAIN,
     CONFIG_BOOL_OUTDOORPVP_EP_ENABLE,
     CONFIG_BOOL_OUTDOORPVP_SI_ENABLE,
@@ -41,6 +41,7 @@
 #include "SocialMgr.h"
 #include "PlayerBotMgr.h"
 #include "PlayerBotAI.h"
+#include "BotEvents.h"
 #include "Anticheat.h"
 #include "Language.h"
 #include "Chat.h"
@@ -76,7 +77,7 @@ WorldSession::WorldSession(uint32 id, std::shared_ptr<WorldSocket> sock, Account
     m_exhaustionState(0), m_createTime(time(nullptr)), m_previousPlayTime(0), m_logoutTime(0), m_inQueue(false),
     m_playerLoading(false), m_playerLogout(false), m_playerRecentlyLogout(false), m_playerSave(false), m_sessionDbcLocale(sWorld.GetAvailableDbcLocale(locale)),
     m_sessionDbLocaleIndex(sObjectMgr.GetIndexForLocale(locale)), m_latency(0), m_tutorialState(TUTORIALDATA_UNCHANGED), m_warden(nullptr), m_cheatData(nullptr),
-    m_bot(nullptr), m_clientOS(CLIENT_OS_UNKNOWN), m_clientPlatform(CLIENT_PLATFORM_UNKNOWN), m_gameBuild(0), m_verifiedEmail(true),
+    m_bot(nullptr), m_headless(false), m_deferLogin(false), m_deferredLoginHolder(nullptr), m_clientOS(CLIENT_OS_UNKNOWN), m_clientPlatform(CLIENT_PLATFORM_UNKNOWN), m_gameBuild(0), m_verifiedEmail(true),
     m_charactersCount(10), m_characterMaxLevel(0), m_lastPubChannelMsgTime(0), m_moveRejectTime(0), m_masterPlayer(nullptr), m_receivedPacketType{},
     m_floodPacketsCount{}, m_tutorials{}
 {
@@ -90,6 +91,9 @@ WorldSession::~WorldSession()
     if (_player)
         LogoutPlayer(!m_bot || sPlayerBotMgr.IsSavingAllowed());
 
+    // Login data of a bot that never got admitted
+    delete m_deferredLoginHolder;
+
     // If have unclosed socket, close it
     if (m_socket)
     {
@@ -126,7 +130,7 @@ void WorldSession::SendPacket(WorldPacket const* packet)
 
     if (!m_socket)
     {
-        if (GetBot() && GetBot()->ai)
+        if (GetBot() && GetBot()->ai && (!m_headless || GetBot()->ai->WantsPacket(packet->GetOpcode())))
             GetBot()->ai->OnPacketReceived(packet);
         return;
     }
@@ -134,6 +138,15 @@ void WorldSession::SendPacket(WorldPacket const* packet)
     SendPacketImpl(packet);
 }
 
+bool WorldSession::PostBotEvent(BotEvent const& event)
+{
+    if (m_socket || !GetBot() || !GetBot()->ai)
+        return false;
+
+    GetBot()->ai->PostEvent(event);
+    return m_headless;
+}
+
 void WorldSession::SendPacketImpl(WorldPacket const* packet)
 {
 #ifdef _DEBUG
@@ -192,7 +205,7 @@ void WorldSession::SendMovementPacket(WorldPacket const* packet)
 
     if (!m_socket)
     {
-        if (GetBot() && GetBot()->ai)
+        if (GetBot() && GetBot()->ai && (!m_headless || GetBot()->ai->WantsPacket(packet->GetOpcode())))
             GetBot()->ai->OnPacketReceived(packet);
         return;
     }
@@ -51,6 +51,7 @@ class WorldPacket;
 class WorldSocket;
 class QueryResult;
 class LoginQueryHolder;
+class SqlQueryHolder;
 class CharacterHandler;
 class MovementInfo;
 class WorldSession;
@@ -61,6 +62,7 @@ class MasterPlayer;
 
 struct OpcodeHandler;
 struct PlayerBotEntry;
+struct BotEvent;
 
 enum PartyOperation
 {
@@ -280,6 +282,19 @@ class WorldSession
         // Bot system
         PlayerBotEntry* GetBot() const { return m_bot.get(); }
         void SetBot(std::shared_ptr<PlayerBotEntry> const& b) { m_bot = b; }
+        // Headless sessions have no client: outgoing packets are not built,
+        // only opcodes the bot AI consumes are delivered to it.
+        bool IsHeadless() const { return m_headless; }
+        void SetHeadless(bool headless) { m_headless = headless; }
+        // Hands an event to the bot AI of this session. Returns true if the
+        // session is headless, the matching packet need not be sent then.
+        bool PostBotEvent(BotEvent const& event);
+        // Deferred login keeps the loaded character query holder when it
+        // arrives, the player only enters the world on CompleteDeferredLogin().
+        void SetDeferredLogin(bool defer) { m_deferLogin = defer; }
+        bool HasDeferredLoginData() const { return m_deferredLoginHolder != nullptr; }
+        bool DeferLogin(SqlQueryHolder* holder);
+        void CompleteDeferredLogin();
 
         // Warden / Anticheat
         void InitWarden();
@@ -805,6 +820,9 @@ class WorldSession
         uint32 m_gameBuild;
         bool m_verifiedEmail;
         std::shared_ptr<PlayerBotEntry> m_bot;
+        bool m_headless;
+        bool m_deferLogin;
+        SqlQueryHolder* m_deferredLoginHolder;
         std::unique_ptr<SniffFile> m_sniffFile;
 
         Warden* m_warden;
@@ -30,6 +30,7 @@
 #include <algorithm>
 
 #define MAX_STACK_SIZE 64
+#define RAY_PACKET_SIZE 8
 
 using G3D::Vector3;
 using G3D::AABox;
@@ -262,6 +263,237 @@ class BIH
             }
         }
 
+        // Direction sign bits of a ray, rays of one packet must share them
+        static uint32 getRayOctant(Vector3 const& dir)
+        {
+            return (floatToRawIntBits(dir.x) >> 31) | ((floatToRawIntBits(dir.y) >> 31) << 1) | ((floatToRawIntBits(dir.z) >> 31) << 2);
+        }
+
+        /* Any-hit traversal of up to RAY_PACKET_SIZE rays at once. All rays
+           must have the same getRayOctant(direction). Each node is fetched
+           once for the whole packet, and the per-ray slab tests run over
+           plain arrays. A ray leaves the packet at its first hit, and hit[i]
+           is set. */
+        template<typename RayCallback>
+        void intersectRayPacket(Ray const* rays, float const* maxDist, uint32 count, RayCallback& intersectCallback, bool* hit, bool ignoreM2Model = false) const
+        {
+            float org[3][RAY_PACKET_SIZE];
+            float invDir[3][RAY_PACKET_SIZE];
+            float intervalMin[RAY_PACKET_SIZE];
+            float intervalMax[RAY_PACKET_SIZE];
+            uint32 active = 0;
+
+            count = std::min(count, uint32(RAY_PACKET_SIZE));
+            for (uint32 r = 0; r < count; ++r)
+            {
+                hit[r] = false;
+                intervalMin[r] = 0.f;
+                intervalMax[r] = 0.f;
+
+                Vector3 const& rayOrg = rays[r].origin();
+                Vector3 const& dir = rays[r].direction();
+                Vector3 const& rayInvDir = rays[r].invDirection();
+                for (int i = 0; i < 3; ++i)
+                {
+                    org[i][r] = rayOrg[i];
+                    invDir[i][r] = rayInvDir[i];
+                }
+
+                // Clip to the tree bounds, same as intersectRay
+                float tMin = -1.f;
+                float tMax = -1.f;
+                bool outside = false;
+                for (int i = 0; i < 3 && !outside; ++i)
+                {
+                    if (G3D::fuzzyNe(dir[i], 0.0f))
+                    {
+                        float t1 = (bounds.low()[i]  - rayOrg[i]) * rayInvDir[i];
+                        float t2 = (bounds.high()[i] - rayOrg[i]) * rayInvDir[i];
+                        if (t1 > t2)
+                            std::swap(t1, t2);
+                        if (t1 > tMin)
+                            tMin = t1;
+                        if (t2 < tMax || tMax < 0.f)
+                            tMax = t2;
+                        if (tMax <= 0 || tMin >= maxDist[r])
+                            outside = true;
+                    }
+                }
+
+                if (outside || tMin > tMax)
+                    continue;
+
+                intervalMin[r] = std::max(tMin, 0.f);
+                intervalMax[r] = std::min(tMax, maxDist[r]);
+                active |= 1 << r;
+            }
+
+            if (!active)
+                return;
+
+            uint32 offsetFront[3];
+            uint32 offsetBack[3];
+            uint32 offsetFront3[3];
+            uint32 offsetBack3[3];
+            Vector3 const& dir = rays[0].direction();
+            for (int i = 0; i < 3; ++i)
+            {
+                offsetFront[i] = floatToRawIntBits(dir[i]) >> 31;
+                offsetBack[i] = offsetFront[i] ^ 1;
+                offsetFront3[i] = offsetFront[i] * 3;
+                offsetBack3[i] = offsetBack[i] * 3;
+                ++offsetFront[i];
+                ++offsetBack[i];
+            }
+
+            PacketStackNode stack[MAX_STACK_SIZE];
+            int stackPos = 0;
+            int node = 0;
+            uint32 mask = active;
+            uint32 done = 0;
+            float tf[RAY_PACKET_SIZE];
+            float tb[RAY_PACKET_SIZE];
+
+            while (true)
+            {
+                while (true)
+                {
+                    uint32 tn = tree[node];
+                    uint32 axis = (tn >> 30) & 3;
+                    bool const BVH2 = tn & (1 << 29);
+                    int offset = tn & ~(7 << 29);
+                    if (!BVH2)
+                    {
+                        if (axis < 3)
+                        {
+                            // "normal" interior node
+                            float const splitFront = intBitsToFloat(tree[node + offsetFront[axis]]);
+                            float const splitBack = intBitsToFloat(tree[node + offsetBack[axis]]);
+                            for (uint32 r = 0; r < count; ++r)
+                            {
+                                tf[r] = (splitFront - org[axis][r]) * invDir[axis][r];
+                                tb[r] = (splitBack - org[axis][r]) * invDir[axis][r];
+                            }
+
+                            uint32 frontMask = 0;
+                            uint32 backMask = 0;
+                            for (uint32 r = 0; r < count; ++r)
+                            {
+                                if (!(mask & (1 << r)))
+                                    continue;
+                                if (tf[r] >= intervalMin[r])
+                                    frontMask |= 1 << r;
+                                if (tb[r] <= intervalMax[r])
+                                    backMask |= 1 << r;
+                            }
+
+                            int const back = offset + offsetBack3[axis];
+                            int const front = offset + offsetFront3[axis];
+
+                            // rays pass through both nodes: push back node
+                            if (frontMask && backMask)
+                            {
+                                PacketStackNode& entry = stack[stackPos++];
+                                entry.node = back;
+                                entry.mask = backMask;
+                                for (uint32 r = 0; r < count; ++r)
+                                {
+                                    entry.tnear[r] = (tb[r] >= intervalMin[r]) ? tb[r] : intervalMin[r];
+                                    entry.tfar[r] = intervalMax[r];
+                                }
+                            }
+                            else if (backMask)
+                            {
+                                // rays pass through far node only
+                                node = back;
+                                mask = backMask;
+                                for (uint32 r = 0; r < count; ++r)
+                                    intervalMin[r] = (tb[r] >= intervalMin[r]) ? tb[r] : intervalMin[r];
+                                continue;
+                            }
+
+                            if (frontMask)
+                            {
+                                node = front;
+                                mask = frontMask;
+                                for (uint32 r = 0; r < count; ++r)
+                                    intervalMax[r] = (tf[r] <= intervalMax[r]) ? tf[r] : intervalMax[r];
+                                continue;
+                            }
+
+                            // rays pass between clip zones
+                            break;
+                        }
+                        else
+                        {
+                            // leaf - test some objects
+                            int n = tree[node + 1];
+                            while (n > 0)
+                            {
+                                for (uint32 r = 0; r < count; ++r)
+                                {
+                                    if (!(mask & (1 << r)))
+                                        continue;
+
+                                    float distance = maxDist[r];
+                                    if (intersectCallback(rays[r], objects[offset], distance, true, ignoreM2Model))
+                                    {
+                                        hit[r] = true;
+                                        done |= 1 << r;
+                                        mask &= ~(1 << r);
+                                    }
+                                }
+                                if (done == active)
+                                    return;
+                                --n;
+                                ++offset;
+                            }
+                            break;
+                        }
+                    }
+                    else
+                    {
+                        if (axis > 2)
+                            return; // should not happen
+                        float const splitFront = intBitsToFloat(tree[node + offsetFront[axis]]);
+                        float const splitBack = intBitsToFloat(tree[node + offsetBack[axis]]);
+                        for (uint32 r = 0; r < count; ++r)
+                        {
+                            float const rayTf = (splitFront - org[axis][r]) * invDir[axis][r];
+                            float const rayTb = (splitBack - org[axis][r]) * invDir[axis][r];
+                            intervalMin[r] = (rayTf >= intervalMin[r]) ? rayTf : intervalMin[r];
+                            intervalMax[r] = (rayTb <= intervalMax[r]) ? rayTb : intervalMax[r];
+                            if (intervalMin[r] > intervalMax[r])
+                                mask &= ~(1 << r);
+                        }
+                        node = offset;
+                        if (!mask)
+                            break;
+                        continue;
+                    }
+                } // traversal loop
+                do
+                {
+                    // stack is empty?
+                    if (stackPos == 0)
+                        return;
+                    // move back up the stack, without the rays that hit already
+                    --stackPos;
+                    mask = stack[stackPos].mask & ~done;
+                    if (!mask)
+                        continue;
+                    node = stack[stackPos].node;
+                    for (uint32 r = 0; r < count; ++r)
+                    {
+                        intervalMin[r] = stack[stackPos].tnear[r];
+                        intervalMax[r] = stack[stackPos].tfar[r];
+                    }
+                    break;
+                }
+                while (true);
+            }
+        }
+
         template<typename IsectCallback>
         void intersectPoint(Vector3 const& p, IsectCallback& intersectCallback) const
         {
@@ -366,6 +598,13 @@ class BIH
             float tnear;
             float tfar;
         };
+        struct PacketStackNode
+        {
+            uint32 node;
+            uint32 mask;
+            float tnear[RAY_PACKET_SIZE];
+            float tfar[RAY_PACKET_SIZE];
+        };
 
         class BuildStats
         {
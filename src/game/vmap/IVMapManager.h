@@ -31,6 +31,7 @@ This is the minimum interface to the VMapMamager.
 namespace VMAP
 {
     class ModelInstance;
+    struct StaticMapTile;
 
     enum VMAPLoadResult
     {
@@ -42,6 +43,14 @@ namespace VMAP
 #define VMAP_INVALID_HEIGHT       (-100000.0f)            // for check
 #define VMAP_INVALID_HEIGHT_VALUE (-200000.0f)            // real assigned value in unknown height case
 
+    // One segment of a batched line of sight query
+    struct LineOfSightSegment
+    {
+        float x1, y1, z1;
+        float x2, y2, z2;
+        bool inLineOfSight;                                 // result
+    };
+
     //===========================================================
     class IVMapManager
     {
@@ -56,6 +65,12 @@ namespace VMAP
             virtual ~IVMapManager(void) {}
 
             virtual VMAPLoadResult loadMap(char const* pBasePath, unsigned int pMapId, int x, int y) = 0;
+            /**
+            read a tile ahead of loading it, from any thread: the loaded maps are left untouched.
+            The tile is then given to loadMap, on the thread owning the map.
+            */
+            virtual bool readMapTile(char const* pBasePath, unsigned int pMapId, int x, int y, StaticMapTile& tile) = 0;
+            virtual VMAPLoadResult loadMap(char const* pBasePath, unsigned int pMapId, int x, int y, StaticMapTile const* tile) = 0;
 
             virtual bool existsMap(char const* pBasePath, unsigned int pMapId, int x, int y) = 0;
 
@@ -63,6 +78,11 @@ namespace VMAP
             virtual void unloadMap(unsigned int pMapId) = 0;
 
             virtual bool isInLineOfSight(unsigned int pMapId, float x1, float y1, float z1, float x2, float y2, float z2, bool ignoreM2Model) = 0;
+            /**
+            isInLineOfSight for many segments on one map, sets inLineOfSight of each.
+            The map tree is looked up once and the rays are traced in packets.
+            */
+            virtual void areInLineOfSight(unsigned int pMapId, LineOfSightSegment* segments, uint32 count, bool ignoreM2Model) = 0;
             virtual float getHeight(unsigned int pMapId, float x, float y, float z, float maxSearchDist) = 0;
             /**
             test if we hit an object. return true if we hit one. rx,ry,rz will hold the hit position or the dest position, if no intersection was found
@@ -218,6 +218,57 @@ namespace VMAP
         G3D::Ray ray = G3D::Ray::fromOriginAndDirection(pos1, (pos2 - pos1) / maxDist);
         return !getIntersectionTime(ray, maxDist, true, ignoreM2Model);
     }
+
+    void StaticMapTree::isInLineOfSight(Vector3 const* pos1, Vector3 const* pos2, uint32 count, bool ignoreM2Model, bool* results) const
+    {
+        // ray indices per direction octant, flushed as a packet when full
+        uint32 pending[8][RAY_PACKET_SIZE];
+        uint32 pendingCount[8] = {};
+        G3D::Ray rays[RAY_PACKET_SIZE];
+        float maxDists[RAY_PACKET_SIZE];
+        bool hits[RAY_PACKET_SIZE];
+        MapRayCallback intersectionCallBack(iTreeValues);
+
+        auto flush = [&](uint32 octant)
+        {
+            uint32 const n = pendingCount[octant];
+            for (uint32 i = 0; i < n; ++i)
+            {
+                uint32 const index = pending[octant][i];
+                maxDists[i] = (pos2[index] - pos1[index]).magnitude();
+                rays[i] = G3D::Ray::fromOriginAndDirection(pos1[index], (pos2[index] - pos1[index]) / maxDists[i]);
+            }
+
+            iTree.intersectRayPacket(rays, maxDists, n, intersectionCallBack, hits, ignoreM2Model);
+
+            for (uint32 i = 0; i < n; ++i)
+                results[pending[octant][i]] = !hits[i];
+            pendingCount[octant] = 0;
+        };
+
+        for (uint32 index = 0; index < count; ++index)
+        {
+            float const maxDist = (pos2[index] - pos1[index]).magnitude();
+            MANGOS_ASSERT(maxDist < std::numeric_limits<float>::max());
+            if (maxDist < 1e-10f)
+            {
+                results[index] = true;
+                continue;
+            }
+
+            uint32 const octant = BIH::getRayOctant((pos2[index] - pos1[index]) / maxDist);
+            pending[octant][pendingCount[octant]++] = index;
+            if (pendingCount[octant] == RAY_PACKET_SIZE)
+                flush(octant);
+        }
+
+        for (uint32 octant = 0; octant < 8; ++octant)
+        {
+            if (pendingCount[octant])
+                flush(octant);
+        }
+    }
+
     //=========================================================
     /**
     When moving from pos1 to pos2 check if we hit an object. Return true and the position if we hit one
@@ -420,6 +471,61 @@ namespace VMAP
     //=========================================================
 
     bool StaticMapTree::LoadMapTile(uint32 tileX, uint32 tileY, VMapManager2* vm)
+    {
+        StaticMapTile tile;
+        if (iIsTiled && iTreeValues)
+            ReadMapTile(iBasePath, iMapID, tileX, tileY, vm, tile);
+        return AttachMapTile(tileX, tileY, tile);
+    }
+
+    //=========================================================
+
+    bool StaticMapTree::ReadMapTile(std::string const& basePath, uint32 mapID, uint32 tileX, uint32 tileY, VMapManager2* vm, StaticMapTile& tile)
+    {
+        std::string tilePath = basePath;
+        if (tilePath.length() > 0 && (tilePath[tilePath.length() - 1] != '/' && tilePath[tilePath.length() - 1] != '\\'))
+            tilePath.append("/");
+
+        tile.read = true;
+        tile.spawns.clear();
+
+        std::string tilefile = tilePath + getTileFileName(mapID, tileX, tileY);
+        FILE* tf = fopen(tilefile.c_str(), "rb");
+        tile.exists = tf != nullptr;
+        tile.valid = true;
+        if (!tf)
+            return true;
+
+        char chunk[8];
+        if (!readChunk(tf, chunk, VMAP_MAGIC, 8))
+            tile.valid = false;
+        uint32 numSpawns = 0;
+        if (tile.valid && fread(&numSpawns, sizeof(uint32), 1, tf) != 1)
+            tile.valid = false;
+        for (uint32 i = 0; i < numSpawns && tile.valid; ++i)
+        {
+            // read model spawns
+            StaticMapTile::Spawn entry;
+            tile.valid = ModelSpawn::readFromFile(tf, entry.spawn);
+            if (tile.valid)
+            {
+                // acquire model instance
+                entry.model = vm->acquireModelInstance(tilePath, entry.spawn.name);
+                if (!entry.model)
+                    sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "StaticMapTree::ReadMapTile() could not acquire WorldModel pointer for '%s'!", entry.spawn.name.c_str());
+
+                entry.referencedVal = 0;
+                fread(&entry.referencedVal, sizeof(uint32), 1, tf);
+                tile.spawns.push_back(std::move(entry));
+            }
+        }
+        fclose(tf);
+        return tile.valid;
+    }
+
+    //=========================================================
+
+    bool StaticMapTree::AttachMapTile(uint32 tileX, uint32 tileY, StaticMapTile const& tile)
     {
         if (!iIsTiled)
         {
@@ -433,64 +539,38 @@ namespace VMAP
             sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "StaticMapTree::LoadMapTile(): Tree has not been initialized! [%u,%u]", tileX, tileY);
             return false;
         }
-        bool result = true;
 
-        std::string tilefile = iBasePath + getTileFileName(iMapID, tileX, tileY);
-        FILE* tf = fopen(tilefile.c_str(), "rb");
-        if (tf)
+        for (StaticMapTile::Spawn const& entry : tile.spawns)
         {
-            char chunk[8];
-            if (!readChunk(tf, chunk, VMAP_MAGIC, 8))
-                result = false;
-            uint32 numSpawns = 0;
-            if (result && fread(&numSpawns, sizeof(uint32), 1, tf) != 1)
-                result = false;
-            for (uint32 i = 0; i < numSpawns && result; ++i)
+            // models are shared between maps, only flag them once in use
+            if (entry.model)
+                entry.model->setModelFlags(entry.spawn.flags);
+
+            // update tree
+            uint32 const referencedVal = entry.referencedVal;
+            if (!iLoadedSpawns.count(referencedVal))
             {
-                // read model spawns
-                ModelSpawn spawn;
-                result = ModelSpawn::readFromFile(tf, spawn);
-                if (result)
+                if (referencedVal > iNTreeValues)
                 {
-                    // acquire model instance
-                    std::shared_ptr<WorldModel> model = vm->acquireModelInstance(iBasePath, spawn.name);
-                    if (model)
-                        model->setModelFlags(spawn.flags);
-                    else
-                        sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "StaticMapTree::LoadMapTile() could not acquire WorldModel pointer for '%s'!", spawn.name.c_str());
-
-                    // update tree
-                    uint32 referencedVal;
-
-                    fread(&referencedVal, sizeof(uint32), 1, tf);
-                    if (!iLoadedSpawns.count(referencedVal))
-                    {
-                        if (referencedVal > iNTreeValues)
-                        {
-                            sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "invalid tree element! (%u/%u)", referencedVal, iNTreeValues);
-                            continue;
-                        }
-                        iTreeValues[referencedVal] = ModelInstance(spawn, model);
-                        iLoadedSpawns[referencedVal] = 1;
-                    }
-                    else
-                    {
-                        ++iLoadedSpawns[referencedVal];
-    #ifdef VMAP_DEBUG
-                        if (iTreeValues[referencedVal].ID != spawn.ID)
-                            sLog.Out(LOG_BASIC, LOG_LVL_DEBUG, "Error: trying to load wrong spawn in node!");
-                        else if (iTreeValues[referencedVal].name != spawn.name)
-                            sLog.Out(LOG_BASIC, LOG_LVL_DEBUG, "Error: name mismatch on GUID=%u", spawn.ID);
-    #endif
-                    }
+                    sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "invalid tree element! (%u/%u)", referencedVal, iNTreeValues);
+                    continue;
                 }
+                iTreeValues[referencedVal] = ModelInstance(entry.spawn, entry.model);
+                iLoadedSpawns[referencedVal] = 1;
+            }
+            else
+            {
+                ++iLoadedSpawns[referencedVal];
+#ifdef VMAP_DEBUG
+                if (iTreeValues[referencedVal].ID != entry.spawn.ID)
+                    sLog.Out(LOG_BASIC, LOG_LVL_DEBUG, "Error: trying to load wrong spawn in node!");
+                else if (iTreeValues[referencedVal].name != entry.spawn.name)
+                    sLog.Out(LOG_BASIC, LOG_LVL_DEBUG, "Error: name mismatch on GUID=%u", entry.spawn.ID);
+#endif
             }
-            iLoadedTiles[packTileID(tileX, tileY)] = true;
-            fclose(tf);
         }
-        else
-            iLoadedTiles[packTileID(tileX, tileY)] = false;
-        return result;
+        iLoadedTiles[packTileID(tileX, tileY)] = tile.exists;
+        return tile.valid;
     }
 
     //=========================================================
@@ -21,7 +21,9 @@
 
 #include "Platform/Define.h"
 #include <unordered_map>
+#include <vector>
 #include "BIH.h"
+#include "ModelInstance.h"
 
 namespace VMAP
 {
@@ -44,6 +46,22 @@ namespace VMAP
         int32 rootId;
     };
 
+    // A tile file read ahead of being attached to its tree, see StaticMapTree::ReadMapTile()
+    struct StaticMapTile
+    {
+        struct Spawn
+        {
+            ModelSpawn spawn;
+            std::shared_ptr<WorldModel> model;
+            uint32 referencedVal;
+        };
+
+        std::vector<Spawn> spawns;
+        bool read = false;                                  // ReadMapTile() ran
+        bool exists = false;                                // the tile has a file
+        bool valid = true;                                  // the file was read entirely
+    };
+
     class StaticMapTree
     {
             typedef std::unordered_map<uint32, bool> loadedTileMap;
@@ -76,6 +94,8 @@ namespace VMAP
             ~StaticMapTree();
 
             bool isInLineOfSight(G3D::Vector3 const& pos1, G3D::Vector3 const& pos2, bool ignoreM2Model) const;
+            // results[i]: pos1[i] sees pos2[i]. Rays are traced in packets of the same direction octant.
+            void isInLineOfSight(G3D::Vector3 const* pos1, G3D::Vector3 const* pos2, uint32 count, bool ignoreM2Model, bool* results) const;
             ModelInstance* FindCollisionModel(G3D::Vector3 const& pos1, G3D::Vector3 const& pos2);
             bool getObjectHitPos(G3D::Vector3 const& pos1, G3D::Vector3 const& pos2, G3D::Vector3& pResultHitPos, float pModifyDist) const;
             float getHeight(G3D::Vector3 const& pPos, float maxSearchDist) const;
@@ -86,6 +106,10 @@ namespace VMAP
             bool InitMap(std::string const& fname, VMapManager2* vm);
             void UnloadMap(VMapManager2* vm);
             bool LoadMapTile(uint32 tileX, uint32 tileY, VMapManager2* vm);
+            // Reads the tile file and acquires its models, without touching any tree: safe from any thread
+            static bool ReadMapTile(std::string const& basePath, uint32 mapID, uint32 tileX, uint32 tileY, VMapManager2* vm, StaticMapTile& tile);
+            // Inserts a tile read by ReadMapTile() into the tree
+            bool AttachMapTile(uint32 tileX, uint32 tileY, StaticMapTile const& tile);
             void UnloadMapTile(uint32 tileX, uint32 tileY, VMapManager2* vm);
             bool isTiled() const { return iIsTiled; }
             uint32 numLoadedTiles() const { return iLoadedTiles.size(); }
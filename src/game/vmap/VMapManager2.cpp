@@ -71,11 +71,28 @@ namespace VMAP
     //=========================================================
 
     VMAPLoadResult VMapManager2::loadMap(char const* pBasePath, unsigned int pMapId, int x, int y)
+    {
+        return loadMap(pBasePath, pMapId, x, y, nullptr);
+    }
+
+    //=========================================================
+
+    bool VMapManager2::readMapTile(char const* pBasePath, unsigned int pMapId, int x, int y, StaticMapTile& tile)
+    {
+        if (!isMapLoadingEnabled())
+            return false;
+
+        return StaticMapTree::ReadMapTile(pBasePath, pMapId, x, y, this, tile);
+    }
+
+    //=========================================================
+
+    VMAPLoadResult VMapManager2::loadMap(char const* pBasePath, unsigned int pMapId, int x, int y, StaticMapTile const* tile)
     {
         VMAPLoadResult result = VMAP_LOAD_RESULT_IGNORED;
         if (isMapLoadingEnabled())
         {
-            if (_loadMap(pMapId, pBasePath, x, y))
+            if (_loadMap(pMapId, pBasePath, x, y, tile))
                 result = VMAP_LOAD_RESULT_OK;
             else
                 result = VMAP_LOAD_RESULT_ERROR;
@@ -86,7 +103,7 @@ namespace VMAP
     //=========================================================
     // load one tile (internal use only)
 
-    bool VMapManager2::_loadMap(unsigned int pMapId, std::string const& basePath, uint32 tileX, uint32 tileY)
+    bool VMapManager2::_loadMap(unsigned int pMapId, std::string const& basePath, uint32 tileX, uint32 tileY, StaticMapTile const* tile)
     {
         InstanceTreeMap::iterator instanceTree = iInstanceMapTrees.find(pMapId);
         if (instanceTree == iInstanceMapTrees.end())
@@ -100,6 +117,11 @@ namespace VMAP
             }
             instanceTree = iInstanceMapTrees.insert(InstanceTreeMap::value_type(pMapId, newTree)).first;
         }
+
+        // tile read ahead, only the tree is left to update
+        if (tile && tile->read)
+            return instanceTree->second->AttachMapTile(tileX, tileY, *tile);
+
         return instanceTree->second->LoadMapTile(tileX, tileY, this);
     }
 
@@ -151,6 +173,38 @@ namespace VMAP
         }
         return result;
     }
+    void VMapManager2::areInLineOfSight(unsigned int pMapId, LineOfSightSegment* segments, uint32 count, bool ignoreM2Model)
+    {
+        InstanceTreeMap::iterator instanceTree = iInstanceMapTrees.find(pMapId);
+        if (!isLineOfSightCalcEnabled() || instanceTree == iInstanceMapTrees.end())
+        {
+            for (uint32 i = 0; i < count; ++i)
+                segments[i].inLineOfSight = true;
+            return;
+        }
+
+        // Chunks on the stack, no allocation
+        uint32 const CHUNK_SIZE = 64;
+        Vector3 pos1[CHUNK_SIZE];
+        Vector3 pos2[CHUNK_SIZE];
+        bool results[CHUNK_SIZE];
+
+        for (uint32 start = 0; start < count; start += CHUNK_SIZE)
+        {
+            uint32 const n = std::min(count - start, CHUNK_SIZE);
+            for (uint32 i = 0; i < n; ++i)
+            {
+                LineOfSightSegment const& segment = segments[start + i];
+                pos1[i] = convertPositionToInternalRep(segment.x1, segment.y1, segment.z1);
+                pos2[i] = convertPositionToInternalRep(segment.x2, segment.y2, segment.z2);
+            }
+
+            instanceTree->second->isInLineOfSight(pos1, pos2, n, ignoreM2Model, results);
+
+            for (uint32 i = 0; i < n; ++i)
+                segments[start + i].inLineOfSight = results[i];
+        }
+    }
     ModelInstance* VMapManager2::FindCollisionModel(unsigned int mapId, float x0, float y0, float z0, float x1, float y1, float z1)
     {
         if (!isLineOfSightCalcEnabled()) return nullptr;
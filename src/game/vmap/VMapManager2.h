@@ -68,7 +68,7 @@ namespace VMAP
             ModelFileMap iLoadedModelFiles;
             InstanceTreeMap iInstanceMapTrees;
 
-            bool _loadMap(uint32 pMapId, std::string const& basePath, uint32 tileX, uint32 tileY);
+            bool _loadMap(uint32 pMapId, std::string const& basePath, uint32 tileX, uint32 tileY, StaticMapTile const* tile);
             /* void _unloadMap(uint32 pMapId, uint32 x, uint32 y); */
 
             std::shared_timed_mutex    m_modelsLock;
@@ -81,11 +81,14 @@ namespace VMAP
             ~VMapManager2();
 
             VMAPLoadResult loadMap(char const* pBasePath, unsigned int pMapId, int x, int y) override;
+            bool readMapTile(char const* pBasePath, unsigned int pMapId, int x, int y, StaticMapTile& tile) override;
+            VMAPLoadResult loadMap(char const* pBasePath, unsigned int pMapId, int x, int y, StaticMapTile const* tile) override;
 
             void unloadMap(unsigned int pMapId, int x, int y) override;
             void unloadMap(unsigned int pMapId) override;
 
             bool isInLineOfSight(unsigned int pMapId, float x1, float y1, float z1, float x2, float y2, float z2, bool ignoreM2Model) override;
+            void areInLineOfSight(unsigned int pMapId, LineOfSightSegment* segments, uint32 count, bool ignoreM2Model) override;
             ModelInstance* FindCollisionModel(unsigned int mapId, float x0, float y0, float z0, float x1, float y1, float z1) override;
             /**
             fill the hit pos and return true, if an object was hit
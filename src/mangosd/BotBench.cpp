@@ -0,0 +1,149 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// \addtogroup mangosd
+// @{
+// \file
+
+#include "Common.h"
+#include "Database/DatabaseEnv.h"
+#include "Config/Config.h"
+#include "Log.h"
+#include "Master.h"
+#include "BotBenchRunnable.h"
+#include "SystemConfig.h"
+#include "revision.h"
+
+#include <cstdlib>
+#include <new>
+
+DatabaseType WorldDatabase;                                 // Accessor to the world database
+DatabaseType CharacterDatabase;                             // Accessor to the character database
+DatabaseType LoginDatabase;                                 // Accessor to the realm/login database
+DatabaseType LogsDatabase;                                  // Accessor to the logs database
+
+uint32 realmID;                                             // Id of the realm
+std::string realmName;                                      // Name of the realm
+
+char const* g_mainLogFileName = "BotBench.log";
+
+// Count every heap allocation of the process, reported per tick
+void* operator new(std::size_t size)
+{
+    g_botBenchAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept
+{
+    g_botBenchAllocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, std::nothrow_t const& tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::nothrow_t const&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::nothrow_t const&) noexcept { std::free(ptr); }
+
+static void printUsage(char const* thisExecutableName)
+{
+    printf(R"END(Usage: %s [<options>]
+    -c, --config <config_file>  use config_file as configuration file
+    -b, --bots <count>          random bots to log in (default 100)
+    -t, --ticks <count>         measured world ticks (default 6000)
+    -d, --tick-ms <ms>          simulated diff of each tick (default 50)
+    -w, --warmup-ms <ms>        max time to wait for the bots to log in (default 120000)
+    -r, --seed <seed>           random seed, 0 for a random run (default 1)
+)END", thisExecutableName);
+}
+
+// Launch the bot benchmark
+extern int main(int argc, char **argv)
+{
+    std::string configFilePath = _MANGOSD_CONFIG;
+    BotBenchOptions options;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string const part = argv[i];
+        if (part == "-h" || part == "--help")
+        {
+            printUsage(argv[0]);
+            return EXIT_SUCCESS;
+        }
+
+        if (i + 1 >= argc)
+        {
+            printf("Error: value required for %s\n", part.c_str());
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        char const* value = argv[++i];
+        if (part == "-c" || part == "--config")
+            configFilePath = value;
+        else if (part == "-b" || part == "--bots")
+            options.bots = std::strtoul(value, nullptr, 10);
+        else if (part == "-t" || part == "--ticks")
+            options.ticks = std::strtoul(value, nullptr, 10);
+        else if (part == "-d" || part == "--tick-ms")
+            options.tickMs = std::strtoul(value, nullptr, 10);
+        else if (part == "-w" || part == "--warmup-ms")
+            options.warmupMs = std::strtoul(value, nullptr, 10);
+        else if (part == "-r" || part == "--seed")
+            options.seed = std::strtoul(value, nullptr, 10);
+        else
+        {
+            printf("Error: unknown option %s\n", part.c_str());
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!options.bots || !options.ticks || !options.tickMs)
+    {
+        printf("Error: bots, ticks and tick-ms must be greater than 0\n");
+        return EXIT_FAILURE;
+    }
+
+    if (!sConfig.LoadFromFile(configFilePath))
+    {
+        sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "Could not find or parse configuration file %s", configFilePath.c_str());
+        return EXIT_FAILURE;
+    }
+
+    sLog.OpenWorldLogFiles();
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "Core revision: %s [bot-bench]", _FULLVERSION);
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "Using configuration file %s.", configFilePath.c_str());
+
+    return sMaster.RunHeadless(options.seed, [&options]() { return BotBenchRunnable(options).Run(); });
+}
+// @}
@@ -0,0 +1,140 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/** \file
+    \ingroup mangosd
+*/
+
+#include "Common.h"
+#include "World.h"
+#include "BotBenchRunnable.h"
+#include "Timer.h"
+#include "Log.h"
+#include "MapManager.h"
+#include "BattleGroundMgr.h"
+#include "PlayerBotMgr.h"
+#include "BotProfiler.h"
+#include "TimePeriod.h"
+
+#include "Database/DatabaseEnv.h"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+std::atomic<uint64> g_botBenchAllocations(0);
+
+static double NsToMs(uint64 ns)
+{
+    return double(ns) / 1000000.0;
+}
+
+bool BotBenchRunnable::Run()
+{
+    WorldDatabase.ThreadStart();
+    sWorld.InitResultQueue();
+
+    const auto scoped_tp = set_time_period(std::chrono::milliseconds(1));
+
+    uint32 const requested = sPlayerBotMgr.HoldRandomBots(m_options.bots);
+    if (requested < m_options.bots)
+        sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "[BotBench] Only %u of %u bots could be logged in, check RandomBot.Enable and RandomBot.MaxBots", requested, m_options.bots);
+
+    // Warm-up: logins wait on the databases, run in real time until everyone is online
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[BotBench] Waiting for %u bots to come online...", requested);
+    uint32 const warmupStart = WorldTimer::getMSTime();
+    uint32 prevTime = warmupStart;
+    while (sPlayerBotMgr.GetStats().loadingCount && WorldTimer::getMSTimeDiffToNow(warmupStart) < m_options.warmupMs)
+    {
+        uint32 const currTime = WorldTimer::getMSTime();
+        sWorld.Update(WorldTimer::getMSTimeDiff(prevTime, currTime));
+        prevTime = currTime;
+
+        uint32 const updateTime = WorldTimer::getMSTimeDiffToNow(currTime);
+        if (updateTime < m_options.tickMs)
+            std::this_thread::sleep_for(std::chrono::milliseconds(m_options.tickMs - updateTime));
+    }
+
+    uint32 const online = sPlayerBotMgr.GetStats().onlineCount;
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[BotBench] %u bots online after %u ms, %u still loading",
+        online, WorldTimer::getMSTimeDiffToNow(warmupStart), sPlayerBotMgr.GetStats().loadingCount);
+
+    bool const success = online > 0;
+    if (success)
+    {
+        // Measured ticks: constant simulated diff, back to back
+        std::vector<uint64> tickNs;
+        tickNs.reserve(m_options.ticks);
+
+        BotProfiler::Reset();
+        BotProfiler::SetEnabled(true);
+        uint64 const allocationsStart = g_botBenchAllocations;
+
+        for (uint32 i = 0; i < m_options.ticks && !World::IsStopped(); ++i)
+        {
+            ++World::m_worldLoopCounter;
+            auto const start = std::chrono::steady_clock::now();
+            sWorld.Update(m_options.tickMs);
+            tickNs.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        }
+
+        uint64 const allocations = g_botBenchAllocations - allocationsStart;
+        BotProfiler::SetEnabled(false);
+
+        uint64 totalNs = 0;
+        for (uint64 ns : tickNs)
+            totalNs += ns;
+
+        uint32 const ticks = std::max<uint32>(tickNs.size(), 1);
+        std::sort(tickNs.begin(), tickNs.end());
+        auto percentile = [&tickNs](uint32 pct) -> uint64
+        {
+            return tickNs.empty() ? 0 : tickNs[(tickNs.size() - 1) * pct / 100];
+        };
+
+        sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[BotBench] seed %u, %u bots, %u ticks of %u ms",
+            m_options.seed, sPlayerBotMgr.GetStats().onlineCount, uint32(tickNs.size()), m_options.tickMs);
+        sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[BotBench] tick p50 %.3f ms, p99 %.3f ms, max %.3f ms, mean %.3f ms",
+            NsToMs(percentile(50)), NsToMs(percentile(99)), NsToMs(tickNs.empty() ? 0 : tickNs.back()), NsToMs(totalNs) / ticks);
+
+        for (uint32 i = 0; i < MAX_BOT_PROFILE_SECTIONS; ++i)
+        {
+            BotProfileSection const section = BotProfileSection(i);
+            uint64 const sectionNs = uint64(BotProfiler::TicksToUs(BotProfiler::GetTotalTicks(section)) * 1000.0);
+            uint64 const calls = BotProfiler::GetCalls(section);
+            sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[BotBench] %-18s %10.3f ms total, %.3f ms/tick, %8llu calls, %.2f us/call",
+                BotProfiler::GetSectionName(section), NsToMs(sectionNs), NsToMs(sectionNs) / ticks,
+                (unsigned long long)calls, calls ? double(sectionNs) / 1000.0 / calls : 0.0);
+        }
+
+        if (allocations)
+            sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[BotBench] %.1f allocations/tick (%llu total)", double(allocations) / ticks, (unsigned long long)allocations);
+        else
+            sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "[BotBench] allocations not counted in this binary");
+    }
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "Shutting down world...");
+    sWorld.Shutdown();
+
+    // unload battleground templates before different singletons destroyed
+    sBattleGroundMgr.DeleteAllBattleGrounds();
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "Unloading all maps...");
+    sMapMgr.UnloadAll();
+
+    WorldDatabase.ThreadEnd();
+    return success;
+}
@@ -0,0 +1,55 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// \addtogroup mangosd
+// @{
+// \file
+
+#ifndef __BOTBENCHRUNNABLE_H
+#define __BOTBENCHRUNNABLE_H
+
+#include "Common.h"
+#include <atomic>
+
+struct BotBenchOptions
+{
+    uint32 bots = 100;              // random bots to log in
+    uint32 ticks = 6000;            // measured world ticks
+    uint32 tickMs = 50;             // simulated diff of each measured tick
+    uint32 warmupMs = 120000;       // max real time to wait for the bots to come online
+    uint32 seed = 1;                // RNG seed, set before the world is loaded
+};
+
+// Heap allocations so far, counted by the bot_bench operator new
+extern std::atomic<uint64> g_botBenchAllocations;
+
+// Headless bot soak benchmark. Runs on the calling thread in place of
+// WorldRunnable: logs in a fixed number of random bots, runs a fixed number
+// of world ticks with a constant diff and reports tick time percentiles,
+// time per bot strategy and allocations per tick.
+class BotBenchRunnable
+{
+    public:
+        explicit BotBenchRunnable(BotBenchOptions const& options) : m_options(options) {}
+
+        // Returns false when no bot came online
+        bool Run();
+
+    private:
+        BotBenchOptions m_options;
+};
+#endif
+// @}
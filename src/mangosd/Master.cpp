@@ -410,6 +410,55 @@ int Master::Run()
     return World::GetExitCode();
 }
 
+// Headless run (bot_bench): same databases and world as Run(), no network, CLI or world thread.
+// body runs on the calling thread once the world is loaded.
+int Master::RunHeadless(uint32 randomSeed, std::function<bool()> const& body)
+{
+    if (!_StartDB())
+    {
+        Log::WaitBeforeContinueIfNeed();
+        return 1;
+    }
+
+    {
+        std::unique_ptr<QueryResult> result{LoginDatabase.PQuery("SELECT `name` FROM `realmlist` WHERE `id` = %d", realmID)};
+        if (!result)
+        {
+            sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "Config contains invalid realmID %d, make sure its set in the `realmlist` table", realmID);
+            return 1;
+        }
+        realmName = (*result)[0].GetCppString();
+    }
+
+    // Everything loaded below draws from the seeded generators
+    SetRandomSeed(randomSeed);
+
+    sWorld.SetInitialWorldSettings();
+
+    CharacterDatabase.AllowAsyncTransactions();
+    WorldDatabase.AllowAsyncTransactions();
+    LoginDatabase.AllowAsyncTransactions();
+    LogsDatabase.AllowAsyncTransactions();
+
+    (void)sAsyncSystemTimer; // <-- Pre-Initialize SystemTimer
+
+    bool const success = body();
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "Stop system timers...");
+    sAsyncSystemTimer.RemoveAllTimersAndStopThread();
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "Cleaning character database...");
+    clearOnlineAccounts();
+
+    sLog.Out(LOG_BASIC, LOG_LVL_MINIMAL, "Closing database connections...");
+    CharacterDatabase.StopServer();
+    WorldDatabase.StopServer();
+    LoginDatabase.StopServer();
+    LogsDatabase.StopServer();
+
+    return success ? 0 : 1;
+}
+
 bool StartDB(const std::string& name, DatabaseType& database, char const** migrations)
 {
     // Get database info from configuration file
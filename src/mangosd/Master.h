@@ -29,6 +29,8 @@
 #include "Common.h"
 #include "Policies/Singleton.h"
 
+#include <functional>
+
 // Start the server
 class Master
 {
@@ -36,6 +38,7 @@ class Master
         Master();
         ~Master();
         int Run();
+        int RunHeadless(uint32 randomSeed, std::function<bool()> const& body);
         static volatile uint32  m_masterLoopCounter;
         static volatile bool    m_handleSigvSignals;
         static void SigvSignalHandler();
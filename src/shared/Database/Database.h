@@ -238,6 +238,8 @@ class Database
         bool BeginTransaction(uint32 serialId = 0);
         bool InTransaction();
         uint32 GetTransactionSerialId();
+        // Transactions with the same serial id modulo this count run in order on one worker
+        uint32 GetSerialWorkerCount() const { return m_numAsyncWorkers; }
         bool CommitTransaction();
         bool RollbackTransaction();
         //for sync transaction execution
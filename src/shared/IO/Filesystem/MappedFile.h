@@ -0,0 +1,60 @@
+#ifndef MANGOS_IO_FILESYSTEM_MAPPEDFILE_H
+#define MANGOS_IO_FILESYSTEM_MAPPEDFILE_H
+
+#include <cstdint>
+#include <string>
+#include <memory>
+#include "IO/NativeAliases.h"
+
+namespace IO { namespace Filesystem {
+
+    enum class MappedFileAccess
+    {
+        /// Pages are read from disk when first touched
+        OnDemand,
+        /// All pages are read in while mapping, the file is about to be used
+        Preload,
+    };
+
+    /// A file mapped read only into memory.
+    /// The pages are the ones of the OS page cache, so every mapping of the same file
+    /// (in this process or any other) shares them, and they survive a restart.
+    class MappedFileReadonly
+    {
+    public:
+        ~MappedFileReadonly();
+        MappedFileReadonly(MappedFileReadonly const&) = delete;
+        MappedFileReadonly& operator=(MappedFileReadonly const&) = delete;
+        MappedFileReadonly(MappedFileReadonly&&) = delete;
+        MappedFileReadonly& operator=(MappedFileReadonly&&) = delete;
+
+        /// Valid as long as this object lives. Writing to it crashes.
+        [[nodiscard]]
+        uint8_t const* GetData() const { return m_data; }
+
+        [[nodiscard]]
+        uint64_t GetSize() const { return m_size; }
+
+        /// Returns the file path used to map this file
+        [[nodiscard]]
+        std::string GetFilePath() const { return m_filePath; }
+
+    private:
+        friend std::unique_ptr<MappedFileReadonly> TryMapFileReadonly(std::string const& filePath, MappedFileAccess access);
+
+        explicit MappedFileReadonly(std::string filePath, uint8_t const* data, uint64_t size) : m_filePath(std::move(filePath)), m_data(data), m_size(size) {};
+        std::string m_filePath;
+        uint8_t const* m_data;
+        uint64_t m_size;
+    };
+
+    /// Maps a whole file read only.
+    /// You have to check the resulting pointer for nullptr!
+    /// If the file does not exist or is empty the ptr will be null without an error being logged,
+    /// other failures are logged.
+    [[nodiscard]]
+    std::unique_ptr<MappedFileReadonly> TryMapFileReadonly(std::string const& filePath, MappedFileAccess access);
+
+}} // namespace IO::Filesystem
+
+#endif //MANGOS_IO_FILESYSTEM_MAPPEDFILE_H
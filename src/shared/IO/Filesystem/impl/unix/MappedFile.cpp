@@ -0,0 +1,54 @@
+#include "IO/Filesystem/MappedFile.h"
+#include "Log.h"
+#include "IO/SystemErrorToString.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+IO::Filesystem::MappedFileReadonly::~MappedFileReadonly()
+{
+    ::munmap(const_cast<uint8_t*>(m_data), m_size);
+}
+
+std::unique_ptr<IO::Filesystem::MappedFileReadonly> IO::Filesystem::TryMapFileReadonly(std::string const& filePath, IO::Filesystem::MappedFileAccess access)
+{
+    int fileHandle = ::open(filePath.c_str(), O_RDONLY);
+    if (fileHandle == -1)
+    {
+        if (errno != ENOENT)
+            sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "Unable to open file. Error %s on file: %s", SystemErrorToString(errno).c_str(), filePath.c_str());
+        return nullptr;
+    }
+
+    struct stat file_stat;
+    if (::fstat(fileHandle, &file_stat) == -1 || file_stat.st_size <= 0)
+    {
+        ::close(fileHandle);
+        return nullptr;
+    }
+
+    int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    if (access == MappedFileAccess::Preload)
+        flags |= MAP_POPULATE;
+#endif
+
+    void* data = ::mmap(nullptr, file_stat.st_size, PROT_READ, flags, fileHandle, 0);
+    int const mapError = errno;
+    ::close(fileHandle); // the mapping keeps its own reference to the file
+
+    if (data == MAP_FAILED)
+    {
+        sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "Unable to map file. Error %s on file: %s", SystemErrorToString(mapError).c_str(), filePath.c_str());
+        return nullptr;
+    }
+
+#ifndef MAP_POPULATE
+    if (access == MappedFileAccess::Preload)
+        ::madvise(data, file_stat.st_size, MADV_WILLNEED);
+#endif
+
+    return std::unique_ptr<MappedFileReadonly>(new MappedFileReadonly(filePath, static_cast<uint8_t const*>(data), file_stat.st_size));
+}
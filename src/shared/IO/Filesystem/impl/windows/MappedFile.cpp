@@ -0,0 +1,65 @@
+#include "IO/Filesystem/MappedFile.h"
+#include "Log.h"
+
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#undef WIN32_LEAN_AND_MEAN
+
+IO::Filesystem::MappedFileReadonly::~MappedFileReadonly()
+{
+    ::UnmapViewOfFile(m_data);
+}
+
+std::unique_ptr<IO::Filesystem::MappedFileReadonly> IO::Filesystem::TryMapFileReadonly(std::string const& filePath, IO::Filesystem::MappedFileAccess access)
+{
+    HANDLE nativeFileHandle = CreateFileA(
+            filePath.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,       // Share mode: allow other processes to read
+            nullptr,               // Security attributes
+            OPEN_EXISTING,         // Open exising file. Fail if it does not exist
+            FILE_ATTRIBUTE_NORMAL, // Normal open, without any special flags
+            nullptr                // Template file handle (would be used when creating a new file and copy the attributes)
+    );
+
+    if (nativeFileHandle == INVALID_HANDLE_VALUE)
+    {
+        DWORD const error = GetLastError();
+        if (error != ERROR_FILE_NOT_FOUND && error != ERROR_PATH_NOT_FOUND)
+            sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "Unable to open file. Error %u on file: %s", error, filePath.c_str());
+        return nullptr;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!::GetFileSizeEx(nativeFileHandle, &fileSize) || fileSize.QuadPart <= 0)
+    {
+        ::CloseHandle(nativeFileHandle);
+        return nullptr;
+    }
+
+    HANDLE mappingHandle = ::CreateFileMappingA(nativeFileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* data = mappingHandle ? ::MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    DWORD const mapError = GetLastError();
+
+    // The view keeps the mapping and the file open
+    if (mappingHandle)
+        ::CloseHandle(mappingHandle);
+    ::CloseHandle(nativeFileHandle);
+
+    if (!data)
+    {
+        sLog.Out(LOG_BASIC, LOG_LVL_ERROR, "Unable to map file. Error %u on file: %s", mapError, filePath.c_str());
+        return nullptr;
+    }
+
+    uint8_t const* bytes = static_cast<uint8_t const*>(data);
+    if (access == MappedFileAccess::Preload)
+    {
+        // Touch every page, so they are read in now rather than on first use
+        uint8_t volatile sum = 0;
+        for (uint64_t offset = 0; offset < uint64_t(fileSize.QuadPart); offset += 4096)
+            sum += bytes[offset];
+    }
+
+    return std::unique_ptr<MappedFileReadonly>(new MappedFileReadonly(filePath, bytes, fileSize.QuadPart));
+}
@@ -0,0 +1,290 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "TaskScheduler.h"
+#include "Policies/SingletonImp.h"
+#include "Util.h"
+#include "IO/Multithreading/CreateThread.h"
+#include <mysql.h>
+
+INSTANTIATE_SINGLETON_1(TaskScheduler);
+
+namespace
+{
+    // Worker the calling thread is, if any
+    thread_local TaskScheduler const* t_scheduler = nullptr;
+    thread_local uint32 t_workerIndex = 0;
+
+    // Longest a waiting group sleeps before looking for its tasks again
+    constexpr std::chrono::milliseconds GROUP_WAIT_POLL(1);
+}
+
+TaskScheduler::TaskScheduler()
+{
+    // The shared queue
+    m_queues.emplace_back(new Queue());
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    Stop();
+}
+
+void TaskScheduler::Start(uint32 numThreads)
+{
+    if (m_workerCount)
+        return;
+
+    if (!numThreads)
+        numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    m_stopping = false;
+
+    // Worker queues come first, the shared one stays last
+    m_queues.clear();
+    for (uint32 i = 0; i <= numThreads; ++i)
+        m_queues.emplace_back(new Queue());
+
+    m_workerCount = numThreads;
+    m_threads.reserve(numThreads);
+    for (uint32 i = 0; i < numThreads; ++i)
+        m_threads.emplace_back(IO::Multithreading::CreateThread("MapTask[" + std::to_string(i) + "]", [this, i]() { WorkerLoop(i); }));
+}
+
+void TaskScheduler::Stop()
+{
+    if (!m_workerCount)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_sleepLock);
+        m_stopping = true;
+    }
+    m_wakeUp.notify_all();
+
+    for (std::thread& thread : m_threads)
+        thread.join();
+    m_threads.clear();
+
+    // Anything queued since the workers stopped runs here
+    std::unique_ptr<Queue> shared(new Queue());
+    for (std::unique_ptr<Queue>& queue : m_queues)
+        for (Item& item : queue->items)
+            shared->items.push_back(std::move(item));
+    m_queues.clear();
+    m_queues.push_back(std::move(shared));
+    m_workerCount = 0;
+
+    Item item;
+    while (PopFrom(*m_queues.back(), item, nullptr, false))
+        Execute(item);
+}
+
+void TaskScheduler::Submit(Item&& item)
+{
+    if (!m_workerCount)
+    {
+        Execute(item);
+        return;
+    }
+
+    // Counted first, so a worker popping it never sees the count go below zero
+    ++m_queued;
+    Queue& queue = t_scheduler == this ? *m_queues[t_workerIndex] : *m_queues.back();
+    {
+        std::lock_guard<std::mutex> lock(queue.lock);
+        queue.items.push_back(std::move(item));
+    }
+
+    if (m_sleeping.load())
+    {
+        // Taken so a worker cannot miss the wake up between its check and its wait
+        std::lock_guard<std::mutex> lock(m_sleepLock);
+        m_wakeUp.notify_one();
+    }
+}
+
+bool TaskScheduler::PopFrom(Queue& queue, Item& item, TaskGroup const* group, bool fromBack)
+{
+    std::lock_guard<std::mutex> lock(queue.lock);
+    if (queue.items.empty())
+        return false;
+
+    if (!group)
+    {
+        if (fromBack)
+        {
+            item = std::move(queue.items.back());
+            queue.items.pop_back();
+        }
+        else
+        {
+            item = std::move(queue.items.front());
+            queue.items.pop_front();
+        }
+        --m_queued;
+        return true;
+    }
+
+    if (fromBack)
+    {
+        for (auto itr = queue.items.rbegin(); itr != queue.items.rend(); ++itr)
+        {
+            if (itr->group != group)
+                continue;
+
+            item = std::move(*itr);
+            queue.items.erase(std::next(itr).base());
+            --m_queued;
+            return true;
+        }
+    }
+    else
+    {
+        for (auto itr = queue.items.begin(); itr != queue.items.end(); ++itr)
+        {
+            if (itr->group != group)
+                continue;
+
+            item = std::move(*itr);
+            queue.items.erase(itr);
+            --m_queued;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TaskScheduler::Pop(Item& item, TaskGroup const* group)
+{
+    if (!m_queued.load())
+        return false;
+
+    // Own queue newest first, it is the work most likely still in cache
+    uint32 const count = m_queues.size();
+    uint32 first = 0;
+    if (t_scheduler == this)
+    {
+        if (PopFrom(*m_queues[t_workerIndex], item, group, true))
+            return true;
+        first = t_workerIndex + 1;
+    }
+
+    // Then the shared queue and the other workers, oldest first
+    if (PopFrom(*m_queues.back(), item, group, false))
+        return true;
+
+    for (uint32 i = 0; i < count - 1; ++i)
+    {
+        uint32 const victim = (first + i) % (count - 1);
+        if (t_scheduler == this && victim == t_workerIndex)
+            continue;
+
+        if (PopFrom(*m_queues[victim], item, group, false))
+            return true;
+    }
+    return false;
+}
+
+void TaskScheduler::Execute(Item& item)
+{
+    item.task();
+    item.task = nullptr;
+
+    if (item.group)
+        item.group->OnTaskDone();
+}
+
+bool TaskScheduler::RunPendingTask()
+{
+    Item item;
+    if (!Pop(item, nullptr))
+        return false;
+
+    Execute(item);
+    return true;
+}
+
+void TaskScheduler::WorkerLoop(uint32 index)
+{
+    t_scheduler = this;
+    t_workerIndex = index;
+
+    // 0 is the thread that set the seed
+    SeedThreadRandom(1 + index);
+
+    // Map updates run queries, as they did on the MySQL thread pools
+    mysql_thread_init();
+
+    while (true)
+    {
+        Item item;
+        if (Pop(item, nullptr))
+        {
+            Execute(item);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleepLock);
+        if (m_stopping)
+            break;
+
+        ++m_sleeping;
+        m_wakeUp.wait(lock, [this]() { return m_stopping || m_queued.load(); });
+        --m_sleeping;
+    }
+
+    mysql_thread_end();
+    t_scheduler = nullptr;
+}
+
+// ============================================================================
+// TaskGroup
+// ============================================================================
+
+void TaskGroup::Run(TaskScheduler::Task task)
+{
+    ++m_pending;
+    m_scheduler.Submit({ std::move(task), this });
+}
+
+void TaskGroup::OnTaskDone()
+{
+    // Under the lock, so the waiter cannot destroy the group before the notify
+    std::lock_guard<std::mutex> lock(m_lock);
+    if (!--m_pending)
+        m_done.notify_all();
+}
+
+void TaskGroup::Wait()
+{
+    while (m_pending.load())
+    {
+        TaskScheduler::Item item;
+        if (m_scheduler.Pop(item, this))
+        {
+            m_scheduler.Execute(item);
+            continue;
+        }
+
+        // The rest runs on other threads, or is queued by them
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_done.wait_for(lock, GROUP_WAIT_POLL, [this]() { return !m_pending.load(); });
+    }
+
+    // Last task done may still be notifying
+    std::lock_guard<std::mutex> lock(m_lock);
+}
@@ -0,0 +1,145 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef TASKSCHEDULER_H
+#define TASKSCHEDULER_H
+
+#include "Common.h"
+#include "Policies/Singleton.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class TaskGroup;
+
+/**
+ * @brief Process wide work stealing scheduler for the map update.
+ *
+ * Each worker owns a deque: tasks it queues go to the back and it runs
+ * them from the back, idle workers steal from the front of the others.
+ * Tasks queued from other threads (the world thread) go to a shared
+ * queue every worker takes from.
+ *
+ * Tasks are queued through a TaskGroup. Waiting on a group runs that
+ * group's queued tasks on the waiting thread, so a map waiting on its
+ * cell updates works on them instead of sleeping. A thread only helps
+ * its own group there, so a short wait never picks up a whole map
+ * update. Code waiting on something else than a group may call
+ * RunPendingTask() to help with any queued task.
+ *
+ * Without workers (not started, or stopped) tasks run when queued.
+ */
+class TaskScheduler
+{
+    public:
+        using Task = std::function<void()>;
+
+        TaskScheduler();
+        ~TaskScheduler();
+
+        /**
+         * @brief Start spawns the workers.
+         * @param numThreads number of workers, 0 for one per hardware thread.
+         */
+        void Start(uint32 numThreads);
+
+        /**
+         * @brief Stop runs what is queued, then joins the workers.
+         */
+        void Stop();
+
+        uint32 GetWorkerCount() const { return m_workerCount; }
+
+        /**
+         * @brief RunPendingTask runs one queued task on the calling thread.
+         * @return false if nothing was queued.
+         */
+        bool RunPendingTask();
+
+    private:
+        friend class TaskGroup;
+
+        struct Item
+        {
+            Task task;
+            TaskGroup* group;
+        };
+
+        struct Queue
+        {
+            std::mutex lock;
+            std::deque<Item> items;
+        };
+
+        void Submit(Item&& item);
+        bool Pop(Item& item, TaskGroup const* group);
+        bool PopFrom(Queue& queue, Item& item, TaskGroup const* group, bool fromBack);
+        void Execute(Item& item);
+        void WorkerLoop(uint32 index);
+
+        std::vector<std::unique_ptr<Queue>> m_queues;   // one per worker, then the shared one
+        std::vector<std::thread> m_threads;
+        uint32 m_workerCount = 0;
+
+        std::mutex m_sleepLock;
+        std::condition_variable m_wakeUp;
+        std::atomic<uint32> m_queued{ 0 };
+        std::atomic<uint32> m_sleeping{ 0 };
+        std::atomic<bool> m_stopping{ false };
+};
+
+#define sTaskScheduler MaNGOS::Singleton<TaskScheduler>::Instance()
+
+/**
+ * @brief Tasks waited on together.
+ *
+ * Tasks of the group may queue more tasks to it, but only one thread
+ * may wait on it. The destructor waits.
+ */
+class TaskGroup
+{
+    public:
+        explicit TaskGroup(TaskScheduler& scheduler = sTaskScheduler) : m_scheduler(scheduler) {}
+        ~TaskGroup() { Wait(); }
+
+        TaskGroup(TaskGroup const&) = delete;
+        TaskGroup& operator=(TaskGroup const&) = delete;
+
+        void Run(TaskScheduler::Task task);
+
+        /**
+         * @brief Wait returns once all tasks of the group ran,
+         * running the queued ones on the calling thread meanwhile.
+         */
+        void Wait();
+
+    private:
+        friend class TaskScheduler;
+
+        void OnTaskDone();
+
+        TaskScheduler& m_scheduler;
+        std::atomic<uint32> m_pending{ 0 };
+        std::mutex m_lock;
+        std::condition_variable m_done;
+};
+
+#endif
@@ -18,6 +18,7 @@
 
 #include "ThreadPool.h"
 #include "Log.h"
+#include "Util.h"
 #include "IO/Multithreading/CreateThread.h"
 #include <mysql.h>
 
@@ -126,6 +127,9 @@ ThreadPool::worker::~worker()
 
 void ThreadPool::worker::loop_wrapper()
 {
+    // Pools of different names draw different sequences
+    SeedThreadRandom(uint32(std::hash<std::string>()(pool->m_poolName)) + id);
+
     if (pool->m_errorHandling == ErrorHandling::NONE)
         loop();
     else
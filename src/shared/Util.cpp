@@ -30,14 +30,30 @@
 #include "utf8cpp/utf8.h"
 #include "mersennetwister/MersenneTwister.h"
 
+#include <atomic>
 #include <cstdarg>
 
 #if PLATFORM == PLATFORM_WINDOWS
 #include <Windows.h>
 #endif
 
+// Non-zero once SetRandomSeed was called, worker threads then derive their seed from it
+static std::atomic<uint32> s_randomSeed(0);
+
 thread_local MTRand mtRand;
 
+void SetRandomSeed(uint32 baseSeed)
+{
+    s_randomSeed = baseSeed;
+    mtRand.seed(baseSeed);
+}
+
+void SeedThreadRandom(uint32 streamIndex)
+{
+    if (uint32 const baseSeed = s_randomSeed)
+        mtRand.seed(baseSeed + streamIndex);
+}
+
 Tokenizer::Tokenizer(std::string const& src, char const sep, uint32 vectorReserve)
 {
     m_str = new char[src.length() + 1];
@@ -76,6 +76,16 @@ inline uint32 secsToTimeBitFields(time_t secs)
     return (lt->tm_year - 100) << 24 | lt->tm_mon  << 20 | (lt->tm_mday - 1) << 14 | lt->tm_wday << 11 | lt->tm_hour << 6 | lt->tm_min;
 }
 
+/* Seed the random generator of the calling thread, and the base seed of SeedThreadRandom().
+   0 keeps the default random seeding. */
+void SetRandomSeed(uint32 baseSeed);
+
+/* Seed the random generator of the calling thread with the base seed + streamIndex, an index its
+   creator gives it (worker number), so the same seed gives every thread the same sequence.
+   Threads that never call it keep the default random seeding. Which tasks a worker runs still
+   depends on scheduling. */
+void SeedThreadRandom(uint32 streamIndex);
+
 /* Return a random number in the range min..max; (max-min) must be smaller than 32768. */
 int32 irand(int32 min, int32 max);
 